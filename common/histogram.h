@@ -0,0 +1,96 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+// HdrHistogram-style log-linear histogram. Values below 2^kSubBits are counted exactly;
+// above that, every power of two is split into 2^kSubBits linear sub-buckets, so any
+// reported percentile is within 1/128 (~0.8%) of the true value. Buckets are relaxed
+// atomics, so record() is lock-free and safe from any number of threads.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBits = 7;
+    static constexpr uint64_t kSubCount = 1ull << kSubBits;
+    static constexpr int kMaxBits = 40;  // values are clamped to 2^40 - 1
+    static constexpr uint64_t kMaxValue = (1ull << kMaxBits) - 1;
+    static constexpr size_t kNumBuckets = (kMaxBits - kSubBits + 1) * kSubCount;
+
+    LatencyHistogram() : buckets_(new std::atomic<uint64_t>[kNumBuckets]) { reset(); }
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t value, uint64_t count = 1) {
+        if (value > kMaxValue) value = kMaxValue;
+        buckets_[index_of(value)].fetch_add(count, std::memory_order_relaxed);
+        count_.fetch_add(count, std::memory_order_relaxed);
+        sum_.fetch_add(value * count, std::memory_order_relaxed);
+        uint64_t prev = max_.load(std::memory_order_relaxed);
+        while (value > prev && !max_.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {}
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < kNumBuckets; ++i) {
+            uint64_t c = other.buckets_[i].load(std::memory_order_relaxed);
+            if (c) buckets_[i].fetch_add(c, std::memory_order_relaxed);
+        }
+        count_.fetch_add(other.count(), std::memory_order_relaxed);
+        sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        uint64_t theirs = other.max(), prev = max_.load(std::memory_order_relaxed);
+        while (theirs > prev && !max_.compare_exchange_weak(prev, theirs, std::memory_order_relaxed)) {}
+    }
+
+    void reset() {
+        for (size_t i = 0; i < kNumBuckets; ++i) buckets_[i].store(0, std::memory_order_relaxed);
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+    double mean() const {
+        uint64_t n = count();
+        return n ? (double)sum_.load(std::memory_order_relaxed) / n : 0.0;
+    }
+
+    // Smallest recorded bucket value v such that at least p (0..1) of samples are <= v.
+    uint64_t percentile(double p) const {
+        uint64_t n = count();
+        if (n == 0) return 0;
+        uint64_t rank = std::max<uint64_t>(1, (uint64_t)(p * n + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kNumBuckets; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen >= rank) return std::min(highest_equivalent(i), max());
+        }
+        return max();
+    }
+
+    // Iteration hooks for exporters: bucket i holds values in (upper_bound(i - 1), upper_bound(i)].
+    static uint64_t upper_bound(size_t index) { return highest_equivalent(index); }
+    uint64_t bucket_count(size_t index) const { return buckets_[index].load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+
+    static size_t index_of(uint64_t v) {
+        if (v < kSubCount) return v;
+        int msb = 63 - __builtin_clzll(v);
+        int group = msb - kSubBits + 1;
+        uint64_t sub = (v >> (msb - kSubBits)) - kSubCount;
+        return group * kSubCount + sub;
+    }
+
+    static uint64_t highest_equivalent(size_t index) {
+        uint64_t group = index / kSubCount, sub = index % kSubCount;
+        if (group == 0) return sub;
+        uint64_t width = 1ull << (group - 1);
+        return ((kSubCount + sub) << (group - 1)) + width - 1;
+    }
+};
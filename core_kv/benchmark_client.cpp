@@ -1,4 +1,7 @@
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <memory>
 #include <string>
 #include <thread>
@@ -6,144 +9,462 @@
 #include <chrono>
 #include <random>
 #include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <cctype>
 
-#include <grpcpp/grpcpp.h>
-#include "kvstore.grpc.pb.h"
-
-using grpc::Channel;
-using grpc::ClientContext;
-using grpc::Status;
-using kvstore::KVStore;
-using kvstore::PutRequest;
-using kvstore::PutReply;
-using kvstore::GetRequest;
-using kvstore::GetReply;
-using kvstore::Void;
-
-constexpr int TOTAL_KEYS = 1'000'000;
-constexpr int PRELOAD_KEYS = 500'000;
-constexpr int TOTAL_OPS = 10'000'000;
-constexpr int THREADS = 4;
-constexpr double PUT_RATIO = 0.10;
-constexpr size_t BLOB_SIZE = 128;
-
-class ZipfGenerator {
+#include "kv_client.h"
+#include "histogram.h"
+#include "metrics.h"
+
+/* YCSB-style benchmark for the KV store.
+ *
+ *   ./benchmark_client --workload=A --records=100000 --operations=1000000 --threads=8 \
+ *                      --target_rate=20000 --json=results.json
+ *
+ * With --target_rate the run is open-loop: every operation has an intended start time on a
+ * fixed schedule and its latency is measured from that time, not from when the (possibly late)
+ * thread got around to sending it. This is the coordinated-omission correction; without it a
+ * stalled server hides its own tail. Without --target_rate threads run closed-loop.
+ */
+
+using Clock = std::chrono::steady_clock;
+
+enum OpType { OP_READ, OP_UPDATE, OP_INSERT, OP_SCAN, OP_RMW, NUM_OPS };
+static const char* OP_NAMES[NUM_OPS] = {"READ", "UPDATE", "INSERT", "SCAN", "READ-MODIFY-WRITE"};
+
+enum class KeyDist { UNIFORM, ZIPFIAN, LATEST };
+
+// YCSB core workloads. E's scans are served by MultiGet over consecutive keys since the
+// service has no range RPC.
+struct Workload {
+    char name;
+    double mix[NUM_OPS];
+    KeyDist dist;
+};
+
+static const Workload WORKLOADS[] = {
+    {'A', {0.50, 0.50, 0.00, 0.00, 0.00}, KeyDist::ZIPFIAN},  // update heavy
+    {'B', {0.95, 0.05, 0.00, 0.00, 0.00}, KeyDist::ZIPFIAN},  // read mostly
+    {'C', {1.00, 0.00, 0.00, 0.00, 0.00}, KeyDist::ZIPFIAN},  // read only
+    {'D', {0.95, 0.00, 0.05, 0.00, 0.00}, KeyDist::LATEST},   // read latest
+    {'E', {0.00, 0.00, 0.05, 0.95, 0.00}, KeyDist::ZIPFIAN},  // short ranges
+    {'F', {0.50, 0.00, 0.00, 0.00, 0.50}, KeyDist::ZIPFIAN},  // read-modify-write
+};
+
+struct SizeDist {
+    enum Kind { FIXED, UNIFORM, ZIPFIAN } kind = FIXED;
+    int min = 0;
+    int max = 0;
+};
+
+struct BenchConfig {
+    KVClientOptions client;
+    Workload workload = WORKLOADS[0];
+    std::string key_dist;  // overrides the workload's request distribution when set
+    uint64_t records = 100'000;
+    uint64_t operations = 1'000'000;
+    int threads = 4;
+    double target_rate = 0;  // total ops/sec across all threads, 0 = closed loop
+    double zipf_theta = 0.99;
+    SizeDist key_size{SizeDist::FIXED, 16, 16};
+    SizeDist value_size{SizeDist::FIXED, 128, 128};
+    int scan_max = 100;
+    bool load = true;
+    uint64_t seed = 42;
+    std::string json_path;
+};
+
+/* PARSING EXECUTABLE FLAGS */
+std::string extract_flag_value(const std::string& arg, const std::string& prefix) {
+    if (arg.rfind(prefix, 0) == 0) {
+        return arg.substr(prefix.size());
+    }
+    return "";
+}
+
+// "128" => fixed, "uniform:64-1024", "zipfian:64-1024"
+SizeDist parse_size(const std::string& val) {
+    SizeDist d;
+    std::string range = val;
+    if (auto pos = val.find(':'); pos != std::string::npos) {
+        std::string kind = val.substr(0, pos);
+        d.kind = kind == "zipfian" ? SizeDist::ZIPFIAN : SizeDist::UNIFORM;
+        range = val.substr(pos + 1);
+    }
+    if (auto dash = range.find('-'); dash != std::string::npos) {
+        d.min = std::stoi(range.substr(0, dash));
+        d.max = std::stoi(range.substr(dash + 1));
+    } else {
+        d.min = d.max = std::stoi(range);
+    }
+    if (d.max < d.min) std::swap(d.min, d.max);
+    return d;
+}
+
+void parse_flags(int argc, char** argv, BenchConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (auto val = extract_flag_value(arg, "--endpoints="); !val.empty()) {
+            size_t start = 0, end = 0;
+            while ((end = val.find(',', start)) != std::string::npos) {
+                config.client.endpoints.push_back(val.substr(start, end - start));
+                start = end + 1;
+            }
+            if (start < val.size()) config.client.endpoints.push_back(val.substr(start));
+        } else if (auto val = extract_flag_value(arg, "--workload="); !val.empty()) {
+            for (const Workload& w : WORKLOADS) {
+                if (w.name == std::toupper(val[0])) config.workload = w;
+            }
+        } else if (auto val = extract_flag_value(arg, "--records="); !val.empty()) {
+            config.records = std::stoull(val);
+        } else if (auto val = extract_flag_value(arg, "--operations="); !val.empty()) {
+            config.operations = std::stoull(val);
+        } else if (auto val = extract_flag_value(arg, "--threads="); !val.empty()) {
+            config.threads = std::max(1, std::stoi(val));
+        } else if (auto val = extract_flag_value(arg, "--target_rate="); !val.empty()) {
+            config.target_rate = std::stod(val);
+        } else if (auto val = extract_flag_value(arg, "--key_dist="); !val.empty()) {
+            config.key_dist = val;
+        } else if (auto val = extract_flag_value(arg, "--zipf_theta="); !val.empty()) {
+            config.zipf_theta = std::stod(val);
+        } else if (auto val = extract_flag_value(arg, "--key_size="); !val.empty()) {
+            config.key_size = parse_size(val);
+        } else if (auto val = extract_flag_value(arg, "--value_size="); !val.empty()) {
+            config.value_size = parse_size(val);
+        } else if (auto val = extract_flag_value(arg, "--scan_max="); !val.empty()) {
+            config.scan_max = std::max(1, std::stoi(val));
+        } else if (auto val = extract_flag_value(arg, "--load="); !val.empty()) {
+            config.load = (val == "true");
+        } else if (auto val = extract_flag_value(arg, "--seed="); !val.empty()) {
+            config.seed = std::stoull(val);
+        } else if (auto val = extract_flag_value(arg, "--hedge_reads="); !val.empty()) {
+            config.client.hedge_reads = (val == "true");
+        } else if (auto val = extract_flag_value(arg, "--channels="); !val.empty()) {
+            config.client.channels_per_endpoint = std::stoi(val);
+        } else if (auto val = extract_flag_value(arg, "--json="); !val.empty()) {
+            config.json_path = val;
+        }
+    }
+    if (config.client.endpoints.empty()) config.client.endpoints.push_back("localhost:50051");
+    if (!config.key_dist.empty()) {
+        config.workload.dist = config.key_dist == "uniform" ? KeyDist::UNIFORM
+                             : config.key_dist == "latest" ? KeyDist::LATEST : KeyDist::ZIPFIAN;
+    }
+    // The closed-form sampler below is undefined at theta == 1
+    config.zipf_theta = std::min(config.zipf_theta, 0.9999);
+}
+
+/* KEY AND VALUE GENERATION */
+static uint64_t fnv1a(uint64_t v) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (int i = 0; i < 8; ++i) {
+        h ^= (v >> (i * 8)) & 0xff;
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+// Zipfian over [0, items) using Gray et al.'s closed form, as YCSB does. Immutable after
+// construction, so one instance is shared by all threads, each bringing its own RNG.
+class ZipfianGenerator {
 public:
-    ZipfGenerator(int n, double s) : n_(n), s_(s) {
-        init();
+    ZipfianGenerator(uint64_t items, double theta) : items_(std::max<uint64_t>(items, 2)), theta_(theta) {
+        zetan_ = zeta(items_, theta_);
+        alpha_ = 1.0 / (1.0 - theta_);
+        eta_ = (1 - std::pow(2.0 / items_, 1 - theta_)) / (1 - zeta(2, theta_) / zetan_);
+        half_pow_theta_ = 1.0 + std::pow(0.5, theta_);
     }
 
-    int next() {
-        double u = dist_(gen_);
-        auto it = std::lower_bound(cdf_.begin(), cdf_.end(), u);
-        return std::distance(cdf_.begin(), it);
+    uint64_t next(std::mt19937_64& rng) const {
+        double u = std::uniform_real_distribution<>(0.0, 1.0)(rng);
+        double uz = u * zetan_;
+        if (uz < 1.0) return 0;
+        if (uz < half_pow_theta_) return 1;
+        return std::min<uint64_t>(items_ - 1, (uint64_t)(items_ * std::pow(eta_ * u - eta_ + 1, alpha_)));
     }
 
 private:
-    int n_;
-    double s_;
-    std::vector<double> cdf_;
-    std::mt19937 gen_{std::random_device{}()};
-    std::uniform_real_distribution<> dist_{0.0, 1.0};
-
-    void init() {
-        double sum = 0.0;
-        for (int i = 1; i <= n_; ++i) sum += 1.0 / std::pow(i, s_);
-        double norm = 0.0;
-        for (int i = 1; i <= n_; ++i) {
-            norm += 1.0 / std::pow(i, s_);
-            cdf_.push_back(norm / sum);
-        }
+    uint64_t items_;
+    double theta_, zetan_, alpha_, eta_, half_pow_theta_;
+
+    static double zeta(uint64_t n, double theta) {
+        double sum = 0;
+        for (uint64_t i = 1; i <= n; ++i) sum += 1.0 / std::pow((double)i, theta);
+        return sum;
     }
 };
 
-class KVStoreClient {
+class SizeGenerator {
 public:
-    KVStoreClient(std::shared_ptr<Channel> channel)
-        : stub_(KVStore::NewStub(channel)) {}
-
-    void Put(const std::string& key, const std::string& value) {
-        PutRequest request;
-        request.set_key(key);
-        request.set_value(value);
-        PutReply reply;
-        ClientContext context;
-        stub_->Put(&context, request, &reply);
-    }
-
-    bool Get(const std::string& key, std::string& value_out) {
-        GetRequest request;
-        request.set_key(key);
-        GetReply reply;
-        ClientContext context;
-        Status status = stub_->Get(&context, request, &reply);
-        if (status.ok() && reply.found()) {
-            value_out = reply.value();
-            return true;
+    SizeGenerator(const SizeDist& dist, double theta)
+        : dist_(dist), zipf_(dist.max - dist.min + 1, theta) {}
+
+    int next(std::mt19937_64& rng) const {
+        switch (dist_.kind) {
+            case SizeDist::FIXED: return dist_.min;
+            case SizeDist::UNIFORM: return std::uniform_int_distribution<int>(dist_.min, dist_.max)(rng);
+            default: return std::min(dist_.max, dist_.min + (int)zipf_.next(rng));
         }
-        return false;
     }
 
-    void PrintStats() {
-        Void req, res;
-        ClientContext ctx;
-        stub_->PrintStats(&ctx, req, &res);
+    // Sizes that must be reproducible for a given id (key lengths) are derived from its hash.
+    int for_id(uint64_t id) const {
+        if (dist_.kind == SizeDist::FIXED) return dist_.min;
+        std::mt19937_64 rng(fnv1a(id));
+        return next(rng);
     }
 
 private:
-    std::unique_ptr<KVStore::Stub> stub_;
+    SizeDist dist_;
+    ZipfianGenerator zipf_;
+};
+
+struct Generators {
+    const BenchConfig& config;
+    ZipfianGenerator zipf;
+    SizeGenerator key_size;
+    SizeGenerator value_size;
+    std::atomic<uint64_t> inserted;  // ids [0, inserted) exist
+
+    explicit Generators(const BenchConfig& c)
+        : config(c), zipf(c.records, c.zipf_theta), key_size(c.key_size, c.zipf_theta),
+          value_size(c.value_size, c.zipf_theta), inserted(c.records) {}
+
+    std::string key(uint64_t id) const {
+        std::string digits = std::to_string(id);
+        int len = key_size.for_id(id);
+        int pad = std::max<int>(0, len - 4 - (int)digits.size());
+        return "user" + std::string(pad, '0') + digits;
+    }
+
+    std::string value(std::mt19937_64& rng) const {
+        return std::string(value_size.next(rng), 'a' + rng() % 26);
+    }
+
+    uint64_t next_id(std::mt19937_64& rng) const {
+        uint64_t n = inserted.load(std::memory_order_relaxed);
+        switch (config.workload.dist) {
+            case KeyDist::UNIFORM:
+                return std::uniform_int_distribution<uint64_t>(0, n - 1)(rng);
+            case KeyDist::LATEST: {
+                uint64_t back = zipf.next(rng);
+                return back < n ? n - 1 - back : 0;
+            }
+            default:
+                // Scrambled so the hot keys are not all adjacent
+                return fnv1a(zipf.next(rng)) % std::min<uint64_t>(n, config.records);
+        }
+    }
+};
+
+/* RUN PHASE */
+struct ThreadStats {
+    LatencyHistogram latency[NUM_OPS];  // microseconds
+    uint64_t failed[NUM_OPS] = {};
 };
 
-void worker(KVStoreClient& client, ZipfGenerator& zipf, const std::string& blob, int ops_per_thread, std::atomic<int>& completed_ops) {
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_real_distribution<> op_dist(0.0, 1.0);
-
-    for (int i = 0; i < ops_per_thread; ++i) {
-        int key = zipf.next();
-        std::string key_str = "key" + std::to_string(key);
-        if (op_dist(rng) < PUT_RATIO) {
-            client.Put(key_str, blob);
-        } else {
-            std::string out;
-            client.Get(key_str, out);
+OpType choose_op(const Workload& w, std::mt19937_64& rng) {
+    double r = std::uniform_real_distribution<>(0.0, 1.0)(rng);
+    for (int op = 0; op < NUM_OPS; ++op) {
+        if (r < w.mix[op]) return (OpType)op;
+        r -= w.mix[op];
+    }
+    return OP_READ;
+}
+
+void worker(KVClient& client, Generators& gen, const BenchConfig& config, int tid,
+            uint64_t ops, Clock::time_point start, ThreadStats& stats) {
+    std::mt19937_64 rng(config.seed + tid);
+    // Each thread owns an equal share of the target rate, offset so they don't fire in lockstep
+    std::chrono::nanoseconds interval{0};
+    if (config.target_rate > 0) {
+        interval = std::chrono::nanoseconds((int64_t)(1e9 * config.threads / config.target_rate));
+        start += interval * tid / config.threads;
+    }
+
+    for (uint64_t i = 0; i < ops; ++i) {
+        Clock::time_point intended = Clock::now();
+        if (config.target_rate > 0) {
+            intended = start + interval * i;
+            std::this_thread::sleep_until(intended);
+        }
+
+        OpType op = choose_op(config.workload, rng);
+        bool ok = true;
+        switch (op) {
+            case OP_READ: {
+                std::string out;
+                client.Get(gen.key(gen.next_id(rng)), out);  // absent keys are not failures
+                break;
+            }
+            case OP_UPDATE:
+                ok = client.Put(gen.key(gen.next_id(rng)), gen.value(rng));
+                break;
+            case OP_INSERT:
+                ok = client.Put(gen.key(gen.inserted.fetch_add(1)), gen.value(rng));
+                break;
+            case OP_SCAN: {
+                uint64_t first = gen.next_id(rng);
+                int len = std::uniform_int_distribution<int>(1, config.scan_max)(rng);
+                std::vector<std::string> keys;
+                for (int k = 0; k < len; ++k) keys.push_back(gen.key(first + k));
+                client.MultiGet(keys);
+                break;
+            }
+            case OP_RMW: {
+                std::string key = gen.key(gen.next_id(rng)), out;
+                client.Get(key, out);
+                ok = client.Put(key, gen.value(rng));
+                break;
+            }
+            default: break;
         }
-        ++completed_ops;
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - intended).count();
+        stats.latency[op].record(micros);
+        if (!ok) ++stats.failed[op];
+    }
+}
+
+void load_phase(KVClient& client, Generators& gen, const BenchConfig& config) {
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    std::atomic<uint64_t> loaded{0};
+    for (int t = 0; t < config.threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937_64 rng(config.seed ^ (0x9e3779b97f4a7c15ull * (t + 1)));
+            std::vector<std::pair<std::string, std::string>> batch;
+            for (uint64_t id = t; id < config.records; id += config.threads) {
+                batch.emplace_back(gen.key(id), gen.value(rng));
+                if (batch.size() == 128) {
+                    loaded += client.MultiPut(batch);
+                    batch.clear();
+                }
+            }
+            loaded += client.MultiPut(batch);
+        });
     }
+    for (auto& t : threads) t.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "[Load] Inserted " << loaded.load() << "/" << config.records << " records in "
+              << seconds << " s (" << loaded.load() / seconds << " ops/sec)\n";
 }
 
-int main() {
-    std::string server_address = "localhost:50051";
-    KVStoreClient client(grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials()));
-    ZipfGenerator zipf(TOTAL_KEYS, 1.0);
-    std::string blob(BLOB_SIZE, 'X');
+/* REPORTING */
+void print_report(const BenchConfig& config, const ThreadStats& total, double seconds) {
+    uint64_t ops = 0;
+    for (int op = 0; op < NUM_OPS; ++op) ops += total.latency[op].count();
+    std::cout << "[Benchmark] Workload " << config.workload.name << ", " << config.threads << " threads, "
+              << (config.target_rate > 0 ? "open-loop" : "closed-loop") << "\n";
+    std::cout << "[Benchmark] Completed " << ops << " operations in " << seconds << " s\n";
+    std::cout << "[Benchmark] Throughput: " << ops / seconds << " ops/sec\n";
+    std::cout << std::left << std::setw(18) << "op" << std::right << std::setw(10) << "count"
+              << std::setw(10) << "failed" << std::setw(10) << "mean_us" << std::setw(10) << "p50"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(10) << "max" << "\n";
+    for (int op = 0; op < NUM_OPS; ++op) {
+        const LatencyHistogram& h = total.latency[op];
+        if (h.count() == 0) continue;
+        std::cout << std::left << std::setw(18) << OP_NAMES[op] << std::right << std::setw(10) << h.count()
+                  << std::setw(10) << total.failed[op] << std::setw(10) << (uint64_t)h.mean()
+                  << std::setw(10) << h.percentile(0.50) << std::setw(10) << h.percentile(0.99)
+                  << std::setw(10) << h.percentile(0.999) << std::setw(10) << h.max() << "\n";
+    }
+}
 
-    // Preload
-    for (int i = 0; i < PRELOAD_KEYS; ++i) {
-        client.Put("key" + std::to_string(i), blob);
+void write_json(const BenchConfig& config, const ThreadStats& total, double seconds,
+                uint64_t hedged_reads, std::ostream& out) {
+    uint64_t ops = 0;
+    for (int op = 0; op < NUM_OPS; ++op) ops += total.latency[op].count();
+    out << "{\n";
+    out << "  \"workload\": \"" << config.workload.name << "\",\n";
+    out << "  \"records\": " << config.records << ",\n";
+    out << "  \"operations\": " << config.operations << ",\n";
+    out << "  \"threads\": " << config.threads << ",\n";
+    out << "  \"target_rate\": " << config.target_rate << ",\n";
+    out << "  \"zipf_theta\": " << config.zipf_theta << ",\n";
+    out << "  \"seed\": " << config.seed << ",\n";
+    out << "  \"hedge_reads\": " << (config.client.hedge_reads ? "true" : "false") << ",\n";
+    out << "  \"hedged_reads\": " << hedged_reads << ",\n";
+    out << "  \"runtime_s\": " << seconds << ",\n";
+    out << "  \"throughput_ops\": " << ops / seconds << ",\n";
+    out << "  \"ops\": {";
+    bool first = true;
+    for (int op = 0; op < NUM_OPS; ++op) {
+        const LatencyHistogram& h = total.latency[op];
+        if (h.count() == 0) continue;
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "    \"" << OP_NAMES[op] << "\": {\"count\": " << h.count()
+            << ", \"failed\": " << total.failed[op]
+            << ", \"mean_us\": " << h.mean()
+            << ", \"p50_us\": " << h.percentile(0.50)
+            << ", \"p99_us\": " << h.percentile(0.99)
+            << ", \"p999_us\": " << h.percentile(0.999)
+            << ", \"max_us\": " << h.max() << "}";
     }
-    std::cout << "[Preload] Inserted " << PRELOAD_KEYS << " keys.\n";
+    out << "\n  }\n}\n";
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    parse_flags(argc, argv, config);
+    config.client.channels_per_endpoint = std::max(config.client.channels_per_endpoint, config.threads);
+
+    KVClient client(config.client);
+    Generators gen(config);
+
+    if (config.load) load_phase(client, gen, config);
 
     // Benchmark
-    std::atomic<int> completed_ops{0};
-    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::unique_ptr<ThreadStats>> stats;
     std::vector<std::thread> threads;
-    for (int i = 0; i < THREADS; ++i) {
-        threads.emplace_back(worker, std::ref(client), std::ref(zipf), std::ref(blob), TOTAL_OPS / THREADS, std::ref(completed_ops));
+    auto start = Clock::now();
+    for (int t = 0; t < config.threads; ++t) {
+        uint64_t ops = config.operations / config.threads + (t < (int)(config.operations % config.threads) ? 1 : 0);
+        stats.push_back(std::make_unique<ThreadStats>());
+        threads.emplace_back(worker, std::ref(client), std::ref(gen), std::cref(config), t, ops, start,
+                             std::ref(*stats.back()));
     }
     for (auto& t : threads) t.join();
-    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
 
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
-    double seconds = duration / 1e9;
-    double throughput = TOTAL_OPS / seconds;
-    double avg_latency_ns = duration / TOTAL_OPS;
+    ThreadStats total;
+    for (const auto& s : stats) {
+        for (int op = 0; op < NUM_OPS; ++op) {
+            total.latency[op].merge(s->latency[op]);
+            total.failed[op] += s->failed[op];
+        }
+    }
 
-    std::cout << "[Benchmark] Completed " << completed_ops.load() << " operations.\n";
-    std::cout << "[Benchmark] Throughput: " << throughput << " ops/sec\n";
-    std::cout << "[Benchmark] Avg Latency: " << avg_latency_ns << " ns/op\n";
+    print_report(config, total, seconds);
+    if (config.json_path == "-") {
+        write_json(config, total, seconds, client.hedged_reads(), std::cout);
+    } else if (!config.json_path.empty()) {
+        std::ofstream out(config.json_path);
+        write_json(config, total, seconds, client.hedged_reads(), out);
+        std::cout << "[Benchmark] Wrote " << config.json_path << "\n";
+    }
 
-    std::cout << "\n[Stats from Server]" << std::endl;
-    client.PrintStats();
+    kvstore::StatsReply server_stats;
+    if (client.GetStats(server_stats)) {
+        std::cout << "\n[Stats from Server]\n";
+        for (const auto& c : server_stats.counters()) {
+            std::cout << "  " << MetricsRegistry::display_name(c.name(), c.labels()) << " = " << c.value() << "\n";
+        }
+        for (const auto& h : server_stats.histograms()) {
+            if (h.count() == 0) continue;
+            std::cout << "  " << MetricsRegistry::display_name(h.name(), h.labels()) << " count=" << h.count()
+                      << " p50=" << h.p50() << "us p99=" << h.p99() << "us p99.9=" << h.p999()
+                      << "us max=" << h.max() << "us\n";
+        }
+        int shown = 0;
+        for (const auto& k : server_stats.hot_keys()) {
+            if (shown++ == 0) std::cout << "  hot keys:\n";
+            if (shown > 10) break;
+            std::cout << "    " << k.key() << " ~" << k.count() << " reads (+/-" << k.error() << ")"
+                      << (k.pinned() ? " [pinned]" : "") << "\n";
+        }
+    }
 
     return 0;
 }
@@ -0,0 +1,62 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Standard bloom filter over strings: no false negatives, false-positive rate close to
+// `fp_rate` while at most `expected_items` keys have been added. Keys cannot be removed,
+// so deleted keys keep answering "maybe" until the filter is rebuilt.
+class BloomFilter {
+public:
+    BloomFilter(size_t expected_items, double fp_rate) {
+        expected_items = std::max<size_t>(expected_items, 1);
+        double bits = -(double)expected_items * std::log(fp_rate) / (std::log(2.0) * std::log(2.0));
+        num_bits_ = std::max<uint64_t>(64, (uint64_t)bits);
+        num_hashes_ = std::max(1, (int)std::round(bits / expected_items * std::log(2.0)));
+        bits_.assign((num_bits_ + 63) / 64, 0);
+    }
+
+    void add(const std::string& key) {
+        uint64_t h1, h2;
+        hash(key, h1, h2);
+        for (int i = 0; i < num_hashes_; ++i) {
+            uint64_t bit = (h1 + i * h2) % num_bits_;
+            bits_[bit / 64] |= 1ull << (bit % 64);
+        }
+        ++items_;
+    }
+
+    bool may_contain(const std::string& key) const {
+        uint64_t h1, h2;
+        hash(key, h1, h2);
+        for (int i = 0; i < num_hashes_; ++i) {
+            uint64_t bit = (h1 + i * h2) % num_bits_;
+            if (!(bits_[bit / 64] & (1ull << (bit % 64)))) return false;
+        }
+        return true;
+    }
+
+    size_t items() const { return items_; }
+    uint64_t num_bits() const { return num_bits_; }
+    int num_hashes() const { return num_hashes_; }
+
+private:
+    std::vector<uint64_t> bits_;
+    uint64_t num_bits_;
+    int num_hashes_;
+    size_t items_ = 0;
+
+    // Kirsch-Mitzenmacher double hashing: k probes from two base hashes.
+    static void hash(const std::string& key, uint64_t& h1, uint64_t& h2) {
+        h1 = std::hash<std::string>{}(key);
+        h2 = 0xcbf29ce484222325ull;
+        for (unsigned char c : key) {
+            h2 ^= c;
+            h2 *= 0x100000001b3ull;
+        }
+        h2 |= 1; // odd stride so probes don't collapse when num_bits_ is even
+    }
+};
@@ -2,8 +2,14 @@
 #include <string>
 #include <optional>
 #include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "lru_cache.h"
 #include "lfu_cache.h"
+#include "bloom_filter.h"
+#include "metrics.h"
 
 enum class CachePolicy {
     LRU,
@@ -11,19 +17,44 @@ enum class CachePolicy {
 };
 
 class CacheController {
-    int hits_ = 0, misses_ = 0;
+    Counter& hits_;
+    Counter& misses_;
+    Counter& evictions_;
+    Counter& negative_hits_;
+    Counter& bloom_negatives_;
+    // Lookups the bloom filter let through that the DiskStore then missed: its false positives
+    // plus reads of deleted keys, which stay in the filter
+    Counter& bloom_passes_missed_;
 public:
-    CacheController(int capacity, CachePolicy policy = CachePolicy::LRU)
-        : policy_(policy), lru_(capacity), lfu_(capacity) {}
+    CacheController(int capacity, CachePolicy policy = CachePolicy::LRU, int negative_capacity = 0)
+        : hits_(MetricsRegistry::Get().counter("kv_cache_hits_total")),
+          misses_(MetricsRegistry::Get().counter("kv_cache_misses_total")),
+          evictions_(MetricsRegistry::Get().counter("kv_cache_evictions_total")),
+          negative_hits_(MetricsRegistry::Get().counter("kv_cache_negative_hits_total")),
+          bloom_negatives_(MetricsRegistry::Get().counter("kv_bloom_negatives_total")),
+          bloom_passes_missed_(MetricsRegistry::Get().counter("kv_bloom_passes_missed_total")),
+          policy_(policy), lru_(capacity), lfu_(capacity),
+          negative_capacity_(negative_capacity), negative_(std::max(negative_capacity, 1)) {}
+
+    // Track every key ever written in a bloom filter. Must be called before any put(),
+    // including WAL replay, or keys written earlier would read as absent.
+    void enable_bloom_filter(size_t expected_keys, double fp_rate = 0.01) {
+        bloom_ = std::make_unique<BloomFilter>(expected_keys, fp_rate);
+    }
 
     std::optional<std::string> get(const std::string& key) {
+        auto pin = pinned_.find(key);
+        if (pin != pinned_.end()) {
+            hits_.inc();
+            return pin->second;
+        }
         if (policy_ == CachePolicy::LRU) {
             auto val = lru_.get(key);
             if (val) {
-                hits_++;
+                hits_.inc();
                 std::cout<<"[CacheHit] LRU policy "<<key<<"\n";
             } else {
-                misses_++;
+                misses_.inc();
                 std::cout<<"[CacheMiss] LFU policy "<<key<<"\n";
             }
             return val;
@@ -31,26 +62,83 @@ public:
         else {
             auto val = lfu_.get(key);
             if (val) {
-                hits_++;
+                hits_.inc();
                 std::cout<<"[CacheHit] LFU policy "<<key<<"\n";
             } else {
-                misses_++;
+                misses_.inc();
                 std::cout<<"[CacheMiss] LFU policy "<<key<<"\n";
             }
             return val;
         }
     }
 
+    // True when the key is known not to exist: either a recent lookup missed in the
+    // DiskStore (negative cache) or the bloom filter has never seen it.
+    bool known_absent(const std::string& key) {
+        if (negative_capacity_ > 0 && negative_.exists(key)) {
+            negative_.get(key); // refresh recency
+            negative_hits_.inc();
+            return true;
+        }
+        if (bloom_ && !bloom_->may_contain(key)) {
+            bloom_negatives_.inc();
+            return true;
+        }
+        return false;
+    }
+
+    // The DiskStore confirmed the key is absent.
+    void put_absent(const std::string& key) {
+        if (bloom_) bloom_passes_missed_.inc();
+        if (negative_capacity_ > 0) negative_.put(key, "");
+    }
+
     void put(const std::string& key, const std::string& value) {
-        if (policy_ == CachePolicy::LRU) lru_.put(key, value);
-        else lfu_.put(key, value);
+        if (negative_capacity_ > 0) negative_.remove(key);
+        if (bloom_) bloom_->add(key);
+        auto pin = pinned_.find(key);
+        if (pin != pinned_.end()) {
+            pin->second = value;
+            return;
+        }
+        bool evicted = policy_ == CachePolicy::LRU ? lru_.put(key, value) : lfu_.put(key, value);
+        if (evicted) evictions_.inc();
     }
 
     void remove(const std::string& key) {
+        pinned_.erase(key);
         if (policy_ == CachePolicy::LRU) lru_.remove(key);
         else lfu_.remove(key);
+        if (negative_capacity_ > 0) negative_.put(key, "");
+    }
+
+    // Keep `keys` resident outside the replacement policy so a scan cannot evict them.
+    // Keys dropping out of the list go back to the regular cache; keys not cached right
+    // now are picked up by a later call once a read has loaded them.
+    void set_pinned(const std::vector<std::string>& keys) {
+        std::unordered_set<std::string> wanted(keys.begin(), keys.end());
+        for (auto it = pinned_.begin(); it != pinned_.end();) {
+            if (wanted.count(it->first)) {
+                ++it;
+                continue;
+            }
+            bool evicted = policy_ == CachePolicy::LRU ? lru_.put(it->first, it->second)
+                                                       : lfu_.put(it->first, it->second);
+            if (evicted) evictions_.inc();
+            it = pinned_.erase(it);
+        }
+        for (const std::string& key : keys) {
+            if (pinned_.count(key)) continue;
+            auto val = policy_ == CachePolicy::LRU ? lru_.get(key) : lfu_.get(key);
+            if (!val) continue;
+            if (policy_ == CachePolicy::LRU) lru_.remove(key);
+            else lfu_.remove(key);
+            pinned_.emplace(key, *val);
+        }
     }
 
+    bool is_pinned(const std::string& key) const { return pinned_.count(key) > 0; }
+
     void print_stats() const {
         std::cout<<"--------------Cache Stats---------------\n";
         std::cout << "[CacheController] Using ";
@@ -59,12 +147,20 @@ public:
         } else {
             std::cout << "LFU:\n";
         }
-        int total_gets = hits_ + misses_;
+        uint64_t total_gets = hits_.value() + misses_.value();
         std::cout<<"Total GETs: "<<total_gets<<"\n";
-        std::cout<<"Cache Hits: "<<hits_<<"\n";
-        std::cout<<"Cache Misses: "<<misses_<<"\n";
+        std::cout<<"Cache Hits: "<<hits_.value()<<"\n";
+        std::cout<<"Cache Misses: "<<misses_.value()<<"\n";
+        std::cout<<"Evictions: "<<evictions_.value()<<"\n";
+        std::cout<<"Negative Cache Hits: "<<negative_hits_.value()<<"\n";
+        std::cout<<"Pinned Keys: "<<pinned_.size()<<"\n";
+        if (bloom_) {
+            std::cout<<"Bloom Filter: "<<bloom_->items()<<" keys, "<<bloom_->num_bits()<<" bits, "
+                     <<bloom_->num_hashes()<<" hashes, "<<bloom_negatives_.value()<<" negatives, "
+                     <<bloom_passes_missed_.value()<<" passes missed\n";
+        }
         if (total_gets != 0) {
-            double hit_rate = 100.0 * hits_ / total_gets;
+            double hit_rate = 100.0 * hits_.value() / total_gets;
             std::cout<<"Hit Rate: "<<hit_rate<<"%\n";
         }
     }
@@ -73,4 +169,8 @@ private:
     CachePolicy policy_;
     LRUCache lru_;
     LFUCache lfu_;
+    int negative_capacity_;
+    LRUCache negative_;  // keys recently confirmed absent, used as a set
+    std::unique_ptr<BloomFilter> bloom_;
+    std::unordered_map<std::string, std::string> pinned_; // hot keys exempt from eviction
 };
@@ -3,7 +3,10 @@
 #include <rocksdb/db.h>
 #include <iostream>
 
-DiskStore::DiskStore(const std::string& db_path) {
+DiskStore::DiskStore(const std::string& db_path)
+    : get_latency_(MetricsRegistry::Get().histogram("kv_rocksdb_latency_us", "op=\"get\"")),
+      put_latency_(MetricsRegistry::Get().histogram("kv_rocksdb_latency_us", "op=\"put\"")),
+      delete_latency_(MetricsRegistry::Get().histogram("kv_rocksdb_latency_us", "op=\"delete\"")) {
     rocksdb::Options options;
     options.create_if_missing = true;
     rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db_);
@@ -19,18 +22,21 @@ DiskStore::~DiskStore() {
 
 bool DiskStore::put(const std::string& key, const std::string& value) {
     if (!db_) return false;
+    ScopedTimer timer(put_latency_);
     rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
     return status.ok();
 }
 
 bool DiskStore::get(const std::string& key, std::string& value_out) {
     if (!db_) return false;
+    ScopedTimer timer(get_latency_);
     rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &value_out);
     return status.ok();
 }
 
 bool DiskStore::remove(const std::string& key) {
     if (!db_) return false;
+    ScopedTimer timer(delete_latency_);
     rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), key);
     return status.ok();
 }
@@ -3,10 +3,14 @@
 #include <string>
 #include <optional>
 #include <cassert>
+#include "metrics.h"
 
 class DiskStore {
     rocksdb::DB* db_;
     rocksdb::Options options_;
+    LatencyHistogram& get_latency_;
+    LatencyHistogram& put_latency_;
+    LatencyHistogram& delete_latency_;
 public:
     explicit DiskStore(const std::string& path);
     bool put(const std::string& key, const std::string &value);
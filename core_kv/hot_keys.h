@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+struct HotKey {
+    std::string key;
+    uint64_t count;  // estimated accesses, never an underestimate
+    uint64_t error;  // count may overestimate by at most this much
+};
+
+// Space-Saving top-K sketch (Metwally et al.): tracks at most `capacity` keys; a new key
+// replaces the least counted one and inherits its count as error bound. Any key with true
+// frequency above N/capacity is guaranteed to be tracked. Not thread-safe.
+class HotKeyTracker {
+public:
+    explicit HotKeyTracker(size_t capacity) : capacity_(capacity) {}
+
+    void record(const std::string& key) {
+        if (capacity_ == 0) return;
+        auto it = counts_.find(key);
+        if (it != counts_.end()) {
+            order_.erase({it->second.first, key});
+            ++it->second.first;
+            order_.insert({it->second.first, key});
+            return;
+        }
+        uint64_t base = 0;
+        if (counts_.size() == capacity_) {
+            auto victim = order_.begin();
+            base = victim->first;
+            counts_.erase(victim->second);
+            order_.erase(victim);
+        }
+        counts_[key] = {base + 1, base};
+        order_.insert({base + 1, key});
+    }
+
+    std::vector<HotKey> top(size_t n) const {
+        std::vector<HotKey> out;
+        for (auto it = order_.rbegin(); it != order_.rend() && out.size() < n; ++it) {
+            out.push_back({it->second, it->first, counts_.at(it->second).second});
+        }
+        return out;
+    }
+
+private:
+    size_t capacity_;
+    std::unordered_map<std::string, std::pair<uint64_t, uint64_t>> counts_; // key -> (count, error)
+    std::set<std::pair<uint64_t, std::string>> order_;                    // (count, key)
+};
@@ -0,0 +1,324 @@
+#include "kv_client.h"
+#include <algorithm>
+#include <chrono>
+
+using grpc::ClientContext;
+using grpc::CompletionQueue;
+using grpc::Status;
+using kvstore::KVStore;
+using kvstore::PutRequest;
+using kvstore::PutReply;
+using kvstore::GetRequest;
+using kvstore::GetReply;
+using kvstore::DeleteRequest;
+using kvstore::DeleteReply;
+using kvstore::Void;
+using kvstore::StatsRequest;
+using kvstore::StatsReply;
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t micros_since(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+/* LATENCY TRACKER */
+void LatencyTracker::record(int64_t micros) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_[next_] = micros;
+    next_ = (next_ + 1) % samples_.size();
+    if (count_ < samples_.size()) ++count_;
+}
+
+int64_t LatencyTracker::percentile(double p) {
+    std::vector<int64_t> window;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Too few samples to say anything about the tail yet
+        if (count_ < samples_.size() / 8) return 0;
+        window.assign(samples_.begin(), samples_.begin() + count_);
+    }
+    size_t idx = std::min(window.size() - 1, (size_t)(p * window.size()));
+    std::nth_element(window.begin(), window.begin() + idx, window.end());
+    return window[idx];
+}
+
+/* CONNECTION POOL */
+KVClient::KVClient(const KVClientOptions& options) : options_(options) {
+    if (options_.channels_per_endpoint < 1) options_.channels_per_endpoint = 1;
+    for (const std::string& addr : options_.endpoints) addEndpoint(addr);
+    if (endpoints_.empty()) addEndpoint("localhost:50051");
+}
+
+int KVClient::addEndpoint(const std::string& address) {
+    std::lock_guard<std::mutex> lock(endpoints_mutex_);
+    for (size_t i = 0; i < endpoints_.size(); ++i) {
+        if (endpoints_[i]->address == address) return i;
+    }
+    auto ep = std::make_unique<Endpoint>();
+    ep->address = address;
+    for (int i = 0; i < options_.channels_per_endpoint; ++i) {
+        // Without a local subchannel pool gRPC would collapse identical channels onto one connection
+        grpc::ChannelArguments args;
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        ep->stubs.emplace_back(KVStore::NewStub(
+            grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args)));
+    }
+    endpoints_.push_back(std::move(ep));
+    return endpoints_.size() - 1;
+}
+
+int KVClient::endpointCount() const {
+    std::lock_guard<std::mutex> lock(endpoints_mutex_);
+    return endpoints_.size();
+}
+
+KVStore::Stub* KVClient::stub(int endpoint) {
+    Endpoint* ep;
+    {
+        std::lock_guard<std::mutex> lock(endpoints_mutex_);
+        ep = endpoints_[endpoint].get();
+    }
+    return ep->stubs[ep->next.fetch_add(1, std::memory_order_relaxed) % ep->stubs.size()].get();
+}
+
+std::string KVClient::leader() const {
+    std::lock_guard<std::mutex> lock(endpoints_mutex_);
+    return endpoints_[leader_.load()]->address;
+}
+
+void KVClient::setDeadline(ClientContext& ctx) const {
+    if (options_.rpc_timeout_ms > 0) {
+        ctx.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(options_.rpc_timeout_ms));
+    }
+}
+
+/* WRITES: leader routing */
+// call(stub, ctx, reply) issues one attempt. A follower answers with success=false and a
+// leader_hint; an unreachable node makes us try the next one, which will redirect if needed.
+template <typename Reply, typename Call>
+bool KVClient::writeWithRedirect(Call call) {
+    int target = leader_.load();
+    for (int attempt = 0; attempt <= options_.max_redirects; ++attempt) {
+        Reply reply;
+        ClientContext ctx;
+        setDeadline(ctx);
+        Status status = call(stub(target), &ctx, &reply);
+        if (!status.ok()) {
+            if (status.error_code() != grpc::StatusCode::UNAVAILABLE) return false;
+            target = (target + 1) % endpointCount();
+            continue;
+        }
+        if (reply.success()) {
+            leader_.store(target);
+            return true;
+        }
+        if (reply.leader_hint().empty()) return false;
+        target = addEndpoint(reply.leader_hint());
+        ++redirects_;
+    }
+    return false;
+}
+
+bool KVClient::Put(const std::string& key, const std::string& value) {
+    PutRequest req;
+    req.set_key(key);
+    req.set_value(value);
+    return writeWithRedirect<PutReply>([&](KVStore::Stub* s, ClientContext* ctx, PutReply* rep) {
+        return s->Put(ctx, req, rep);
+    });
+}
+
+bool KVClient::Delete(const std::string& key) {
+    DeleteRequest req;
+    req.set_key(key);
+    return writeWithRedirect<DeleteReply>([&](KVStore::Stub* s, ClientContext* ctx, DeleteReply* rep) {
+        return s->Delete(ctx, req, rep);
+    });
+}
+
+/* READS: optional hedging */
+bool KVClient::Get(const std::string& key, std::string& value_out) {
+    GetRequest req;
+    req.set_key(key);
+    GetReply reply;
+
+    int primary = leader_.load();
+    bool ok = (options_.hedge_reads && endpointCount() > 1)
+        ? getHedged(primary, req, reply)
+        : getOnce(primary, req, reply);
+    if (ok && reply.found()) {
+        value_out = reply.value();
+        return true;
+    }
+    return false;
+}
+
+bool KVClient::getOnce(int endpoint, const GetRequest& req, GetReply& reply) {
+    ClientContext ctx;
+    setDeadline(ctx);
+    auto start = Clock::now();
+    Status status = stub(endpoint)->Get(&ctx, req, &reply);
+    if (status.ok()) get_latency_.record(micros_since(start));
+    return status.ok();
+}
+
+namespace {
+struct AsyncGet {
+    ClientContext ctx;
+    GetReply reply;
+    Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<GetReply>> rpc;
+};
+}
+
+// Send to the primary; if it has not answered within the tracked percentile, send the same Get
+// to another node and take whichever reply arrives first. Follower reads may be slightly stale.
+bool KVClient::getHedged(int primary, const GetRequest& req, GetReply& reply) {
+    int n = endpointCount();
+    int backup = (primary + 1 + hedged_reads_.load() % (n - 1)) % n;
+    int64_t delay_us = std::max<int64_t>(options_.hedge_min_delay_us,
+                                         get_latency_.percentile(options_.hedge_percentile));
+
+    CompletionQueue cq;
+    AsyncGet calls[2];
+    int targets[2] = {primary, backup};
+    auto launch = [&](int i) {
+        setDeadline(calls[i].ctx);
+        calls[i].rpc = stub(targets[i])->AsyncGet(&calls[i].ctx, req, &cq);
+        calls[i].rpc->Finish(&calls[i].reply, &calls[i].status, (void*)(intptr_t)i);
+    };
+
+    auto start = Clock::now();
+    // gRPC deadlines only accept system_clock
+    auto hedge_at = std::chrono::system_clock::now() + std::chrono::microseconds(delay_us);
+    launch(0);
+    int outstanding = 1;
+    bool hedged = false;
+    int winner = -1;
+    while (outstanding > 0) {
+        void* tag;
+        bool ok;
+        if (!hedged) {
+            auto st = cq.AsyncNext(&tag, &ok, hedge_at);
+            if (st == CompletionQueue::SHUTDOWN) break;
+            if (st == CompletionQueue::TIMEOUT) {
+                launch(1);
+                hedged = true;
+                ++outstanding;
+                ++hedged_reads_;
+                continue;
+            }
+        } else if (!cq.Next(&tag, &ok)) {
+            break;
+        }
+        --outstanding;
+        int idx = (int)(intptr_t)tag;
+        if (winner >= 0) continue; // the loser finishing (usually CANCELLED)
+        if (calls[idx].status.ok()) {
+            winner = idx;
+            if (outstanding > 0) calls[1 - idx].ctx.TryCancel();
+        } else if (!hedged) {
+            // Primary failed outright: no point waiting for the timer
+            launch(1);
+            hedged = true;
+            ++outstanding;
+            ++hedged_reads_;
+        }
+    }
+    cq.Shutdown();
+    void* tag;
+    bool ok;
+    while (cq.Next(&tag, &ok)) {}
+
+    if (winner < 0) return false;
+    get_latency_.record(micros_since(start));
+    reply = std::move(calls[winner].reply);
+    return true;
+}
+
+/* PIPELINED BATCHES */
+std::vector<std::optional<std::string>> KVClient::MultiGet(const std::vector<std::string>& keys) {
+    std::vector<std::optional<std::string>> out(keys.size());
+    if (keys.empty()) return out;
+
+    CompletionQueue cq;
+    std::vector<AsyncGet> calls(keys.size());
+    int target = leader_.load();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        GetRequest req;
+        req.set_key(keys[i]);
+        setDeadline(calls[i].ctx);
+        calls[i].rpc = stub(target)->AsyncGet(&calls[i].ctx, req, &cq);
+        calls[i].rpc->Finish(&calls[i].reply, &calls[i].status, (void*)i);
+    }
+    for (size_t done = 0; done < keys.size(); ++done) {
+        void* tag;
+        bool ok;
+        if (!cq.Next(&tag, &ok)) break;
+        AsyncGet& call = calls[(size_t)tag];
+        if (call.status.ok() && call.reply.found()) out[(size_t)tag] = call.reply.value();
+    }
+    cq.Shutdown();
+    void* tag;
+    bool ok;
+    while (cq.Next(&tag, &ok)) {}
+    return out;
+}
+
+size_t KVClient::MultiPut(const std::vector<std::pair<std::string, std::string>>& kvs) {
+    struct AsyncPut {
+        ClientContext ctx;
+        PutReply reply;
+        Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<PutReply>> rpc;
+    };
+    if (kvs.empty()) return 0;
+
+    CompletionQueue cq;
+    std::vector<AsyncPut> calls(kvs.size());
+    int target = leader_.load();
+    for (size_t i = 0; i < kvs.size(); ++i) {
+        PutRequest req;
+        req.set_key(kvs[i].first);
+        req.set_value(kvs[i].second);
+        setDeadline(calls[i].ctx);
+        calls[i].rpc = stub(target)->AsyncPut(&calls[i].ctx, req, &cq);
+        calls[i].rpc->Finish(&calls[i].reply, &calls[i].status, (void*)i);
+    }
+    size_t succeeded = 0;
+    std::vector<size_t> retry;
+    for (size_t done = 0; done < kvs.size(); ++done) {
+        void* tag;
+        bool ok;
+        if (!cq.Next(&tag, &ok)) break;
+        AsyncPut& call = calls[(size_t)tag];
+        if (call.status.ok() && call.reply.success()) ++succeeded;
+        else retry.push_back((size_t)tag);
+    }
+    cq.Shutdown();
+    void* tag;
+    bool ok;
+    while (cq.Next(&tag, &ok)) {}
+
+    // Stragglers (e.g. we were talking to a follower) go through the redirecting path
+    for (size_t i : retry) {
+        if (Put(kvs[i].first, kvs[i].second)) ++succeeded;
+    }
+    return succeeded;
+}
+
+void KVClient::PrintStats() {
+    Void req, res;
+    ClientContext ctx;
+    setDeadline(ctx);
+    stub(leader_.load())->PrintStats(&ctx, req, &res);
+}
+
+bool KVClient::GetStats(StatsReply& out, bool prometheus_text) {
+    StatsRequest req;
+    req.set_prometheus_text(prometheus_text);
+    ClientContext ctx;
+    setDeadline(ctx);
+    return stub(leader_.load())->GetStats(&ctx, req, &out).ok();
+}
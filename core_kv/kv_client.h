@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+#include "kvstore.grpc.pb.h"
+
+struct KVClientOptions {
+    std::vector<std::string> endpoints;  // seed nodes; the first one is treated as leader until told otherwise
+    int channels_per_endpoint = 4;       // independent connections per node, picked round-robin
+    int max_redirects = 3;               // leader_hint hops a write may follow before failing
+    int rpc_timeout_ms = 1000;           // per-attempt deadline, 0 disables it
+    bool hedge_reads = false;            // send a backup Get to another node when the first one is slow
+    double hedge_percentile = 0.95;      // ...slow meaning slower than this percentile of recent Gets
+    int hedge_min_delay_us = 500;        // never hedge earlier than this, even with a fast history
+};
+
+// Sliding window of recent Get latencies used to pick the hedging delay.
+class LatencyTracker {
+public:
+    explicit LatencyTracker(size_t window = 1024) : samples_(window, 0) {}
+
+    void record(int64_t micros);
+    // Latency at percentile p of the current window, or 0 while it is still filling.
+    int64_t percentile(double p);
+
+private:
+    std::mutex mutex_;
+    std::vector<int64_t> samples_;
+    size_t next_ = 0;
+    size_t count_ = 0;
+};
+
+// Thread-safe client for the KVStore service. Spreads calls over a pool of channels,
+// follows leader_hint redirects for writes and can hedge reads to followers.
+class KVClient {
+public:
+    explicit KVClient(const KVClientOptions& options);
+
+    bool Put(const std::string& key, const std::string& value);
+    bool Get(const std::string& key, std::string& value_out);
+    bool Delete(const std::string& key);
+
+    // Pipelined variants: every request is in flight at once over the pool.
+    std::vector<std::optional<std::string>> MultiGet(const std::vector<std::string>& keys);
+    size_t MultiPut(const std::vector<std::pair<std::string, std::string>>& kvs);
+
+    void PrintStats();
+    bool GetStats(kvstore::StatsReply& out, bool prometheus_text = false);
+
+    std::string leader() const;
+    uint64_t hedged_reads() const { return hedged_reads_.load(); }
+    // leader_hint redirects followed by writes; the library does not log them itself
+    uint64_t redirects() const { return redirects_.load(); }
+
+private:
+    struct Endpoint {
+        std::string address;
+        std::vector<std::unique_ptr<kvstore::KVStore::Stub>> stubs;
+        std::atomic<uint64_t> next{0};
+    };
+
+    KVClientOptions options_;
+    mutable std::mutex endpoints_mutex_; // guards growth of endpoints_ when a new leader is learned
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+    std::atomic<int> leader_{0};
+    std::atomic<uint64_t> hedged_reads_{0};
+    std::atomic<uint64_t> redirects_{0};
+    LatencyTracker get_latency_;
+
+    int addEndpoint(const std::string& address);
+    int endpointCount() const;
+    kvstore::KVStore::Stub* stub(int endpoint);
+    void setDeadline(grpc::ClientContext& ctx) const;
+    bool getOnce(int endpoint, const kvstore::GetRequest& req, kvstore::GetReply& reply);
+    bool getHedged(int primary, const kvstore::GetRequest& req, kvstore::GetReply& reply);
+
+    template <typename Reply, typename Call>
+    bool writeWithRedirect(Call call);
+};
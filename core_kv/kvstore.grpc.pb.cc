@@ -26,6 +26,7 @@ static const char* KVStore_method_names[] = {
   "/kvstore.KVStore/Get",
   "/kvstore.KVStore/Delete",
   "/kvstore.KVStore/PrintStats",
+  "/kvstore.KVStore/GetStats",
 };
 
 std::unique_ptr< KVStore::Stub> KVStore::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -39,6 +40,7 @@ KVStore::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, c
   , rpcmethod_Get_(KVStore_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Delete_(KVStore_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_PrintStats_(KVStore_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetStats_(KVStore_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status KVStore::Stub::Put(::grpc::ClientContext* context, const ::kvstore::PutRequest& request, ::kvstore::PutReply* response) {
@@ -133,6 +135,29 @@ void KVStore::Stub::async::PrintStats(::grpc::ClientContext* context, const ::kv
   return result;
 }
 
+::grpc::Status KVStore::Stub::GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::kvstore::StatsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::kvstore::StatsRequest, ::kvstore::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void KVStore::Stub::async::GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::kvstore::StatsRequest, ::kvstore::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void KVStore::Stub::async::GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>* KVStore::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::kvstore::StatsReply, ::kvstore::StatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>* KVStore::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 KVStore::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       KVStore_method_names[0],
@@ -174,6 +199,16 @@ KVStore::Service::Service() {
              ::kvstore::Void* resp) {
                return service->PrintStats(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KVStore_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KVStore::Service, ::kvstore::StatsRequest, ::kvstore::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KVStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::kvstore::StatsRequest* req,
+             ::kvstore::StatsReply* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
 }
 
 KVStore::Service::~Service() {
@@ -207,6 +242,13 @@ KVStore::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status KVStore::Service::GetStats(::grpc::ServerContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace kvstore
 
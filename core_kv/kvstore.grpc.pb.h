@@ -63,6 +63,13 @@ class KVStore final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::Void>> PrepareAsyncPrintStats(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::Void>>(PrepareAsyncPrintStatsRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::kvstore::StatsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>> AsyncGetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -74,6 +81,8 @@ class KVStore final {
       virtual void Delete(::grpc::ClientContext* context, const ::kvstore::DeleteRequest* request, ::kvstore::DeleteReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void PrintStats(::grpc::ClientContext* context, const ::kvstore::Void* request, ::kvstore::Void* response, std::function<void(::grpc::Status)>) = 0;
       virtual void PrintStats(::grpc::ClientContext* context, const ::kvstore::Void* request, ::kvstore::Void* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -87,6 +96,8 @@ class KVStore final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::DeleteReply>* PrepareAsyncDeleteRaw(::grpc::ClientContext* context, const ::kvstore::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::Void>* AsyncPrintStatsRaw(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::Void>* PrepareAsyncPrintStatsRaw(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kvstore::StatsReply>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -119,6 +130,13 @@ class KVStore final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::Void>> PrepareAsyncPrintStats(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::Void>>(PrepareAsyncPrintStatsRaw(context, request, cq));
     }
+    ::grpc::Status GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::kvstore::StatsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>> AsyncGetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -130,6 +148,8 @@ class KVStore final {
       void Delete(::grpc::ClientContext* context, const ::kvstore::DeleteRequest* request, ::kvstore::DeleteReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void PrintStats(::grpc::ClientContext* context, const ::kvstore::Void* request, ::kvstore::Void* response, std::function<void(::grpc::Status)>) override;
       void PrintStats(::grpc::ClientContext* context, const ::kvstore::Void* request, ::kvstore::Void* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, std::function<void(::grpc::Status)>) override;
+      void GetStats(::grpc::ClientContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -149,10 +169,13 @@ class KVStore final {
     ::grpc::ClientAsyncResponseReader< ::kvstore::DeleteReply>* PrepareAsyncDeleteRaw(::grpc::ClientContext* context, const ::kvstore::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::kvstore::Void>* AsyncPrintStatsRaw(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::kvstore::Void>* PrepareAsyncPrintStatsRaw(::grpc::ClientContext* context, const ::kvstore::Void& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kvstore::StatsReply>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::kvstore::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Put_;
     const ::grpc::internal::RpcMethod rpcmethod_Get_;
     const ::grpc::internal::RpcMethod rpcmethod_Delete_;
     const ::grpc::internal::RpcMethod rpcmethod_PrintStats_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetStats_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -164,6 +187,7 @@ class KVStore final {
     virtual ::grpc::Status Get(::grpc::ServerContext* context, const ::kvstore::GetRequest* request, ::kvstore::GetReply* response);
     virtual ::grpc::Status Delete(::grpc::ServerContext* context, const ::kvstore::DeleteRequest* request, ::kvstore::DeleteReply* response);
     virtual ::grpc::Status PrintStats(::grpc::ServerContext* context, const ::kvstore::Void* request, ::kvstore::Void* response);
+    virtual ::grpc::Status GetStats(::grpc::ServerContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Put : public BaseClass {
@@ -245,7 +269,27 @@ class KVStore final {
       ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Put<WithAsyncMethod_Get<WithAsyncMethod_Delete<WithAsyncMethod_PrintStats<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetStats() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::kvstore::StatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::kvstore::StatsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Put<WithAsyncMethod_Get<WithAsyncMethod_Delete<WithAsyncMethod_PrintStats<WithAsyncMethod_GetStats<Service > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Put : public BaseClass {
    private:
@@ -354,7 +398,34 @@ class KVStore final {
     virtual ::grpc::ServerUnaryReactor* PrintStats(
       ::grpc::CallbackServerContext* /*context*/, const ::kvstore::Void* /*request*/, ::kvstore::Void* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Put<WithCallbackMethod_Get<WithCallbackMethod_Delete<WithCallbackMethod_PrintStats<Service > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::kvstore::StatsRequest, ::kvstore::StatsReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::kvstore::StatsRequest* request, ::kvstore::StatsReply* response) { return this->GetStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetStats(
+        ::grpc::MessageAllocator< ::kvstore::StatsRequest, ::kvstore::StatsReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::kvstore::StatsRequest, ::kvstore::StatsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Put<WithCallbackMethod_Get<WithCallbackMethod_Delete<WithCallbackMethod_PrintStats<WithCallbackMethod_GetStats<Service > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Put : public BaseClass {
@@ -425,6 +496,23 @@ class KVStore final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetStats() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Put : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -505,6 +593,26 @@ class KVStore final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetStats() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Put : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -593,6 +701,28 @@ class KVStore final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Put : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -700,9 +830,36 @@ class KVStore final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedPrintStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kvstore::Void,::kvstore::Void>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_Delete<WithStreamedUnaryMethod_PrintStats<Service > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetStats() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::kvstore::StatsRequest, ::kvstore::StatsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::kvstore::StatsRequest, ::kvstore::StatsReply>* streamer) {
+                       return this->StreamedGetStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::kvstore::StatsRequest* /*request*/, ::kvstore::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kvstore::StatsRequest,::kvstore::StatsReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_Delete<WithStreamedUnaryMethod_PrintStats<WithStreamedUnaryMethod_GetStats<Service > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_Delete<WithStreamedUnaryMethod_PrintStats<Service > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_Delete<WithStreamedUnaryMethod_PrintStats<WithStreamedUnaryMethod_GetStats<Service > > > > > StreamedService;
 };
 
 }  // namespace kvstore
@@ -48,7 +48,8 @@ struct PutRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutRequestDefaultTypeInternal _PutRequest_default_instance_;
 PROTOBUF_CONSTEXPR PutReply::PutReply(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.success_)*/false
+    /*decltype(_impl_.leader_hint_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct PutReplyDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PutReplyDefaultTypeInternal()
@@ -101,7 +102,8 @@ struct DeleteRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
 PROTOBUF_CONSTEXPR DeleteReply::DeleteReply(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.success_)*/false
+    /*decltype(_impl_.leader_hint_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct DeleteReplyDefaultTypeInternal {
   PROTOBUF_CONSTEXPR DeleteReplyDefaultTypeInternal()
@@ -112,8 +114,90 @@ struct DeleteReplyDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prometheus_text_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR MetricValue::MetricValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.labels_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricValueDefaultTypeInternal() {}
+  union {
+    MetricValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+PROTOBUF_CONSTEXPR HistogramValue::HistogramValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.labels_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.p50_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HistogramValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistogramValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistogramValueDefaultTypeInternal() {}
+  union {
+    HistogramValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistogramValueDefaultTypeInternal _HistogramValue_default_instance_;
+PROTOBUF_CONSTEXPR HotKey::HotKey(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.error_)*/uint64_t{0u}
+  , /*decltype(_impl_.pinned_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HotKeyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HotKeyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HotKeyDefaultTypeInternal() {}
+  union {
+    HotKey _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HotKeyDefaultTypeInternal _HotKey_default_instance_;
+PROTOBUF_CONSTEXPR StatsReply::StatsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.counters_)*/{}
+  , /*decltype(_impl_.gauges_)*/{}
+  , /*decltype(_impl_.histograms_)*/{}
+  , /*decltype(_impl_.hot_keys_)*/{}
+  , /*decltype(_impl_.prometheus_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsReplyDefaultTypeInternal() {}
+  union {
+    StatsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsReplyDefaultTypeInternal _StatsReply_default_instance_;
 }  // namespace kvstore
-static ::_pb::Metadata file_level_metadata_kvstore_2eproto[7];
+static ::_pb::Metadata file_level_metadata_kvstore_2eproto[12];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_kvstore_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kvstore_2eproto = nullptr;
 
@@ -139,6 +223,7 @@ const uint32_t TableStruct_kvstore_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::kvstore::PutReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::PutReply, _impl_.leader_hint_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kvstore::GetRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -168,15 +253,73 @@ const uint32_t TableStruct_kvstore_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::kvstore::DeleteReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::DeleteReply, _impl_.leader_hint_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsRequest, _impl_.prometheus_text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvstore::MetricValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvstore::MetricValue, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::MetricValue, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::MetricValue, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.p99_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.p999_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HistogramValue, _impl_.max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvstore::HotKey, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvstore::HotKey, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HotKey, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HotKey, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::HotKey, _impl_.pinned_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _impl_.counters_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _impl_.gauges_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _impl_.histograms_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _impl_.prometheus_text_),
+  PROTOBUF_FIELD_OFFSET(::kvstore::StatsReply, _impl_.hot_keys_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::kvstore::Void)},
   { 6, -1, -1, sizeof(::kvstore::PutRequest)},
   { 14, -1, -1, sizeof(::kvstore::PutReply)},
-  { 21, -1, -1, sizeof(::kvstore::GetRequest)},
-  { 28, -1, -1, sizeof(::kvstore::GetReply)},
-  { 36, -1, -1, sizeof(::kvstore::DeleteRequest)},
-  { 43, -1, -1, sizeof(::kvstore::DeleteReply)},
+  { 22, -1, -1, sizeof(::kvstore::GetRequest)},
+  { 29, -1, -1, sizeof(::kvstore::GetReply)},
+  { 37, -1, -1, sizeof(::kvstore::DeleteRequest)},
+  { 44, -1, -1, sizeof(::kvstore::DeleteReply)},
+  { 52, -1, -1, sizeof(::kvstore::StatsRequest)},
+  { 59, -1, -1, sizeof(::kvstore::MetricValue)},
+  { 68, -1, -1, sizeof(::kvstore::HistogramValue)},
+  { 83, -1, -1, sizeof(::kvstore::HotKey)},
+  { 93, -1, -1, sizeof(::kvstore::StatsReply)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -187,27 +330,47 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::kvstore::_GetReply_default_instance_._instance,
   &::kvstore::_DeleteRequest_default_instance_._instance,
   &::kvstore::_DeleteReply_default_instance_._instance,
+  &::kvstore::_StatsRequest_default_instance_._instance,
+  &::kvstore::_MetricValue_default_instance_._instance,
+  &::kvstore::_HistogramValue_default_instance_._instance,
+  &::kvstore::_HotKey_default_instance_._instance,
+  &::kvstore::_StatsReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_kvstore_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\rkvstore.proto\022\007kvstore\"\006\n\004Void\"(\n\nPutR"
-  "equest\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"\033\n\010Pu"
-  "tReply\022\017\n\007success\030\001 \001(\010\"\031\n\nGetRequest\022\013\n"
-  "\003key\030\001 \001(\t\"(\n\010GetReply\022\r\n\005found\030\001 \001(\010\022\r\n"
-  "\005value\030\002 \001(\t\"\034\n\rDeleteRequest\022\013\n\003key\030\001 \001"
-  "(\t\"\036\n\013DeleteReply\022\017\n\007success\030\001 \001(\0102\313\001\n\007K"
-  "VStore\022-\n\003Put\022\023.kvstore.PutRequest\032\021.kvs"
-  "tore.PutReply\022-\n\003Get\022\023.kvstore.GetReques"
-  "t\032\021.kvstore.GetReply\0226\n\006Delete\022\026.kvstore"
-  ".DeleteRequest\032\024.kvstore.DeleteReply\022*\n\n"
-  "PrintStats\022\r.kvstore.Void\032\r.kvstore.Void"
-  "b\006proto3"
+  "equest\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"0\n\010Pu"
+  "tReply\022\017\n\007success\030\001 \001(\010\022\023\n\013leader_hint\030\002"
+  " \001(\t\"\031\n\nGetRequest\022\013\n\003key\030\001 \001(\t\"(\n\010GetRe"
+  "ply\022\r\n\005found\030\001 \001(\010\022\r\n\005value\030\002 \001(\t\"\034\n\rDel"
+  "eteRequest\022\013\n\003key\030\001 \001(\t\"3\n\013DeleteReply\022\017"
+  "\n\007success\030\001 \001(\010\022\023\n\013leader_hint\030\002 \001(\t\"\'\n\014"
+  "StatsRequest\022\027\n\017prometheus_text\030\001 \001(\010\":\n"
+  "\013MetricValue\022\014\n\004name\030\001 \001(\t\022\016\n\006labels\030\002 \001"
+  "(\t\022\r\n\005value\030\003 \001(\003\"\215\001\n\016HistogramValue\022\014\n\004"
+  "name\030\001 \001(\t\022\016\n\006labels\030\002 \001(\t\022\r\n\005count\030\003 \001("
+  "\004\022\014\n\004mean\030\004 \001(\001\022\013\n\003p50\030\005 \001(\004\022\013\n\003p90\030\006 \001("
+  "\004\022\013\n\003p99\030\007 \001(\004\022\014\n\004p999\030\010 \001(\004\022\013\n\003max\030\t \001("
+  "\004\"C\n\006HotKey\022\013\n\003key\030\001 \001(\t\022\r\n\005count\030\002 \001(\004\022"
+  "\r\n\005error\030\003 \001(\004\022\016\n\006pinned\030\004 \001(\010\"\303\001\n\nStats"
+  "Reply\022&\n\010counters\030\001 \003(\0132\024.kvstore.Metric"
+  "Value\022$\n\006gauges\030\002 \003(\0132\024.kvstore.MetricVa"
+  "lue\022+\n\nhistograms\030\003 \003(\0132\027.kvstore.Histog"
+  "ramValue\022\027\n\017prometheus_text\030\004 \001(\t\022!\n\010hot"
+  "_keys\030\005 \003(\0132\017.kvstore.HotKey2\203\002\n\007KVStore"
+  "\022-\n\003Put\022\023.kvstore.PutRequest\032\021.kvstore.P"
+  "utReply\022-\n\003Get\022\023.kvstore.GetRequest\032\021.kv"
+  "store.GetReply\0226\n\006Delete\022\026.kvstore.Delet"
+  "eRequest\032\024.kvstore.DeleteReply\022*\n\nPrintS"
+  "tats\022\r.kvstore.Void\032\r.kvstore.Void\0226\n\010Ge"
+  "tStats\022\025.kvstore.StatsRequest\032\023.kvstore."
+  "StatsReplyb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_kvstore_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_kvstore_2eproto = {
-    false, false, 448, descriptor_table_protodef_kvstore_2eproto,
+    false, false, 1058, descriptor_table_protodef_kvstore_2eproto,
     "kvstore.proto",
-    &descriptor_table_kvstore_2eproto_once, nullptr, 0, 7,
+    &descriptor_table_kvstore_2eproto_once, nullptr, 0, 12,
     schemas, file_default_instances, TableStruct_kvstore_2eproto::offsets,
     file_level_metadata_kvstore_2eproto, file_level_enum_descriptors_kvstore_2eproto,
     file_level_service_descriptors_kvstore_2eproto,
@@ -529,10 +692,19 @@ PutReply::PutReply(const PutReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   PutReply* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.success_){}
+      decltype(_impl_.leader_hint_){}
+    , decltype(_impl_.success_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.leader_hint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leader_hint().empty()) {
+    _this->_impl_.leader_hint_.Set(from._internal_leader_hint(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:kvstore.PutReply)
 }
@@ -542,9 +714,14 @@ inline void PutReply::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.success_){false}
+      decltype(_impl_.leader_hint_){}
+    , decltype(_impl_.success_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.leader_hint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PutReply::~PutReply() {
@@ -558,6 +735,7 @@ PutReply::~PutReply() {
 
 inline void PutReply::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.leader_hint_.Destroy();
 }
 
 void PutReply::SetCachedSize(int size) const {
@@ -570,6 +748,7 @@ void PutReply::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.leader_hint_.ClearToEmpty();
   _impl_.success_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -588,6 +767,16 @@ const char* PutReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // string leader_hint = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_leader_hint();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.PutReply.leader_hint"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -623,6 +812,16 @@ uint8_t* PutReply::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
+  // string leader_hint = 2;
+  if (!this->_internal_leader_hint().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leader_hint().data(), static_cast<int>(this->_internal_leader_hint().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.PutReply.leader_hint");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_leader_hint(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -639,6 +838,13 @@ size_t PutReply::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // string leader_hint = 2;
+  if (!this->_internal_leader_hint().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leader_hint());
+  }
+
   // bool success = 1;
   if (this->_internal_success() != 0) {
     total_size += 1 + 1;
@@ -662,6 +868,9 @@ void PutReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTO
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_leader_hint().empty()) {
+    _this->_internal_set_leader_hint(from._internal_leader_hint());
+  }
   if (from._internal_success() != 0) {
     _this->_internal_set_success(from._internal_success());
   }
@@ -681,7 +890,13 @@ bool PutReply::IsInitialized() const {
 
 void PutReply::InternalSwap(PutReply* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leader_hint_, lhs_arena,
+      &other->_impl_.leader_hint_, rhs_arena
+  );
   swap(_impl_.success_, other->_impl_.success_);
 }
 
@@ -1343,10 +1558,19 @@ DeleteReply::DeleteReply(const DeleteReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   DeleteReply* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.success_){}
+      decltype(_impl_.leader_hint_){}
+    , decltype(_impl_.success_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.leader_hint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leader_hint().empty()) {
+    _this->_impl_.leader_hint_.Set(from._internal_leader_hint(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:kvstore.DeleteReply)
 }
@@ -1356,9 +1580,14 @@ inline void DeleteReply::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.success_){false}
+      decltype(_impl_.leader_hint_){}
+    , decltype(_impl_.success_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.leader_hint_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DeleteReply::~DeleteReply() {
@@ -1372,6 +1601,7 @@ DeleteReply::~DeleteReply() {
 
 inline void DeleteReply::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.leader_hint_.Destroy();
 }
 
 void DeleteReply::SetCachedSize(int size) const {
@@ -1384,6 +1614,7 @@ void DeleteReply::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.leader_hint_.ClearToEmpty();
   _impl_.success_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1402,6 +1633,16 @@ const char* DeleteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
         } else
           goto handle_unusual;
         continue;
+      // string leader_hint = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_leader_hint();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.DeleteReply.leader_hint"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1437,6 +1678,16 @@ uint8_t* DeleteReply::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
+  // string leader_hint = 2;
+  if (!this->_internal_leader_hint().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leader_hint().data(), static_cast<int>(this->_internal_leader_hint().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.DeleteReply.leader_hint");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_leader_hint(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1453,6 +1704,13 @@ size_t DeleteReply::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // string leader_hint = 2;
+  if (!this->_internal_leader_hint().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leader_hint());
+  }
+
   // bool success = 1;
   if (this->_internal_success() != 0) {
     total_size += 1 + 1;
@@ -1476,6 +1734,9 @@ void DeleteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_leader_hint().empty()) {
+    _this->_internal_set_leader_hint(from._internal_leader_hint());
+  }
   if (from._internal_success() != 0) {
     _this->_internal_set_success(from._internal_success());
   }
@@ -1495,7 +1756,13 @@ bool DeleteReply::IsInitialized() const {
 
 void DeleteReply::InternalSwap(DeleteReply* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leader_hint_, lhs_arena,
+      &other->_impl_.leader_hint_, rhs_arena
+  );
   swap(_impl_.success_, other->_impl_.success_);
 }
 
@@ -1505,36 +1772,1585 @@ void DeleteReply::InternalSwap(DeleteReply* other) {
       file_level_metadata_kvstore_2eproto[6]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace kvstore
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::kvstore::Void*
-Arena::CreateMaybeMessage< ::kvstore::Void >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::Void >(arena);
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvstore.StatsRequest)
 }
-template<> PROTOBUF_NOINLINE ::kvstore::PutRequest*
-Arena::CreateMaybeMessage< ::kvstore::PutRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::PutRequest >(arena);
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prometheus_text_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.prometheus_text_ = from._impl_.prometheus_text_;
+  // @@protoc_insertion_point(copy_constructor:kvstore.StatsRequest)
 }
-template<> PROTOBUF_NOINLINE ::kvstore::PutReply*
-Arena::CreateMaybeMessage< ::kvstore::PutReply >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::PutReply >(arena);
+
+inline void StatsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prometheus_text_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::kvstore::GetRequest*
-Arena::CreateMaybeMessage< ::kvstore::GetRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::GetRequest >(arena);
+
+StatsRequest::~StatsRequest() {
+  // @@protoc_insertion_point(destructor:kvstore.StatsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::kvstore::GetReply*
-Arena::CreateMaybeMessage< ::kvstore::GetReply >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::GetReply >(arena);
+
+inline void StatsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
-template<> PROTOBUF_NOINLINE ::kvstore::DeleteRequest*
-Arena::CreateMaybeMessage< ::kvstore::DeleteRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::DeleteRequest >(arena);
+
+void StatsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::kvstore::DeleteReply*
-Arena::CreateMaybeMessage< ::kvstore::DeleteReply >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::kvstore::DeleteReply >(arena);
+
+void StatsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvstore.StatsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prometheus_text_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool prometheus_text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.prometheus_text_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvstore.StatsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool prometheus_text = 1;
+  if (this->_internal_prometheus_text() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_prometheus_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvstore.StatsRequest)
+  return target;
+}
+
+size_t StatsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvstore.StatsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool prometheus_text = 1;
+  if (this->_internal_prometheus_text() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+void StatsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsRequest*>(&to_msg);
+  auto& from = static_cast<const StatsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvstore.StatsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_prometheus_text() != 0) {
+    _this->_internal_set_prometheus_text(from._internal_prometheus_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsRequest::CopyFrom(const StatsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvstore.StatsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsRequest::IsInitialized() const {
+  return true;
+}
+
+void StatsRequest::InternalSwap(StatsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.prometheus_text_, other->_impl_.prometheus_text_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvstore_2eproto_getter, &descriptor_table_kvstore_2eproto_once,
+      file_level_metadata_kvstore_2eproto[7]);
+}
+
+// ===================================================================
+
+class MetricValue::_Internal {
+ public:
+};
+
+MetricValue::MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvstore.MetricValue)
+}
+MetricValue::MetricValue(const MetricValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_labels().empty()) {
+    _this->_impl_.labels_.Set(from._internal_labels(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:kvstore.MetricValue)
+}
+
+inline void MetricValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.value_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetricValue::~MetricValue() {
+  // @@protoc_insertion_point(destructor:kvstore.MetricValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.labels_.Destroy();
+}
+
+void MetricValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvstore.MetricValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.labels_.ClearToEmpty();
+  _impl_.value_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.MetricValue.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string labels = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_labels();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.MetricValue.labels"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvstore.MetricValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.MetricValue.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_labels().data(), static_cast<int>(this->_internal_labels().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.MetricValue.labels");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_labels(), target);
+  }
+
+  // int64 value = 3;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvstore.MetricValue)
+  return target;
+}
+
+size_t MetricValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvstore.MetricValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_labels());
+  }
+
+  // int64 value = 3;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricValue::GetClassData() const { return &_class_data_; }
+
+
+void MetricValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricValue*>(&to_msg);
+  auto& from = static_cast<const MetricValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvstore.MetricValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_labels().empty()) {
+    _this->_internal_set_labels(from._internal_labels());
+  }
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricValue::CopyFrom(const MetricValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvstore.MetricValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricValue::IsInitialized() const {
+  return true;
+}
+
+void MetricValue::InternalSwap(MetricValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.labels_, lhs_arena,
+      &other->_impl_.labels_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvstore_2eproto_getter, &descriptor_table_kvstore_2eproto_once,
+      file_level_metadata_kvstore_2eproto[8]);
+}
+
+// ===================================================================
+
+class HistogramValue::_Internal {
+ public:
+};
+
+HistogramValue::HistogramValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvstore.HistogramValue)
+}
+HistogramValue::HistogramValue(const HistogramValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HistogramValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , decltype(_impl_.p999_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_labels().empty()) {
+    _this->_impl_.labels_.Set(from._internal_labels(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:kvstore.HistogramValue)
+}
+
+inline void HistogramValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.p50_){uint64_t{0u}}
+    , decltype(_impl_.p90_){uint64_t{0u}}
+    , decltype(_impl_.p99_){uint64_t{0u}}
+    , decltype(_impl_.p999_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HistogramValue::~HistogramValue() {
+  // @@protoc_insertion_point(destructor:kvstore.HistogramValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HistogramValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.labels_.Destroy();
+}
+
+void HistogramValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HistogramValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvstore.HistogramValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.labels_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistogramValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.HistogramValue.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string labels = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_labels();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.HistogramValue.labels"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double mean = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.p999_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HistogramValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvstore.HistogramValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.HistogramValue.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_labels().data(), static_cast<int>(this->_internal_labels().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.HistogramValue.labels");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_labels(), target);
+  }
+
+  // uint64 count = 3;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_count(), target);
+  }
+
+  // double mean = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_mean(), target);
+  }
+
+  // uint64 p50 = 5;
+  if (this->_internal_p50() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p50(), target);
+  }
+
+  // uint64 p90 = 6;
+  if (this->_internal_p90() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p90(), target);
+  }
+
+  // uint64 p99 = 7;
+  if (this->_internal_p99() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p99(), target);
+  }
+
+  // uint64 p999 = 8;
+  if (this->_internal_p999() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_p999(), target);
+  }
+
+  // uint64 max = 9;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvstore.HistogramValue)
+  return target;
+}
+
+size_t HistogramValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvstore.HistogramValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_labels());
+  }
+
+  // uint64 count = 3;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // double mean = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 p50 = 5;
+  if (this->_internal_p50() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50());
+  }
+
+  // uint64 p90 = 6;
+  if (this->_internal_p90() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90());
+  }
+
+  // uint64 p99 = 7;
+  if (this->_internal_p99() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99());
+  }
+
+  // uint64 p999 = 8;
+  if (this->_internal_p999() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999());
+  }
+
+  // uint64 max = 9;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HistogramValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HistogramValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HistogramValue::GetClassData() const { return &_class_data_; }
+
+
+void HistogramValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HistogramValue*>(&to_msg);
+  auto& from = static_cast<const HistogramValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvstore.HistogramValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_labels().empty()) {
+    _this->_internal_set_labels(from._internal_labels());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = from._internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    _this->_internal_set_mean(from._internal_mean());
+  }
+  if (from._internal_p50() != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  if (from._internal_p90() != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  if (from._internal_p99() != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  if (from._internal_p999() != 0) {
+    _this->_internal_set_p999(from._internal_p999());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HistogramValue::CopyFrom(const HistogramValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvstore.HistogramValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HistogramValue::IsInitialized() const {
+  return true;
+}
+
+void HistogramValue::InternalSwap(HistogramValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.labels_, lhs_arena,
+      &other->_impl_.labels_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistogramValue, _impl_.max_)
+      + sizeof(HistogramValue::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(HistogramValue, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HistogramValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvstore_2eproto_getter, &descriptor_table_kvstore_2eproto_once,
+      file_level_metadata_kvstore_2eproto[9]);
+}
+
+// ===================================================================
+
+class HotKey::_Internal {
+ public:
+};
+
+HotKey::HotKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvstore.HotKey)
+}
+HotKey::HotKey(const HotKey& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HotKey* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.pinned_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pinned_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.pinned_));
+  // @@protoc_insertion_point(copy_constructor:kvstore.HotKey)
+}
+
+inline void HotKey::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.error_){uint64_t{0u}}
+    , decltype(_impl_.pinned_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HotKey::~HotKey() {
+  // @@protoc_insertion_point(destructor:kvstore.HotKey)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HotKey::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void HotKey::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HotKey::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvstore.HotKey)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pinned_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.pinned_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HotKey::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.HotKey.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 error = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.error_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool pinned = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.pinned_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HotKey::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvstore.HotKey)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.HotKey.key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint64 error = 3;
+  if (this->_internal_error() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_error(), target);
+  }
+
+  // bool pinned = 4;
+  if (this->_internal_pinned() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_pinned(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvstore.HotKey)
+  return target;
+}
+
+size_t HotKey::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvstore.HotKey)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 error = 3;
+  if (this->_internal_error() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_error());
+  }
+
+  // bool pinned = 4;
+  if (this->_internal_pinned() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HotKey::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HotKey::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HotKey::GetClassData() const { return &_class_data_; }
+
+
+void HotKey::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HotKey*>(&to_msg);
+  auto& from = static_cast<const HotKey&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvstore.HotKey)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_error() != 0) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_pinned() != 0) {
+    _this->_internal_set_pinned(from._internal_pinned());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HotKey::CopyFrom(const HotKey& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvstore.HotKey)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HotKey::IsInitialized() const {
+  return true;
+}
+
+void HotKey::InternalSwap(HotKey* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HotKey, _impl_.pinned_)
+      + sizeof(HotKey::_impl_.pinned_)
+      - PROTOBUF_FIELD_OFFSET(HotKey, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HotKey::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvstore_2eproto_getter, &descriptor_table_kvstore_2eproto_once,
+      file_level_metadata_kvstore_2eproto[10]);
+}
+
+// ===================================================================
+
+class StatsReply::_Internal {
+ public:
+};
+
+StatsReply::StatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvstore.StatsReply)
+}
+StatsReply::StatsReply(const StatsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counters_){from._impl_.counters_}
+    , decltype(_impl_.gauges_){from._impl_.gauges_}
+    , decltype(_impl_.histograms_){from._impl_.histograms_}
+    , decltype(_impl_.hot_keys_){from._impl_.hot_keys_}
+    , decltype(_impl_.prometheus_text_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.prometheus_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prometheus_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prometheus_text().empty()) {
+    _this->_impl_.prometheus_text_.Set(from._internal_prometheus_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:kvstore.StatsReply)
+}
+
+inline void StatsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.counters_){arena}
+    , decltype(_impl_.gauges_){arena}
+    , decltype(_impl_.histograms_){arena}
+    , decltype(_impl_.hot_keys_){arena}
+    , decltype(_impl_.prometheus_text_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.prometheus_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prometheus_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StatsReply::~StatsReply() {
+  // @@protoc_insertion_point(destructor:kvstore.StatsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.counters_.~RepeatedPtrField();
+  _impl_.gauges_.~RepeatedPtrField();
+  _impl_.histograms_.~RepeatedPtrField();
+  _impl_.hot_keys_.~RepeatedPtrField();
+  _impl_.prometheus_text_.Destroy();
+}
+
+void StatsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvstore.StatsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.counters_.Clear();
+  _impl_.gauges_.Clear();
+  _impl_.histograms_.Clear();
+  _impl_.hot_keys_.Clear();
+  _impl_.prometheus_text_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .kvstore.MetricValue counters = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_counters(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvstore.MetricValue gauges = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_gauges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvstore.HistogramValue histograms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_histograms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string prometheus_text = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_prometheus_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvstore.StatsReply.prometheus_text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvstore.HotKey hot_keys = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_hot_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvstore.StatsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .kvstore.MetricValue counters = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_counters_size()); i < n; i++) {
+    const auto& repfield = this->_internal_counters(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .kvstore.MetricValue gauges = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_gauges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_gauges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .kvstore.HistogramValue histograms = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_histograms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_histograms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string prometheus_text = 4;
+  if (!this->_internal_prometheus_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prometheus_text().data(), static_cast<int>(this->_internal_prometheus_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvstore.StatsReply.prometheus_text");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_prometheus_text(), target);
+  }
+
+  // repeated .kvstore.HotKey hot_keys = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_hot_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_hot_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvstore.StatsReply)
+  return target;
+}
+
+size_t StatsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvstore.StatsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .kvstore.MetricValue counters = 1;
+  total_size += 1UL * this->_internal_counters_size();
+  for (const auto& msg : this->_impl_.counters_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvstore.MetricValue gauges = 2;
+  total_size += 1UL * this->_internal_gauges_size();
+  for (const auto& msg : this->_impl_.gauges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvstore.HistogramValue histograms = 3;
+  total_size += 1UL * this->_internal_histograms_size();
+  for (const auto& msg : this->_impl_.histograms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvstore.HotKey hot_keys = 5;
+  total_size += 1UL * this->_internal_hot_keys_size();
+  for (const auto& msg : this->_impl_.hot_keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string prometheus_text = 4;
+  if (!this->_internal_prometheus_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_prometheus_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsReply::GetClassData() const { return &_class_data_; }
+
+
+void StatsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsReply*>(&to_msg);
+  auto& from = static_cast<const StatsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvstore.StatsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.counters_.MergeFrom(from._impl_.counters_);
+  _this->_impl_.gauges_.MergeFrom(from._impl_.gauges_);
+  _this->_impl_.histograms_.MergeFrom(from._impl_.histograms_);
+  _this->_impl_.hot_keys_.MergeFrom(from._impl_.hot_keys_);
+  if (!from._internal_prometheus_text().empty()) {
+    _this->_internal_set_prometheus_text(from._internal_prometheus_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsReply::CopyFrom(const StatsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvstore.StatsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsReply::IsInitialized() const {
+  return true;
+}
+
+void StatsReply::InternalSwap(StatsReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.counters_.InternalSwap(&other->_impl_.counters_);
+  _impl_.gauges_.InternalSwap(&other->_impl_.gauges_);
+  _impl_.histograms_.InternalSwap(&other->_impl_.histograms_);
+  _impl_.hot_keys_.InternalSwap(&other->_impl_.hot_keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prometheus_text_, lhs_arena,
+      &other->_impl_.prometheus_text_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvstore_2eproto_getter, &descriptor_table_kvstore_2eproto_once,
+      file_level_metadata_kvstore_2eproto[11]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace kvstore
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::kvstore::Void*
+Arena::CreateMaybeMessage< ::kvstore::Void >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::Void >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::PutRequest*
+Arena::CreateMaybeMessage< ::kvstore::PutRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::PutRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::PutReply*
+Arena::CreateMaybeMessage< ::kvstore::PutReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::PutReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::GetRequest*
+Arena::CreateMaybeMessage< ::kvstore::GetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::GetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::GetReply*
+Arena::CreateMaybeMessage< ::kvstore::GetReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::GetReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::DeleteRequest*
+Arena::CreateMaybeMessage< ::kvstore::DeleteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::DeleteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::DeleteReply*
+Arena::CreateMaybeMessage< ::kvstore::DeleteReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::DeleteReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::StatsRequest*
+Arena::CreateMaybeMessage< ::kvstore::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::MetricValue*
+Arena::CreateMaybeMessage< ::kvstore::MetricValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::MetricValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::HistogramValue*
+Arena::CreateMaybeMessage< ::kvstore::HistogramValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::HistogramValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::HotKey*
+Arena::CreateMaybeMessage< ::kvstore::HotKey >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::HotKey >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvstore::StatsReply*
+Arena::CreateMaybeMessage< ::kvstore::StatsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvstore::StatsReply >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -58,12 +58,27 @@ extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
 class GetRequest;
 struct GetRequestDefaultTypeInternal;
 extern GetRequestDefaultTypeInternal _GetRequest_default_instance_;
+class HistogramValue;
+struct HistogramValueDefaultTypeInternal;
+extern HistogramValueDefaultTypeInternal _HistogramValue_default_instance_;
+class HotKey;
+struct HotKeyDefaultTypeInternal;
+extern HotKeyDefaultTypeInternal _HotKey_default_instance_;
+class MetricValue;
+struct MetricValueDefaultTypeInternal;
+extern MetricValueDefaultTypeInternal _MetricValue_default_instance_;
 class PutReply;
 struct PutReplyDefaultTypeInternal;
 extern PutReplyDefaultTypeInternal _PutReply_default_instance_;
 class PutRequest;
 struct PutRequestDefaultTypeInternal;
 extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
+class StatsReply;
+struct StatsReplyDefaultTypeInternal;
+extern StatsReplyDefaultTypeInternal _StatsReply_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
 class Void;
 struct VoidDefaultTypeInternal;
 extern VoidDefaultTypeInternal _Void_default_instance_;
@@ -73,8 +88,13 @@ template<> ::kvstore::DeleteReply* Arena::CreateMaybeMessage<::kvstore::DeleteRe
 template<> ::kvstore::DeleteRequest* Arena::CreateMaybeMessage<::kvstore::DeleteRequest>(Arena*);
 template<> ::kvstore::GetReply* Arena::CreateMaybeMessage<::kvstore::GetReply>(Arena*);
 template<> ::kvstore::GetRequest* Arena::CreateMaybeMessage<::kvstore::GetRequest>(Arena*);
+template<> ::kvstore::HistogramValue* Arena::CreateMaybeMessage<::kvstore::HistogramValue>(Arena*);
+template<> ::kvstore::HotKey* Arena::CreateMaybeMessage<::kvstore::HotKey>(Arena*);
+template<> ::kvstore::MetricValue* Arena::CreateMaybeMessage<::kvstore::MetricValue>(Arena*);
 template<> ::kvstore::PutReply* Arena::CreateMaybeMessage<::kvstore::PutReply>(Arena*);
 template<> ::kvstore::PutRequest* Arena::CreateMaybeMessage<::kvstore::PutRequest>(Arena*);
+template<> ::kvstore::StatsReply* Arena::CreateMaybeMessage<::kvstore::StatsReply>(Arena*);
+template<> ::kvstore::StatsRequest* Arena::CreateMaybeMessage<::kvstore::StatsRequest>(Arena*);
 template<> ::kvstore::Void* Arena::CreateMaybeMessage<::kvstore::Void>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace kvstore {
@@ -489,8 +509,23 @@ class PutReply final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kLeaderHintFieldNumber = 2,
     kSuccessFieldNumber = 1,
   };
+  // string leader_hint = 2;
+  void clear_leader_hint();
+  const std::string& leader_hint() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_hint(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_hint();
+  PROTOBUF_NODISCARD std::string* release_leader_hint();
+  void set_allocated_leader_hint(std::string* leader_hint);
+  private:
+  const std::string& _internal_leader_hint() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_hint(const std::string& value);
+  std::string* _internal_mutable_leader_hint();
+  public:
+
   // bool success = 1;
   void clear_success();
   bool success() const;
@@ -508,6 +543,7 @@ class PutReply final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_hint_;
     bool success_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -1107,8 +1143,23 @@ class DeleteReply final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kLeaderHintFieldNumber = 2,
     kSuccessFieldNumber = 1,
   };
+  // string leader_hint = 2;
+  void clear_leader_hint();
+  const std::string& leader_hint() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_hint(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_hint();
+  PROTOBUF_NODISCARD std::string* release_leader_hint();
+  void set_allocated_leader_hint(std::string* leader_hint);
+  private:
+  const std::string& _internal_leader_hint() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_hint(const std::string& value);
+  std::string* _internal_mutable_leader_hint();
+  public:
+
   // bool success = 1;
   void clear_success();
   bool success() const;
@@ -1126,319 +1177,1883 @@ class DeleteReply final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_hint_;
     bool success_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvstore_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvstore.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  ~StatsRequest() override;
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Void
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
 
-// -------------------------------------------------------------------
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// PutRequest
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-// string key = 1;
-inline void PutRequest::clear_key() {
-  _impl_.key_.ClearToEmpty();
-}
-inline const std::string& PutRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvstore.PutRequest.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:kvstore.PutRequest.key)
-}
-inline std::string* PutRequest::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:kvstore.PutRequest.key)
-  return _s;
-}
-inline const std::string& PutRequest::_internal_key() const {
-  return _impl_.key_.Get();
-}
-inline void PutRequest::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
-}
-inline std::string* PutRequest::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
-}
-inline std::string* PutRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvstore.PutRequest.key)
-  return _impl_.key_.Release();
-}
-inline void PutRequest::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:kvstore.PutRequest.key)
-}
 
-// string value = 2;
-inline void PutRequest::clear_value() {
-  _impl_.value_.ClearToEmpty();
-}
-inline const std::string& PutRequest::value() const {
-  // @@protoc_insertion_point(field_get:kvstore.PutRequest.value)
-  return _internal_value();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:kvstore.PutRequest.value)
-}
-inline std::string* PutRequest::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:kvstore.PutRequest.value)
-  return _s;
-}
-inline const std::string& PutRequest::_internal_value() const {
-  return _impl_.value_.Get();
-}
-inline void PutRequest::_internal_set_value(const std::string& value) {
-  
-  _impl_.value_.Set(value, GetArenaForAllocation());
-}
-inline std::string* PutRequest::_internal_mutable_value() {
-  
-  return _impl_.value_.Mutable(GetArenaForAllocation());
-}
-inline std::string* PutRequest::release_value() {
-  // @@protoc_insertion_point(field_release:kvstore.PutRequest.value)
-  return _impl_.value_.Release();
-}
-inline void PutRequest::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
-  } else {
-    
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsRequest& from) {
+    StatsRequest::MergeImpl(*this, from);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:kvstore.PutRequest.value)
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// PutReply
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsRequest* other);
 
-// bool success = 1;
-inline void PutReply::clear_success() {
-  _impl_.success_ = false;
-}
-inline bool PutReply::_internal_success() const {
-  return _impl_.success_;
-}
-inline bool PutReply::success() const {
-  // @@protoc_insertion_point(field_get:kvstore.PutReply.success)
-  return _internal_success();
-}
-inline void PutReply::_internal_set_success(bool value) {
-  
-  _impl_.success_ = value;
-}
-inline void PutReply::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:kvstore.PutReply.success)
-}
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvstore.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrometheusTextFieldNumber = 1,
+  };
+  // bool prometheus_text = 1;
+  void clear_prometheus_text();
+  bool prometheus_text() const;
+  void set_prometheus_text(bool value);
+  private:
+  bool _internal_prometheus_text() const;
+  void _internal_set_prometheus_text(bool value);
+  public:
 
+  // @@protoc_insertion_point(class_scope:kvstore.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool prometheus_text_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvstore_2eproto;
+};
 // -------------------------------------------------------------------
 
-// GetRequest
+class MetricValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvstore.MetricValue) */ {
+ public:
+  inline MetricValue() : MetricValue(nullptr) {}
+  ~MetricValue() override;
+  explicit PROTOBUF_CONSTEXPR MetricValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// string key = 1;
-inline void GetRequest::clear_key() {
-  _impl_.key_.ClearToEmpty();
-}
-inline const std::string& GetRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvstore.GetRequest.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:kvstore.GetRequest.key)
-}
-inline std::string* GetRequest::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:kvstore.GetRequest.key)
-  return _s;
-}
-inline const std::string& GetRequest::_internal_key() const {
-  return _impl_.key_.Get();
+  MetricValue(const MetricValue& from);
+  MetricValue(MetricValue&& from) noexcept
+    : MetricValue() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricValue& operator=(const MetricValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricValue& operator=(MetricValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricValue* internal_default_instance() {
+    return reinterpret_cast<const MetricValue*>(
+               &_MetricValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(MetricValue& a, MetricValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricValue& from) {
+    MetricValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvstore.MetricValue";
+  }
+  protected:
+  explicit MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kLabelsFieldNumber = 2,
+    kValueFieldNumber = 3,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string labels = 2;
+  void clear_labels();
+  const std::string& labels() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_labels(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_labels();
+  PROTOBUF_NODISCARD std::string* release_labels();
+  void set_allocated_labels(std::string* labels);
+  private:
+  const std::string& _internal_labels() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_labels(const std::string& value);
+  std::string* _internal_mutable_labels();
+  public:
+
+  // int64 value = 3;
+  void clear_value();
+  int64_t value() const;
+  void set_value(int64_t value);
+  private:
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvstore.MetricValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr labels_;
+    int64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvstore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistogramValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvstore.HistogramValue) */ {
+ public:
+  inline HistogramValue() : HistogramValue(nullptr) {}
+  ~HistogramValue() override;
+  explicit PROTOBUF_CONSTEXPR HistogramValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistogramValue(const HistogramValue& from);
+  HistogramValue(HistogramValue&& from) noexcept
+    : HistogramValue() {
+    *this = ::std::move(from);
+  }
+
+  inline HistogramValue& operator=(const HistogramValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistogramValue& operator=(HistogramValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistogramValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistogramValue* internal_default_instance() {
+    return reinterpret_cast<const HistogramValue*>(
+               &_HistogramValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(HistogramValue& a, HistogramValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistogramValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistogramValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistogramValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistogramValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistogramValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistogramValue& from) {
+    HistogramValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistogramValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvstore.HistogramValue";
+  }
+  protected:
+  explicit HistogramValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kLabelsFieldNumber = 2,
+    kCountFieldNumber = 3,
+    kMeanFieldNumber = 4,
+    kP50FieldNumber = 5,
+    kP90FieldNumber = 6,
+    kP99FieldNumber = 7,
+    kP999FieldNumber = 8,
+    kMaxFieldNumber = 9,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string labels = 2;
+  void clear_labels();
+  const std::string& labels() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_labels(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_labels();
+  PROTOBUF_NODISCARD std::string* release_labels();
+  void set_allocated_labels(std::string* labels);
+  private:
+  const std::string& _internal_labels() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_labels(const std::string& value);
+  std::string* _internal_mutable_labels();
+  public:
+
+  // uint64 count = 3;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // double mean = 4;
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // uint64 p50 = 5;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p90 = 6;
+  void clear_p90();
+  uint64_t p90() const;
+  void set_p90(uint64_t value);
+  private:
+  uint64_t _internal_p90() const;
+  void _internal_set_p90(uint64_t value);
+  public:
+
+  // uint64 p99 = 7;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 8;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 9;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvstore.HistogramValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr labels_;
+    uint64_t count_;
+    double mean_;
+    uint64_t p50_;
+    uint64_t p90_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvstore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HotKey final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvstore.HotKey) */ {
+ public:
+  inline HotKey() : HotKey(nullptr) {}
+  ~HotKey() override;
+  explicit PROTOBUF_CONSTEXPR HotKey(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HotKey(const HotKey& from);
+  HotKey(HotKey&& from) noexcept
+    : HotKey() {
+    *this = ::std::move(from);
+  }
+
+  inline HotKey& operator=(const HotKey& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HotKey& operator=(HotKey&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HotKey& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HotKey* internal_default_instance() {
+    return reinterpret_cast<const HotKey*>(
+               &_HotKey_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(HotKey& a, HotKey& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HotKey* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HotKey* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HotKey* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HotKey>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HotKey& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HotKey& from) {
+    HotKey::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HotKey* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvstore.HotKey";
+  }
+  protected:
+  explicit HotKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kErrorFieldNumber = 3,
+    kPinnedFieldNumber = 4,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 error = 3;
+  void clear_error();
+  uint64_t error() const;
+  void set_error(uint64_t value);
+  private:
+  uint64_t _internal_error() const;
+  void _internal_set_error(uint64_t value);
+  public:
+
+  // bool pinned = 4;
+  void clear_pinned();
+  bool pinned() const;
+  void set_pinned(bool value);
+  private:
+  bool _internal_pinned() const;
+  void _internal_set_pinned(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvstore.HotKey)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t count_;
+    uint64_t error_;
+    bool pinned_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvstore_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvstore.StatsReply) */ {
+ public:
+  inline StatsReply() : StatsReply(nullptr) {}
+  ~StatsReply() override;
+  explicit PROTOBUF_CONSTEXPR StatsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsReply(const StatsReply& from);
+  StatsReply(StatsReply&& from) noexcept
+    : StatsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsReply& operator=(const StatsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsReply& operator=(StatsReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsReply* internal_default_instance() {
+    return reinterpret_cast<const StatsReply*>(
+               &_StatsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(StatsReply& a, StatsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsReply& from) {
+    StatsReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvstore.StatsReply";
+  }
+  protected:
+  explicit StatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 1,
+    kGaugesFieldNumber = 2,
+    kHistogramsFieldNumber = 3,
+    kHotKeysFieldNumber = 5,
+    kPrometheusTextFieldNumber = 4,
+  };
+  // repeated .kvstore.MetricValue counters = 1;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  ::kvstore::MetricValue* mutable_counters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >*
+      mutable_counters();
+  private:
+  const ::kvstore::MetricValue& _internal_counters(int index) const;
+  ::kvstore::MetricValue* _internal_add_counters();
+  public:
+  const ::kvstore::MetricValue& counters(int index) const;
+  ::kvstore::MetricValue* add_counters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >&
+      counters() const;
+
+  // repeated .kvstore.MetricValue gauges = 2;
+  int gauges_size() const;
+  private:
+  int _internal_gauges_size() const;
+  public:
+  void clear_gauges();
+  ::kvstore::MetricValue* mutable_gauges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >*
+      mutable_gauges();
+  private:
+  const ::kvstore::MetricValue& _internal_gauges(int index) const;
+  ::kvstore::MetricValue* _internal_add_gauges();
+  public:
+  const ::kvstore::MetricValue& gauges(int index) const;
+  ::kvstore::MetricValue* add_gauges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >&
+      gauges() const;
+
+  // repeated .kvstore.HistogramValue histograms = 3;
+  int histograms_size() const;
+  private:
+  int _internal_histograms_size() const;
+  public:
+  void clear_histograms();
+  ::kvstore::HistogramValue* mutable_histograms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HistogramValue >*
+      mutable_histograms();
+  private:
+  const ::kvstore::HistogramValue& _internal_histograms(int index) const;
+  ::kvstore::HistogramValue* _internal_add_histograms();
+  public:
+  const ::kvstore::HistogramValue& histograms(int index) const;
+  ::kvstore::HistogramValue* add_histograms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HistogramValue >&
+      histograms() const;
+
+  // repeated .kvstore.HotKey hot_keys = 5;
+  int hot_keys_size() const;
+  private:
+  int _internal_hot_keys_size() const;
+  public:
+  void clear_hot_keys();
+  ::kvstore::HotKey* mutable_hot_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HotKey >*
+      mutable_hot_keys();
+  private:
+  const ::kvstore::HotKey& _internal_hot_keys(int index) const;
+  ::kvstore::HotKey* _internal_add_hot_keys();
+  public:
+  const ::kvstore::HotKey& hot_keys(int index) const;
+  ::kvstore::HotKey* add_hot_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HotKey >&
+      hot_keys() const;
+
+  // string prometheus_text = 4;
+  void clear_prometheus_text();
+  const std::string& prometheus_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prometheus_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prometheus_text();
+  PROTOBUF_NODISCARD std::string* release_prometheus_text();
+  void set_allocated_prometheus_text(std::string* prometheus_text);
+  private:
+  const std::string& _internal_prometheus_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prometheus_text(const std::string& value);
+  std::string* _internal_mutable_prometheus_text();
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvstore.StatsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue > counters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue > gauges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HistogramValue > histograms_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HotKey > hot_keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prometheus_text_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvstore_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Void
+
+// -------------------------------------------------------------------
+
+// PutRequest
+
+// string key = 1;
+inline void PutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvstore.PutRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.PutRequest.key)
+}
+inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:kvstore.PutRequest.key)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvstore.PutRequest.key)
+  return _impl_.key_.Release();
+}
+inline void PutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.PutRequest.key)
+}
+
+// string value = 2;
+inline void PutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutRequest::value() const {
+  // @@protoc_insertion_point(field_get:kvstore.PutRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.PutRequest.value)
+}
+inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:kvstore.PutRequest.value)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:kvstore.PutRequest.value)
+  return _impl_.value_.Release();
+}
+inline void PutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.PutRequest.value)
+}
+
+// -------------------------------------------------------------------
+
+// PutReply
+
+// bool success = 1;
+inline void PutReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool PutReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool PutReply::success() const {
+  // @@protoc_insertion_point(field_get:kvstore.PutReply.success)
+  return _internal_success();
+}
+inline void PutReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void PutReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:kvstore.PutReply.success)
+}
+
+// string leader_hint = 2;
+inline void PutReply::clear_leader_hint() {
+  _impl_.leader_hint_.ClearToEmpty();
+}
+inline const std::string& PutReply::leader_hint() const {
+  // @@protoc_insertion_point(field_get:kvstore.PutReply.leader_hint)
+  return _internal_leader_hint();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutReply::set_leader_hint(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_hint_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.PutReply.leader_hint)
+}
+inline std::string* PutReply::mutable_leader_hint() {
+  std::string* _s = _internal_mutable_leader_hint();
+  // @@protoc_insertion_point(field_mutable:kvstore.PutReply.leader_hint)
+  return _s;
+}
+inline const std::string& PutReply::_internal_leader_hint() const {
+  return _impl_.leader_hint_.Get();
+}
+inline void PutReply::_internal_set_leader_hint(const std::string& value) {
+  
+  _impl_.leader_hint_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutReply::_internal_mutable_leader_hint() {
+  
+  return _impl_.leader_hint_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutReply::release_leader_hint() {
+  // @@protoc_insertion_point(field_release:kvstore.PutReply.leader_hint)
+  return _impl_.leader_hint_.Release();
+}
+inline void PutReply::set_allocated_leader_hint(std::string* leader_hint) {
+  if (leader_hint != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_hint_.SetAllocated(leader_hint, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_hint_.IsDefault()) {
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.PutReply.leader_hint)
+}
+
+// -------------------------------------------------------------------
+
+// GetRequest
+
+// string key = 1;
+inline void GetRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvstore.GetRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.GetRequest.key)
+}
+inline std::string* GetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:kvstore.GetRequest.key)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvstore.GetRequest.key)
+  return _impl_.key_.Release();
+}
+inline void GetRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.GetRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bool found = 1;
+inline void GetReply::clear_found() {
+  _impl_.found_ = false;
+}
+inline bool GetReply::_internal_found() const {
+  return _impl_.found_;
+}
+inline bool GetReply::found() const {
+  // @@protoc_insertion_point(field_get:kvstore.GetReply.found)
+  return _internal_found();
+}
+inline void GetReply::_internal_set_found(bool value) {
+  
+  _impl_.found_ = value;
+}
+inline void GetReply::set_found(bool value) {
+  _internal_set_found(value);
+  // @@protoc_insertion_point(field_set:kvstore.GetReply.found)
+}
+
+// string value = 2;
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:kvstore.GetReply.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.GetReply.value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:kvstore.GetReply.value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:kvstore.GetReply.value)
+  return _impl_.value_.Release();
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.GetReply.value)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteRequest
+
+// string key = 1;
+inline void DeleteRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:kvstore.DeleteRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.DeleteRequest.key)
+}
+inline std::string* DeleteRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:kvstore.DeleteRequest.key)
+  return _s;
+}
+inline const std::string& DeleteRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DeleteRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:kvstore.DeleteRequest.key)
+  return _impl_.key_.Release();
+}
+inline void DeleteRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.DeleteRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteReply
+
+// bool success = 1;
+inline void DeleteReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool DeleteReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool DeleteReply::success() const {
+  // @@protoc_insertion_point(field_get:kvstore.DeleteReply.success)
+  return _internal_success();
+}
+inline void DeleteReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void DeleteReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:kvstore.DeleteReply.success)
+}
+
+// string leader_hint = 2;
+inline void DeleteReply::clear_leader_hint() {
+  _impl_.leader_hint_.ClearToEmpty();
+}
+inline const std::string& DeleteReply::leader_hint() const {
+  // @@protoc_insertion_point(field_get:kvstore.DeleteReply.leader_hint)
+  return _internal_leader_hint();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteReply::set_leader_hint(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_hint_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.DeleteReply.leader_hint)
+}
+inline std::string* DeleteReply::mutable_leader_hint() {
+  std::string* _s = _internal_mutable_leader_hint();
+  // @@protoc_insertion_point(field_mutable:kvstore.DeleteReply.leader_hint)
+  return _s;
+}
+inline const std::string& DeleteReply::_internal_leader_hint() const {
+  return _impl_.leader_hint_.Get();
+}
+inline void DeleteReply::_internal_set_leader_hint(const std::string& value) {
+  
+  _impl_.leader_hint_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteReply::_internal_mutable_leader_hint() {
+  
+  return _impl_.leader_hint_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteReply::release_leader_hint() {
+  // @@protoc_insertion_point(field_release:kvstore.DeleteReply.leader_hint)
+  return _impl_.leader_hint_.Release();
+}
+inline void DeleteReply::set_allocated_leader_hint(std::string* leader_hint) {
+  if (leader_hint != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_hint_.SetAllocated(leader_hint, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_hint_.IsDefault()) {
+    _impl_.leader_hint_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.DeleteReply.leader_hint)
+}
+
+// -------------------------------------------------------------------
+
+// StatsRequest
+
+// bool prometheus_text = 1;
+inline void StatsRequest::clear_prometheus_text() {
+  _impl_.prometheus_text_ = false;
+}
+inline bool StatsRequest::_internal_prometheus_text() const {
+  return _impl_.prometheus_text_;
+}
+inline bool StatsRequest::prometheus_text() const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsRequest.prometheus_text)
+  return _internal_prometheus_text();
+}
+inline void StatsRequest::_internal_set_prometheus_text(bool value) {
+  
+  _impl_.prometheus_text_ = value;
+}
+inline void StatsRequest::set_prometheus_text(bool value) {
+  _internal_set_prometheus_text(value);
+  // @@protoc_insertion_point(field_set:kvstore.StatsRequest.prometheus_text)
+}
+
+// -------------------------------------------------------------------
+
+// MetricValue
+
+// string name = 1;
+inline void MetricValue::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MetricValue::name() const {
+  // @@protoc_insertion_point(field_get:kvstore.MetricValue.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricValue::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.MetricValue.name)
+}
+inline std::string* MetricValue::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:kvstore.MetricValue.name)
+  return _s;
+}
+inline const std::string& MetricValue::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetricValue::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricValue::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricValue::release_name() {
+  // @@protoc_insertion_point(field_release:kvstore.MetricValue.name)
+  return _impl_.name_.Release();
+}
+inline void MetricValue::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.MetricValue.name)
+}
+
+// string labels = 2;
+inline void MetricValue::clear_labels() {
+  _impl_.labels_.ClearToEmpty();
 }
-inline void GetRequest::_internal_set_key(const std::string& value) {
+inline const std::string& MetricValue::labels() const {
+  // @@protoc_insertion_point(field_get:kvstore.MetricValue.labels)
+  return _internal_labels();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricValue::set_labels(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.labels_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.MetricValue.labels)
+}
+inline std::string* MetricValue::mutable_labels() {
+  std::string* _s = _internal_mutable_labels();
+  // @@protoc_insertion_point(field_mutable:kvstore.MetricValue.labels)
+  return _s;
+}
+inline const std::string& MetricValue::_internal_labels() const {
+  return _impl_.labels_.Get();
+}
+inline void MetricValue::_internal_set_labels(const std::string& value) {
   
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.labels_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetRequest::_internal_mutable_key() {
+inline std::string* MetricValue::_internal_mutable_labels() {
   
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.labels_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvstore.GetRequest.key)
-  return _impl_.key_.Release();
+inline std::string* MetricValue::release_labels() {
+  // @@protoc_insertion_point(field_release:kvstore.MetricValue.labels)
+  return _impl_.labels_.Release();
 }
-inline void GetRequest::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void MetricValue::set_allocated_labels(std::string* labels) {
+  if (labels != nullptr) {
     
   } else {
     
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.labels_.SetAllocated(labels, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.labels_.IsDefault()) {
+    _impl_.labels_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:kvstore.GetRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:kvstore.MetricValue.labels)
+}
+
+// int64 value = 3;
+inline void MetricValue::clear_value() {
+  _impl_.value_ = int64_t{0};
+}
+inline int64_t MetricValue::_internal_value() const {
+  return _impl_.value_;
+}
+inline int64_t MetricValue::value() const {
+  // @@protoc_insertion_point(field_get:kvstore.MetricValue.value)
+  return _internal_value();
+}
+inline void MetricValue::_internal_set_value(int64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void MetricValue::set_value(int64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:kvstore.MetricValue.value)
 }
 
 // -------------------------------------------------------------------
 
-// GetReply
+// HistogramValue
 
-// bool found = 1;
-inline void GetReply::clear_found() {
-  _impl_.found_ = false;
+// string name = 1;
+inline void HistogramValue::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline bool GetReply::_internal_found() const {
-  return _impl_.found_;
+inline const std::string& HistogramValue::name() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.name)
+  return _internal_name();
 }
-inline bool GetReply::found() const {
-  // @@protoc_insertion_point(field_get:kvstore.GetReply.found)
-  return _internal_found();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HistogramValue::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.name)
 }
-inline void GetReply::_internal_set_found(bool value) {
+inline std::string* HistogramValue::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:kvstore.HistogramValue.name)
+  return _s;
+}
+inline const std::string& HistogramValue::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void HistogramValue::_internal_set_name(const std::string& value) {
   
-  _impl_.found_ = value;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline void GetReply::set_found(bool value) {
-  _internal_set_found(value);
-  // @@protoc_insertion_point(field_set:kvstore.GetReply.found)
+inline std::string* HistogramValue::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HistogramValue::release_name() {
+  // @@protoc_insertion_point(field_release:kvstore.HistogramValue.name)
+  return _impl_.name_.Release();
+}
+inline void HistogramValue::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.HistogramValue.name)
 }
 
-// string value = 2;
-inline void GetReply::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// string labels = 2;
+inline void HistogramValue::clear_labels() {
+  _impl_.labels_.ClearToEmpty();
 }
-inline const std::string& GetReply::value() const {
-  // @@protoc_insertion_point(field_get:kvstore.GetReply.value)
-  return _internal_value();
+inline const std::string& HistogramValue::labels() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.labels)
+  return _internal_labels();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+void HistogramValue::set_labels(ArgT0&& arg0, ArgT... args) {
  
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:kvstore.GetReply.value)
+ _impl_.labels_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.labels)
 }
-inline std::string* GetReply::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:kvstore.GetReply.value)
+inline std::string* HistogramValue::mutable_labels() {
+  std::string* _s = _internal_mutable_labels();
+  // @@protoc_insertion_point(field_mutable:kvstore.HistogramValue.labels)
   return _s;
 }
-inline const std::string& GetReply::_internal_value() const {
-  return _impl_.value_.Get();
+inline const std::string& HistogramValue::_internal_labels() const {
+  return _impl_.labels_.Get();
 }
-inline void GetReply::_internal_set_value(const std::string& value) {
+inline void HistogramValue::_internal_set_labels(const std::string& value) {
   
-  _impl_.value_.Set(value, GetArenaForAllocation());
+  _impl_.labels_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetReply::_internal_mutable_value() {
+inline std::string* HistogramValue::_internal_mutable_labels() {
   
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+  return _impl_.labels_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetReply::release_value() {
-  // @@protoc_insertion_point(field_release:kvstore.GetReply.value)
-  return _impl_.value_.Release();
+inline std::string* HistogramValue::release_labels() {
+  // @@protoc_insertion_point(field_release:kvstore.HistogramValue.labels)
+  return _impl_.labels_.Release();
 }
-inline void GetReply::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline void HistogramValue::set_allocated_labels(std::string* labels) {
+  if (labels != nullptr) {
     
   } else {
     
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+  _impl_.labels_.SetAllocated(labels, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  if (_impl_.labels_.IsDefault()) {
+    _impl_.labels_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:kvstore.GetReply.value)
+  // @@protoc_insertion_point(field_set_allocated:kvstore.HistogramValue.labels)
+}
+
+// uint64 count = 3;
+inline void HistogramValue::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t HistogramValue::count() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.count)
+  return _internal_count();
+}
+inline void HistogramValue::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void HistogramValue::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.count)
+}
+
+// double mean = 4;
+inline void HistogramValue::clear_mean() {
+  _impl_.mean_ = 0;
+}
+inline double HistogramValue::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double HistogramValue::mean() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.mean)
+  return _internal_mean();
+}
+inline void HistogramValue::_internal_set_mean(double value) {
+  
+  _impl_.mean_ = value;
+}
+inline void HistogramValue::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.mean)
+}
+
+// uint64 p50 = 5;
+inline void HistogramValue::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t HistogramValue::p50() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.p50)
+  return _internal_p50();
+}
+inline void HistogramValue::_internal_set_p50(uint64_t value) {
+  
+  _impl_.p50_ = value;
+}
+inline void HistogramValue::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.p50)
+}
+
+// uint64 p90 = 6;
+inline void HistogramValue::clear_p90() {
+  _impl_.p90_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline uint64_t HistogramValue::p90() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.p90)
+  return _internal_p90();
+}
+inline void HistogramValue::_internal_set_p90(uint64_t value) {
+  
+  _impl_.p90_ = value;
+}
+inline void HistogramValue::set_p90(uint64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.p90)
+}
+
+// uint64 p99 = 7;
+inline void HistogramValue::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t HistogramValue::p99() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.p99)
+  return _internal_p99();
+}
+inline void HistogramValue::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void HistogramValue::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.p99)
+}
+
+// uint64 p999 = 8;
+inline void HistogramValue::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t HistogramValue::p999() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.p999)
+  return _internal_p999();
+}
+inline void HistogramValue::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void HistogramValue::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.p999)
+}
+
+// uint64 max = 9;
+inline void HistogramValue::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t HistogramValue::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t HistogramValue::max() const {
+  // @@protoc_insertion_point(field_get:kvstore.HistogramValue.max)
+  return _internal_max();
+}
+inline void HistogramValue::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void HistogramValue::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:kvstore.HistogramValue.max)
 }
 
 // -------------------------------------------------------------------
 
-// DeleteRequest
+// HotKey
 
 // string key = 1;
-inline void DeleteRequest::clear_key() {
+inline void HotKey::clear_key() {
   _impl_.key_.ClearToEmpty();
 }
-inline const std::string& DeleteRequest::key() const {
-  // @@protoc_insertion_point(field_get:kvstore.DeleteRequest.key)
+inline const std::string& HotKey::key() const {
+  // @@protoc_insertion_point(field_get:kvstore.HotKey.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void DeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+void HotKey::set_key(ArgT0&& arg0, ArgT... args) {
  
  _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:kvstore.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set:kvstore.HotKey.key)
 }
-inline std::string* DeleteRequest::mutable_key() {
+inline std::string* HotKey::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:kvstore.DeleteRequest.key)
+  // @@protoc_insertion_point(field_mutable:kvstore.HotKey.key)
   return _s;
 }
-inline const std::string& DeleteRequest::_internal_key() const {
+inline const std::string& HotKey::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void DeleteRequest::_internal_set_key(const std::string& value) {
+inline void HotKey::_internal_set_key(const std::string& value) {
   
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DeleteRequest::_internal_mutable_key() {
+inline std::string* HotKey::_internal_mutable_key() {
   
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* DeleteRequest::release_key() {
-  // @@protoc_insertion_point(field_release:kvstore.DeleteRequest.key)
+inline std::string* HotKey::release_key() {
+  // @@protoc_insertion_point(field_release:kvstore.HotKey.key)
   return _impl_.key_.Release();
 }
-inline void DeleteRequest::set_allocated_key(std::string* key) {
+inline void HotKey::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     
   } else {
@@ -1450,31 +3065,281 @@ inline void DeleteRequest::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:kvstore.DeleteRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:kvstore.HotKey.key)
+}
+
+// uint64 count = 2;
+inline void HotKey::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t HotKey::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t HotKey::count() const {
+  // @@protoc_insertion_point(field_get:kvstore.HotKey.count)
+  return _internal_count();
+}
+inline void HotKey::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void HotKey::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:kvstore.HotKey.count)
+}
+
+// uint64 error = 3;
+inline void HotKey::clear_error() {
+  _impl_.error_ = uint64_t{0u};
+}
+inline uint64_t HotKey::_internal_error() const {
+  return _impl_.error_;
+}
+inline uint64_t HotKey::error() const {
+  // @@protoc_insertion_point(field_get:kvstore.HotKey.error)
+  return _internal_error();
+}
+inline void HotKey::_internal_set_error(uint64_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void HotKey::set_error(uint64_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:kvstore.HotKey.error)
+}
+
+// bool pinned = 4;
+inline void HotKey::clear_pinned() {
+  _impl_.pinned_ = false;
+}
+inline bool HotKey::_internal_pinned() const {
+  return _impl_.pinned_;
+}
+inline bool HotKey::pinned() const {
+  // @@protoc_insertion_point(field_get:kvstore.HotKey.pinned)
+  return _internal_pinned();
+}
+inline void HotKey::_internal_set_pinned(bool value) {
+  
+  _impl_.pinned_ = value;
+}
+inline void HotKey::set_pinned(bool value) {
+  _internal_set_pinned(value);
+  // @@protoc_insertion_point(field_set:kvstore.HotKey.pinned)
 }
 
 // -------------------------------------------------------------------
 
-// DeleteReply
+// StatsReply
 
-// bool success = 1;
-inline void DeleteReply::clear_success() {
-  _impl_.success_ = false;
+// repeated .kvstore.MetricValue counters = 1;
+inline int StatsReply::_internal_counters_size() const {
+  return _impl_.counters_.size();
 }
-inline bool DeleteReply::_internal_success() const {
-  return _impl_.success_;
+inline int StatsReply::counters_size() const {
+  return _internal_counters_size();
 }
-inline bool DeleteReply::success() const {
-  // @@protoc_insertion_point(field_get:kvstore.DeleteReply.success)
-  return _internal_success();
+inline void StatsReply::clear_counters() {
+  _impl_.counters_.Clear();
 }
-inline void DeleteReply::_internal_set_success(bool value) {
+inline ::kvstore::MetricValue* StatsReply::mutable_counters(int index) {
+  // @@protoc_insertion_point(field_mutable:kvstore.StatsReply.counters)
+  return _impl_.counters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >*
+StatsReply::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_list:kvstore.StatsReply.counters)
+  return &_impl_.counters_;
+}
+inline const ::kvstore::MetricValue& StatsReply::_internal_counters(int index) const {
+  return _impl_.counters_.Get(index);
+}
+inline const ::kvstore::MetricValue& StatsReply::counters(int index) const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsReply.counters)
+  return _internal_counters(index);
+}
+inline ::kvstore::MetricValue* StatsReply::_internal_add_counters() {
+  return _impl_.counters_.Add();
+}
+inline ::kvstore::MetricValue* StatsReply::add_counters() {
+  ::kvstore::MetricValue* _add = _internal_add_counters();
+  // @@protoc_insertion_point(field_add:kvstore.StatsReply.counters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >&
+StatsReply::counters() const {
+  // @@protoc_insertion_point(field_list:kvstore.StatsReply.counters)
+  return _impl_.counters_;
+}
+
+// repeated .kvstore.MetricValue gauges = 2;
+inline int StatsReply::_internal_gauges_size() const {
+  return _impl_.gauges_.size();
+}
+inline int StatsReply::gauges_size() const {
+  return _internal_gauges_size();
+}
+inline void StatsReply::clear_gauges() {
+  _impl_.gauges_.Clear();
+}
+inline ::kvstore::MetricValue* StatsReply::mutable_gauges(int index) {
+  // @@protoc_insertion_point(field_mutable:kvstore.StatsReply.gauges)
+  return _impl_.gauges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >*
+StatsReply::mutable_gauges() {
+  // @@protoc_insertion_point(field_mutable_list:kvstore.StatsReply.gauges)
+  return &_impl_.gauges_;
+}
+inline const ::kvstore::MetricValue& StatsReply::_internal_gauges(int index) const {
+  return _impl_.gauges_.Get(index);
+}
+inline const ::kvstore::MetricValue& StatsReply::gauges(int index) const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsReply.gauges)
+  return _internal_gauges(index);
+}
+inline ::kvstore::MetricValue* StatsReply::_internal_add_gauges() {
+  return _impl_.gauges_.Add();
+}
+inline ::kvstore::MetricValue* StatsReply::add_gauges() {
+  ::kvstore::MetricValue* _add = _internal_add_gauges();
+  // @@protoc_insertion_point(field_add:kvstore.StatsReply.gauges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::MetricValue >&
+StatsReply::gauges() const {
+  // @@protoc_insertion_point(field_list:kvstore.StatsReply.gauges)
+  return _impl_.gauges_;
+}
+
+// repeated .kvstore.HistogramValue histograms = 3;
+inline int StatsReply::_internal_histograms_size() const {
+  return _impl_.histograms_.size();
+}
+inline int StatsReply::histograms_size() const {
+  return _internal_histograms_size();
+}
+inline void StatsReply::clear_histograms() {
+  _impl_.histograms_.Clear();
+}
+inline ::kvstore::HistogramValue* StatsReply::mutable_histograms(int index) {
+  // @@protoc_insertion_point(field_mutable:kvstore.StatsReply.histograms)
+  return _impl_.histograms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HistogramValue >*
+StatsReply::mutable_histograms() {
+  // @@protoc_insertion_point(field_mutable_list:kvstore.StatsReply.histograms)
+  return &_impl_.histograms_;
+}
+inline const ::kvstore::HistogramValue& StatsReply::_internal_histograms(int index) const {
+  return _impl_.histograms_.Get(index);
+}
+inline const ::kvstore::HistogramValue& StatsReply::histograms(int index) const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsReply.histograms)
+  return _internal_histograms(index);
+}
+inline ::kvstore::HistogramValue* StatsReply::_internal_add_histograms() {
+  return _impl_.histograms_.Add();
+}
+inline ::kvstore::HistogramValue* StatsReply::add_histograms() {
+  ::kvstore::HistogramValue* _add = _internal_add_histograms();
+  // @@protoc_insertion_point(field_add:kvstore.StatsReply.histograms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HistogramValue >&
+StatsReply::histograms() const {
+  // @@protoc_insertion_point(field_list:kvstore.StatsReply.histograms)
+  return _impl_.histograms_;
+}
+
+// string prometheus_text = 4;
+inline void StatsReply::clear_prometheus_text() {
+  _impl_.prometheus_text_.ClearToEmpty();
+}
+inline const std::string& StatsReply::prometheus_text() const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsReply.prometheus_text)
+  return _internal_prometheus_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatsReply::set_prometheus_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prometheus_text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvstore.StatsReply.prometheus_text)
+}
+inline std::string* StatsReply::mutable_prometheus_text() {
+  std::string* _s = _internal_mutable_prometheus_text();
+  // @@protoc_insertion_point(field_mutable:kvstore.StatsReply.prometheus_text)
+  return _s;
+}
+inline const std::string& StatsReply::_internal_prometheus_text() const {
+  return _impl_.prometheus_text_.Get();
+}
+inline void StatsReply::_internal_set_prometheus_text(const std::string& value) {
   
-  _impl_.success_ = value;
+  _impl_.prometheus_text_.Set(value, GetArenaForAllocation());
 }
-inline void DeleteReply::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:kvstore.DeleteReply.success)
+inline std::string* StatsReply::_internal_mutable_prometheus_text() {
+  
+  return _impl_.prometheus_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatsReply::release_prometheus_text() {
+  // @@protoc_insertion_point(field_release:kvstore.StatsReply.prometheus_text)
+  return _impl_.prometheus_text_.Release();
+}
+inline void StatsReply::set_allocated_prometheus_text(std::string* prometheus_text) {
+  if (prometheus_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prometheus_text_.SetAllocated(prometheus_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prometheus_text_.IsDefault()) {
+    _impl_.prometheus_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvstore.StatsReply.prometheus_text)
+}
+
+// repeated .kvstore.HotKey hot_keys = 5;
+inline int StatsReply::_internal_hot_keys_size() const {
+  return _impl_.hot_keys_.size();
+}
+inline int StatsReply::hot_keys_size() const {
+  return _internal_hot_keys_size();
+}
+inline void StatsReply::clear_hot_keys() {
+  _impl_.hot_keys_.Clear();
+}
+inline ::kvstore::HotKey* StatsReply::mutable_hot_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:kvstore.StatsReply.hot_keys)
+  return _impl_.hot_keys_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HotKey >*
+StatsReply::mutable_hot_keys() {
+  // @@protoc_insertion_point(field_mutable_list:kvstore.StatsReply.hot_keys)
+  return &_impl_.hot_keys_;
+}
+inline const ::kvstore::HotKey& StatsReply::_internal_hot_keys(int index) const {
+  return _impl_.hot_keys_.Get(index);
+}
+inline const ::kvstore::HotKey& StatsReply::hot_keys(int index) const {
+  // @@protoc_insertion_point(field_get:kvstore.StatsReply.hot_keys)
+  return _internal_hot_keys(index);
+}
+inline ::kvstore::HotKey* StatsReply::_internal_add_hot_keys() {
+  return _impl_.hot_keys_.Add();
+}
+inline ::kvstore::HotKey* StatsReply::add_hot_keys() {
+  ::kvstore::HotKey* _add = _internal_add_hot_keys();
+  // @@protoc_insertion_point(field_add:kvstore.StatsReply.hot_keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvstore::HotKey >&
+StatsReply::hot_keys() const {
+  // @@protoc_insertion_point(field_list:kvstore.StatsReply.hot_keys)
+  return _impl_.hot_keys_;
 }
 
 #ifdef __GNUC__
@@ -1492,6 +3357,16 @@ inline void DeleteReply::set_success(bool value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -6,6 +6,7 @@
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <optional>
 
 #include <grpcpp/grpcpp.h>
 #include "kvstore.grpc.pb.h"
@@ -14,6 +15,10 @@
 #include "wal.h"
 #include "disk_store.h"
 #include "cache_controller.h"
+#include "metrics.h"
+#include "metrics_http.h"
+#include "single_flight.h"
+#include "hot_keys.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -28,6 +33,8 @@ using kvstore::GetReply;
 using kvstore::DeleteRequest;
 using kvstore::DeleteReply;
 using kvstore::Void;
+using kvstore::StatsRequest;
+using kvstore::StatsReply;
 
 using replication::Replication;
 using replication::ReplicatePutRequest;
@@ -40,9 +47,16 @@ struct ServerConfig {
     std::string port = "50051";
     std::string log_file;
     CachePolicy cache_policy = CachePolicy::LRU;
+    int negative_cache_capacity = 1000; // recently missed keys remembered, 0 disables
+    bool bloom_filter = false;          // bloom filter over every key in the WAL
+    size_t bloom_expected_keys = 1000000;
     std::string node_id = "0";
+    std::string advertise_address; // address clients use to reach this node
     bool is_leader = false;
     std::vector<std::string> follower_addresses;
+    int metrics_port = 0; // 0 disables the Prometheus HTTP endpoint
+    int hot_key_capacity = 1000; // keys tracked by the hot-key sketch, 0 disables tracking
+    int pin_hot_keys = 0;        // hottest N keys kept exempt from cache eviction
     // Add more as needed
 };
 
@@ -67,8 +81,22 @@ void parse_flags(int argc, char** argv, ServerConfig& config) {
         } else if (auto val = extract_flag_value(arg, "--cache_policy="); !val.empty()) {
             if (val == "LFU") config.cache_policy = CachePolicy::LFU;
             else config.cache_policy = CachePolicy::LRU;
+        } else if (auto val = extract_flag_value(arg, "--negative_cache_capacity="); !val.empty()) {
+            config.negative_cache_capacity = std::stoi(val);
+        } else if (auto val = extract_flag_value(arg, "--bloom_filter="); !val.empty()) {
+            config.bloom_filter = (val == "true");
+        } else if (auto val = extract_flag_value(arg, "--bloom_expected_keys="); !val.empty()) {
+            config.bloom_expected_keys = std::stoull(val);
         } else if (auto val = extract_flag_value(arg, "--node_id="); !val.empty()) {
             config.node_id = val;
+        } else if (auto val = extract_flag_value(arg, "--advertise_address="); !val.empty()) {
+            config.advertise_address = val;
+        } else if (auto val = extract_flag_value(arg, "--metrics_port="); !val.empty()) {
+            config.metrics_port = std::stoi(val);
+        } else if (auto val = extract_flag_value(arg, "--hot_key_capacity="); !val.empty()) {
+            config.hot_key_capacity = std::stoi(val);
+        } else if (auto val = extract_flag_value(arg, "--pin_hot_keys="); !val.empty()) {
+            config.pin_hot_keys = std::stoi(val);
         } else if (auto val = extract_flag_value(arg, "--is_leader="); !val.empty()) {
             config.is_leader = (val == "true");
         } else if (auto val = extract_flag_value(arg, "--followers="); !val.empty()) {
@@ -83,6 +111,7 @@ void parse_flags(int argc, char** argv, ServerConfig& config) {
         }
     }
     config.log_file = "wal" + config.node_id + ".log";
+    if (config.advertise_address.empty()) config.advertise_address = "localhost:" + config.port;
 }
 
 class KVStoreServiceImpl final : public KVStore::Service, public Replication::Service {
@@ -91,23 +120,111 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
 	    WAL wal_;
         DiskStore db_;
         CacheController cache_;
+        // DiskStore reads run outside mutex_; concurrent misses on one key share a single read
+        SingleFlight<std::string, std::optional<std::string>> inflight_;
+        HotKeyTracker hot_keys_;
+        int pin_hot_keys_;
+        uint64_t reads_since_repin_ = 0;
+        static constexpr uint64_t kRepinInterval = 10000; // Gets between refreshes of the pinned set
         bool is_leader_;
         std::string node_id_;
+        std::string advertise_address_;
+        std::string leader_address_; // learned from heartbeats; empty until a leader is heard from
         std::vector<std::unique_ptr<replication::Replication::Stub>> follower_stubs_;
+
+        struct FollowerMetrics {
+            LatencyHistogram& replicate_latency;
+            Counter& failures;
+            Gauge& unacked_writes;  // writes this follower never acknowledged (they are not retried)
+            Gauge& last_ack_ms;     // unix time of the last ack; lag = now - this
+        };
+        std::vector<FollowerMetrics> follower_metrics_;
+
+        LatencyHistogram& put_latency_;
+        LatencyHistogram& get_latency_;
+        LatencyHistogram& delete_latency_;
+        LatencyHistogram& replicate_put_latency_;
+        Counter& coalesced_reads_;
+
+        static int64_t unix_ms() {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        // A follower that has not heard a heartbeat yet cannot redirect a write, and must not
+        // apply it locally where it would never be replicated. UNAVAILABLE makes KVClient move
+        // on to its next endpoint.
+        static Status no_leader_yet() {
+            return Status(grpc::StatusCode::UNAVAILABLE, "follower has no known leader yet");
+        }
     public:
         Status PrintStats(ServerContext* context, const kvstore::Void* request, kvstore::Void* response) override {
             cache_.print_stats();  // stats printer
             return Status::OK;
         }
 
+        Status GetStats(ServerContext* context, const StatsRequest* request, StatsReply* reply) override {
+            MetricsRegistry& registry = MetricsRegistry::Get();
+            registry.for_each_counter([&](const std::string& family, const std::string& labels, const Counter& c) {
+                auto* m = reply->add_counters();
+                m->set_name(family);
+                m->set_labels(labels);
+                m->set_value(c.value());
+            });
+            registry.for_each_gauge([&](const std::string& family, const std::string& labels, const Gauge& g) {
+                auto* m = reply->add_gauges();
+                m->set_name(family);
+                m->set_labels(labels);
+                m->set_value(g.value());
+            });
+            registry.for_each_histogram([&](const std::string& family, const std::string& labels, const LatencyHistogram& h) {
+                auto* m = reply->add_histograms();
+                m->set_name(family);
+                m->set_labels(labels);
+                m->set_count(h.count());
+                m->set_mean(h.mean());
+                m->set_p50(h.percentile(0.50));
+                m->set_p90(h.percentile(0.90));
+                m->set_p99(h.percentile(0.99));
+                m->set_p999(h.percentile(0.999));
+                m->set_max(h.max());
+            });
+            if (request->prometheus_text()) reply->set_prometheus_text(registry.prometheus_text());
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const HotKey& hk : hot_keys_.top(20)) {
+                auto* m = reply->add_hot_keys();
+                m->set_key(hk.key);
+                m->set_count(hk.count);
+                m->set_error(hk.error);
+                m->set_pinned(cache_.is_pinned(hk.key));
+            }
+            return Status::OK;
+        }
+
         explicit KVStoreServiceImpl(const ServerConfig& config)
             : wal_(config.log_file), db_("rocksdb_data/" + config.node_id),
-              cache_(config.cache_capacity, config.cache_policy),
-              is_leader_(config.is_leader), node_id_(config.node_id) {
+              cache_(config.cache_capacity, config.cache_policy, config.negative_cache_capacity),
+              hot_keys_(config.hot_key_capacity), pin_hot_keys_(config.pin_hot_keys),
+              is_leader_(config.is_leader), node_id_(config.node_id),
+              advertise_address_(config.advertise_address),
+              put_latency_(MetricsRegistry::Get().histogram("kv_rpc_latency_us", "rpc=\"Put\"")),
+              get_latency_(MetricsRegistry::Get().histogram("kv_rpc_latency_us", "rpc=\"Get\"")),
+              delete_latency_(MetricsRegistry::Get().histogram("kv_rpc_latency_us", "rpc=\"Delete\"")),
+              replicate_put_latency_(MetricsRegistry::Get().histogram("kv_rpc_latency_us", "rpc=\"ReplicatePut\"")),
+              coalesced_reads_(MetricsRegistry::Get().counter("kv_coalesced_reads_total")) {
+            MetricsRegistry& registry = MetricsRegistry::Get();
             for (const std::string& addr : config.follower_addresses) {
                 follower_stubs_.emplace_back(replication::Replication::NewStub(
                     grpc::CreateChannel(addr, grpc::InsecureChannelCredentials())));
+                std::string label = "follower=\"" + addr + "\"";
+                follower_metrics_.push_back({
+                    registry.histogram("kv_replication_latency_us", label),
+                    registry.counter("kv_replication_failures_total", label),
+                    registry.gauge("kv_replication_unacked_writes", label),
+                    registry.gauge("kv_replication_last_ack_ms", label)});
             }
+            // Every write goes through the WAL first, so replaying it covers all existing keys
+            if (config.bloom_filter) cache_.enable_bloom_filter(config.bloom_expected_keys);
             recoverFromLog();
         }
 
@@ -115,15 +232,18 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
             if (!is_leader_) return;
             std::thread([this]() {
                 while (true) {
-                    for (auto& stub : follower_stubs_) {
+                    for (size_t i = 0; i < follower_stubs_.size(); ++i) {
+                        auto& stub = follower_stubs_[i];
                         HeartbeatRequest req;
                         req.set_leader_id(node_id_);
+                        req.set_leader_address(advertise_address_);
                         HeartbeatReply reply;
                         ClientContext ctx;
                         Status status = stub->Heartbeat(&ctx, req, &reply);
                         if (!status.ok()) {
                             std::cerr<<"[Heartbeat] Failed: "<<status.error_message()<<std::endl;
                         } else {
+                            follower_metrics_[i].last_ack_ms.set(unix_ms());
                             std::cerr<<"[Heartbeat] ACK from follower "<<reply.follower_id()<<std::endl;
                         }
                     }
@@ -140,28 +260,47 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
                     cache_.put(entry.key, entry.value);
                 } else {
                     db_.remove(entry.key);
+                    cache_.remove(entry.key);
                 }
             }
             std::cout<<"[WAL] Recovery complete: "<<logs.size()<<" entries replayed.\n";
         }
 
 	    Status Put(ServerContext* context, const PutRequest* request, PutReply* reply) override {
+            ScopedTimer timer(put_latency_);
 		    std::lock_guard<std::mutex> lock(mutex_);
+            if (!is_leader_) {
+                // Followers only take writes through ReplicatePut; point the client at the leader
+                if (leader_address_.empty()) return no_leader_yet();
+                reply->set_success(false);
+                reply->set_leader_hint(leader_address_);
+                return Status::OK;
+            }
 
 			wal_.appendPut(request->key(), request->value());
             db_.put(request->key(), request->value());
+            inflight_.invalidate(request->key());
             cache_.put(request->key(), request->value());
             
             if (is_leader_) {
-                for (auto& stub : follower_stubs_) {
+                for (size_t i = 0; i < follower_stubs_.size(); ++i) {
+                    FollowerMetrics& fm = follower_metrics_[i];
                     ReplicatePutRequest rreq;
                     rreq.set_key(request->key());
                     rreq.set_value(request->value());
                     ReplicatePutReply rrep;
                     ClientContext ctx;
-                    Status s = stub->ReplicatePut(&ctx, rreq, &rrep);
+                    Status s;
+                    {
+                        ScopedTimer rtimer(fm.replicate_latency);
+                        s = follower_stubs_[i]->ReplicatePut(&ctx, rreq, &rrep);
+                    }
                     if (!s.ok()) {
+                        fm.failures.inc();
+                        fm.unacked_writes.add(1);
                         std::cerr<<"[Warning] Failed to replicate to follower: "<<s.error_message()<<"\n";
+                    } else {
+                        fm.last_ack_ms.set(unix_ms());
                     }
                 }
             }
@@ -172,9 +311,11 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
 		}
 
         Status ReplicatePut(ServerContext * context, const ReplicatePutRequest* req, ReplicatePutReply* rep) override {
+            ScopedTimer timer(replicate_put_latency_);
             std::lock_guard<std::mutex> lock(mutex_);
             wal_.appendPut(req->key(), req->value());
             db_.put(req->key(), req->value());
+            inflight_.invalidate(req->key());
             cache_.put(req->key(), req->value());
             rep->set_success(true);
             std::cout<<"[Replicated] "<<req->key()<<" => "<<req->value()<<"\n";
@@ -182,6 +323,10 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
         }
 
         Status Heartbeat(ServerContext* context, const HeartbeatRequest* req, HeartbeatReply* res) override {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                leader_address_ = req->leader_address();
+            }
             res->set_alive(true);
             res->set_follower_id(node_id_);
             std::cout<<"[Heartbeat] Received from leader "<<req->leader_id()<<"\n";
@@ -189,33 +334,73 @@ class KVStoreServiceImpl final : public KVStore::Service, public Replication::Se
         }
 
 		Status Get(ServerContext* context, const GetRequest* request, GetReply* reply) override {
-	        std::lock_guard<std::mutex> lock(mutex_);
-            //std::cout<<"[Get] "<<request->key()<<"||||||||||||||||\n";
-            //cache_.print();
-            auto val = cache_.get(request->key());
-            if (val) {
+            ScopedTimer timer(get_latency_);
+            const std::string& key = request->key();
+            {
+	            std::lock_guard<std::mutex> lock(mutex_);
+                hot_keys_.record(key);
+                if (pin_hot_keys_ > 0 && ++reads_since_repin_ >= kRepinInterval) {
+                    reads_since_repin_ = 0;
+                    std::vector<std::string> hottest;
+                    for (const HotKey& hk : hot_keys_.top(pin_hot_keys_)) hottest.push_back(hk.key);
+                    cache_.set_pinned(hottest);
+                }
+                auto val = cache_.get(key);
+                if (val) {
+                    reply->set_found(true);
+                    reply->set_value(*val);
+                    std::cout<<"[CacheHit]"<<key<<"\n";
+                    return Status::OK;
+                }
+                if (cache_.known_absent(key)) {
+                    reply->set_found(false);
+                    std::cout<<"[NegativeHit] "<<key<<" not Found.\n";
+                    return Status::OK;
+                }
+            }
+
+            bool leader = false;
+            auto call = inflight_.join(key, leader);
+            std::optional<std::string> dval;
+            if (leader) {
+                std::string v;
+                if (db_.get(key, v)) dval = std::move(v);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    // A write that landed while we were reading already updated the cache
+                    if (!call->stale) {
+                        if (dval) cache_.put(key, *dval);
+                        else cache_.put_absent(key);
+                    }
+                }
+                inflight_.finish(key, call, dval);
+            } else {
+                coalesced_reads_.inc();
+                dval = call->result.get();
+            }
+
+            if (dval) {
                 reply->set_found(true);
-                reply->set_value(*val);
-                std::cout<<"[CacheHit]"<<request->key()<<"\n";
+                reply->set_value(*dval);
+                std::cout<<"[DbHit] "<<key<<" => "<<*dval<<(leader ? "" : " (coalesced)")<<"\n";
             } else {
-		        std::string dval;
-                bool dget  = db_.get(request->key(), dval);
-	            if (dget) { 
-		            cache_.put(request->key(), dval);
-                    reply->set_found(true);
-			        reply->set_value(dval);
-			        std::cout<<"[DbHit] "<<request->key()<<" => "<<dval<<"\n";
-			    } else {
-			        reply->set_found(false);
-			        std::cout<<"[Miss] "<<request->key()<<" not Found.\n";
-		        }
+                reply->set_found(false);
+                std::cout<<"[Miss] "<<key<<" not Found.\n";
             }
 			return Status::OK;
 		}
 		Status Delete(ServerContext* context, const DeleteRequest* request, DeleteReply* reply) override {
+            ScopedTimer timer(delete_latency_);
 	        std::lock_guard<std::mutex> lock(mutex_);
+            if (!is_leader_) {
+                if (leader_address_.empty()) return no_leader_yet();
+                reply->set_success(false);
+                reply->set_leader_hint(leader_address_);
+                return Status::OK;
+            }
             wal_.appendDelete(request->key());
 	        bool removed = db_.remove(request->key());
+            inflight_.invalidate(request->key());
             cache_.remove(request->key());
             reply->set_success(removed);
 	        std::cout<<"[Delete] "<<request->key()<<(removed ? " deleted" : " not found")<<"\n";
@@ -239,6 +424,7 @@ int main(int argc, char** argv) {
 
     KVStoreServiceImpl service(config);  // pass as needed
     service.start_heartbeat_loop();
+    if (config.metrics_port > 0) start_metrics_http_server(config.metrics_port);
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(static_cast<kvstore::KVStore::Service*>(&service));
@@ -86,8 +86,10 @@ public:
         return std::nullopt;
     }
 
-    void put(const std::string& key, const std::string& value) {
-        if (capacity == 0) return;
+    // Returns true if inserting the key evicted another one.
+    bool put(const std::string& key, const std::string& value) {
+        bool evicted = false;
+        if (capacity == 0) return false;
         if (map_key.find(key) != map_key.end()) {
             LFUNode* node = map_key[key];
             map_freq[node->freq]->remove(node);
@@ -103,6 +105,7 @@ public:
                     map_key.erase(last->key);
                     map_freq[min_freq]->evict();
                     --size;
+                    evicted = true;
                 }
             }
             LFUNode* node = new LFUNode(key, value);
@@ -112,6 +115,7 @@ public:
             ++size;
             min_freq = 1;
         }
+        return evicted;
     }
 
     void remove(const std::string& key) {
@@ -90,7 +90,9 @@ public:
         return std::nullopt;
     }
 
-    void put(const std::string& key, const std::string& value) {
+    // Returns true if inserting the key evicted another one.
+    bool put(const std::string& key, const std::string& value) {
+        bool evicted = false;
         if (hashmap.find(key) != hashmap.end()) {
             LinkedList* node = hashmap[key];
             node->val = value;
@@ -100,11 +102,13 @@ public:
             LinkedList* newNode = new LinkedList(key, value);
             if (size == capacity) {
                 evictNode();
+                evicted = true;
             }
             hashmap[key] = newNode;
             addNode(newNode);
             ++size;
         }
+        return evicted;
     }
 
     void remove(const std::string& key) {
@@ -0,0 +1,131 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "histogram.h"
+
+// Process-wide metrics. Registration takes a lock, so components look their metrics up once
+// (usually in a constructor) and keep the reference; updates after that are relaxed atomics.
+// Metrics are identified by a Prometheus family name plus an optional label string such as
+// `rpc="Get"`.
+
+class Counter {
+public:
+    void inc(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+class Gauge {
+public:
+    void set(int64_t v) { value_.store(v, std::memory_order_relaxed); }
+    void add(int64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+class MetricsRegistry {
+public:
+    using Key = std::pair<std::string, std::string>; // (family, labels)
+
+    static MetricsRegistry& Get() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    Counter& counter(const std::string& family, const std::string& labels = "") {
+        return lookup(counters_, family, labels);
+    }
+    Gauge& gauge(const std::string& family, const std::string& labels = "") {
+        return lookup(gauges_, family, labels);
+    }
+    LatencyHistogram& histogram(const std::string& family, const std::string& labels = "") {
+        return lookup(histograms_, family, labels);
+    }
+
+    // Visitors for exporters; f(family, labels, metric)
+    template <typename F> void for_each_counter(F f) const { visit(counters_, f); }
+    template <typename F> void for_each_gauge(F f) const { visit(gauges_, f); }
+    template <typename F> void for_each_histogram(F f) const { visit(histograms_, f); }
+
+    static std::string display_name(const std::string& family, const std::string& labels) {
+        return labels.empty() ? family : family + "{" + labels + "}";
+    }
+
+    // Prometheus text exposition format (version 0.0.4). Histograms are folded into
+    // power-of-two `le` buckets so the bucket set is identical between scrapes.
+    std::string prometheus_text() const {
+        std::ostringstream out;
+        std::string last;
+        for_each_counter([&](const std::string& family, const std::string& labels, const Counter& c) {
+            if (family != last) out << "# TYPE " << family << " counter\n";
+            last = family;
+            out << display_name(family, labels) << " " << c.value() << "\n";
+        });
+        for_each_gauge([&](const std::string& family, const std::string& labels, const Gauge& g) {
+            if (family != last) out << "# TYPE " << family << " gauge\n";
+            last = family;
+            out << display_name(family, labels) << " " << g.value() << "\n";
+        });
+        for_each_histogram([&](const std::string& family, const std::string& labels, const LatencyHistogram& h) {
+            if (family != last) out << "# TYPE " << family << " histogram\n";
+            last = family;
+            std::string sep = labels.empty() ? "" : labels + ",";
+            uint64_t cumulative = 0;
+            size_t idx = 0;
+            for (uint64_t le = 1; le <= (1ull << 30); le <<= 1) {
+                while (idx < LatencyHistogram::kNumBuckets && LatencyHistogram::upper_bound(idx) <= le) {
+                    cumulative += h.bucket_count(idx++);
+                }
+                out << family << "_bucket{" << sep << "le=\"" << le << "\"} " << cumulative << "\n";
+            }
+            out << family << "_bucket{" << sep << "le=\"+Inf\"} " << h.count() << "\n";
+            out << display_name(family + "_sum", labels) << " " << h.sum() << "\n";
+            out << display_name(family + "_count", labels) << " " << h.count() << "\n";
+        });
+        return out.str();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::map<Key, std::unique_ptr<Counter>> counters_;
+    std::map<Key, std::unique_ptr<Gauge>> gauges_;
+    std::map<Key, std::unique_ptr<LatencyHistogram>> histograms_;
+
+    MetricsRegistry() = default;
+
+    template <typename T>
+    T& lookup(std::map<Key, std::unique_ptr<T>>& map, const std::string& family, const std::string& labels) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = map[{family, labels}];
+        if (!slot) slot = std::make_unique<T>();
+        return *slot;
+    }
+
+    template <typename T, typename F>
+    void visit(const std::map<Key, std::unique_ptr<T>>& map, F f) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [key, metric] : map) f(key.first, key.second, *metric);
+    }
+};
+
+// Records the lifetime of the enclosing scope, in microseconds, into a histogram.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(LatencyHistogram& hist) : hist_(hist), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        hist_.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_).count());
+    }
+private:
+    LatencyHistogram& hist_;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,68 @@
+#include "metrics_http.h"
+#include "metrics.h"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <cstring>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+// Connections are served one at a time, so a client that connects and sends nothing (or stops
+// reading) is dropped after this long rather than stalling every later scrape
+constexpr int kClientTimeoutSec = 2;
+
+static void serve_one(int client) {
+    timeval timeout{kClientTimeoutSec, 0};
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    char buf[1024];
+    ssize_t n = recv(client, buf, sizeof(buf) - 1, 0);
+    if (n <= 0) return;
+    buf[n] = '\0';
+
+    std::string status = "200 OK", body;
+    if (std::strncmp(buf, "GET /metrics", 12) == 0) {
+        body = MetricsRegistry::Get().prometheus_text();
+    } else {
+        status = "404 Not Found";
+        body = "try /metrics\n";
+    }
+    std::string resp = "HTTP/1.0 " + status + "\r\n"
+                       "Content-Type: text/plain; version=0.0.4\r\n"
+                       "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+    size_t sent = 0;
+    while (sent < resp.size()) {
+        ssize_t w = send(client, resp.data() + sent, resp.size() - sent, MSG_NOSIGNAL);
+        if (w <= 0) break;
+        sent += w;
+    }
+}
+
+bool start_metrics_http_server(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+        std::cerr<<"[Metrics] Failed to listen on port "<<port<<": "<<std::strerror(errno)<<"\n";
+        close(fd);
+        return false;
+    }
+    std::thread([fd]() {
+        while (true) {
+            int client = accept(fd, nullptr, nullptr);
+            if (client < 0) continue;
+            serve_one(client);
+            close(client);
+        }
+    }).detach();
+    std::cout<<"[Metrics] Prometheus endpoint on :"<<port<<"/metrics\n";
+    return true;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// Serves MetricsRegistry::prometheus_text() at GET /metrics on a plain HTTP/1.0 socket,
+// for Prometheus scrapers that cannot speak gRPC. Runs on a detached thread.
+bool start_metrics_http_server(int port);
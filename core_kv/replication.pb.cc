@@ -51,6 +51,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR HeartbeatRequest::HeartbeatRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.leader_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leader_address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct HeartbeatRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR HeartbeatRequestDefaultTypeInternal()
@@ -103,6 +104,7 @@ const uint32_t TableStruct_replication_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::replication::HeartbeatRequest, _impl_.leader_id_),
+  PROTOBUF_FIELD_OFFSET(::replication::HeartbeatRequest, _impl_.leader_address_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::replication::HeartbeatReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -116,7 +118,7 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 0, -1, -1, sizeof(::replication::ReplicatePutRequest)},
   { 8, -1, -1, sizeof(::replication::ReplicatePutReply)},
   { 15, -1, -1, sizeof(::replication::HeartbeatRequest)},
-  { 22, -1, -1, sizeof(::replication::HeartbeatReply)},
+  { 23, -1, -1, sizeof(::replication::HeartbeatReply)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -130,17 +132,18 @@ const char descriptor_table_protodef_replication_2eproto[] PROTOBUF_SECTION_VARI
   "\n\021replication.proto\022\013replication\"1\n\023Repl"
   "icatePutRequest\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 "
   "\001(\t\"$\n\021ReplicatePutReply\022\017\n\007success\030\001 \001("
-  "\010\"%\n\020HeartbeatRequest\022\021\n\tleader_id\030\001 \001(\t"
-  "\"4\n\016HeartbeatReply\022\r\n\005alive\030\001 \001(\010\022\023\n\013fol"
-  "lower_id\030\002 \001(\t2\250\001\n\013Replication\022P\n\014Replic"
-  "atePut\022 .replication.ReplicatePutRequest"
-  "\032\036.replication.ReplicatePutReply\022G\n\tHear"
-  "tbeat\022\035.replication.HeartbeatRequest\032\033.r"
-  "eplication.HeartbeatReplyb\006proto3"
+  "\010\"=\n\020HeartbeatRequest\022\021\n\tleader_id\030\001 \001(\t"
+  "\022\026\n\016leader_address\030\002 \001(\t\"4\n\016HeartbeatRep"
+  "ly\022\r\n\005alive\030\001 \001(\010\022\023\n\013follower_id\030\002 \001(\t2\250"
+  "\001\n\013Replication\022P\n\014ReplicatePut\022 .replica"
+  "tion.ReplicatePutRequest\032\036.replication.R"
+  "eplicatePutReply\022G\n\tHeartbeat\022\035.replicat"
+  "ion.HeartbeatRequest\032\033.replication.Heart"
+  "beatReplyb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_replication_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_replication_2eproto = {
-    false, false, 393, descriptor_table_protodef_replication_2eproto,
+    false, false, 417, descriptor_table_protodef_replication_2eproto,
     "replication.proto",
     &descriptor_table_replication_2eproto_once, nullptr, 0, 4,
     schemas, file_default_instances, TableStruct_replication_2eproto::offsets,
@@ -603,6 +606,7 @@ HeartbeatRequest::HeartbeatRequest(const HeartbeatRequest& from)
   HeartbeatRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.leader_id_){}
+    , decltype(_impl_.leader_address_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -614,6 +618,14 @@ HeartbeatRequest::HeartbeatRequest(const HeartbeatRequest& from)
     _this->_impl_.leader_id_.Set(from._internal_leader_id(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.leader_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leader_address().empty()) {
+    _this->_impl_.leader_address_.Set(from._internal_leader_address(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:replication.HeartbeatRequest)
 }
 
@@ -623,12 +635,17 @@ inline void HeartbeatRequest::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.leader_id_){}
+    , decltype(_impl_.leader_address_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.leader_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.leader_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.leader_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HeartbeatRequest::~HeartbeatRequest() {
@@ -643,6 +660,7 @@ HeartbeatRequest::~HeartbeatRequest() {
 inline void HeartbeatRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.leader_id_.Destroy();
+  _impl_.leader_address_.Destroy();
 }
 
 void HeartbeatRequest::SetCachedSize(int size) const {
@@ -656,6 +674,7 @@ void HeartbeatRequest::Clear() {
   (void) cached_has_bits;
 
   _impl_.leader_id_.ClearToEmpty();
+  _impl_.leader_address_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -675,6 +694,16 @@ const char* HeartbeatRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // string leader_address = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_leader_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "replication.HeartbeatRequest.leader_address"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -714,6 +743,16 @@ uint8_t* HeartbeatRequest::_InternalSerialize(
         1, this->_internal_leader_id(), target);
   }
 
+  // string leader_address = 2;
+  if (!this->_internal_leader_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leader_address().data(), static_cast<int>(this->_internal_leader_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "replication.HeartbeatRequest.leader_address");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_leader_address(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -737,6 +776,13 @@ size_t HeartbeatRequest::ByteSizeLong() const {
         this->_internal_leader_id());
   }
 
+  // string leader_address = 2;
+  if (!this->_internal_leader_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leader_address());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -758,6 +804,9 @@ void HeartbeatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (!from._internal_leader_id().empty()) {
     _this->_internal_set_leader_id(from._internal_leader_id());
   }
+  if (!from._internal_leader_address().empty()) {
+    _this->_internal_set_leader_address(from._internal_leader_address());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -781,6 +830,10 @@ void HeartbeatRequest::InternalSwap(HeartbeatRequest* other) {
       &_impl_.leader_id_, lhs_arena,
       &other->_impl_.leader_id_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leader_address_, lhs_arena,
+      &other->_impl_.leader_address_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata HeartbeatRequest::GetMetadata() const {
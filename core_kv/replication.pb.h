@@ -507,6 +507,7 @@ class HeartbeatRequest final :
 
   enum : int {
     kLeaderIdFieldNumber = 1,
+    kLeaderAddressFieldNumber = 2,
   };
   // string leader_id = 1;
   void clear_leader_id();
@@ -522,6 +523,20 @@ class HeartbeatRequest final :
   std::string* _internal_mutable_leader_id();
   public:
 
+  // string leader_address = 2;
+  void clear_leader_address();
+  const std::string& leader_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_address();
+  PROTOBUF_NODISCARD std::string* release_leader_address();
+  void set_allocated_leader_address(std::string* leader_address);
+  private:
+  const std::string& _internal_leader_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_address(const std::string& value);
+  std::string* _internal_mutable_leader_address();
+  public:
+
   // @@protoc_insertion_point(class_scope:replication.HeartbeatRequest)
  private:
   class _Internal;
@@ -531,6 +546,7 @@ class HeartbeatRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_address_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -889,6 +905,56 @@ inline void HeartbeatRequest::set_allocated_leader_id(std::string* leader_id) {
   // @@protoc_insertion_point(field_set_allocated:replication.HeartbeatRequest.leader_id)
 }
 
+// string leader_address = 2;
+inline void HeartbeatRequest::clear_leader_address() {
+  _impl_.leader_address_.ClearToEmpty();
+}
+inline const std::string& HeartbeatRequest::leader_address() const {
+  // @@protoc_insertion_point(field_get:replication.HeartbeatRequest.leader_address)
+  return _internal_leader_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HeartbeatRequest::set_leader_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:replication.HeartbeatRequest.leader_address)
+}
+inline std::string* HeartbeatRequest::mutable_leader_address() {
+  std::string* _s = _internal_mutable_leader_address();
+  // @@protoc_insertion_point(field_mutable:replication.HeartbeatRequest.leader_address)
+  return _s;
+}
+inline const std::string& HeartbeatRequest::_internal_leader_address() const {
+  return _impl_.leader_address_.Get();
+}
+inline void HeartbeatRequest::_internal_set_leader_address(const std::string& value) {
+  
+  _impl_.leader_address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HeartbeatRequest::_internal_mutable_leader_address() {
+  
+  return _impl_.leader_address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HeartbeatRequest::release_leader_address() {
+  // @@protoc_insertion_point(field_release:replication.HeartbeatRequest.leader_address)
+  return _impl_.leader_address_.Release();
+}
+inline void HeartbeatRequest::set_allocated_leader_address(std::string* leader_address) {
+  if (leader_address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_address_.SetAllocated(leader_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_address_.IsDefault()) {
+    _impl_.leader_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:replication.HeartbeatRequest.leader_address)
+}
+
 // -------------------------------------------------------------------
 
 // HeartbeatReply
@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Coalesces concurrent loads of the same key: the first caller becomes the leader and does
+// the work, everyone arriving while it runs waits for the leader's result instead of
+// issuing their own. Writers call invalidate() so a load that raced with them is neither
+// joined by later readers nor allowed to fill the cache with its (older) result.
+template <typename Key, typename Value>
+class SingleFlight {
+public:
+    struct Call {
+        std::promise<Value> promise;
+        std::shared_future<Value> result;
+        std::atomic<bool> stale{false};
+        Call() : result(promise.get_future().share()) {}
+    };
+    using CallPtr = std::shared_ptr<Call>;
+
+    // Returns the in-flight call for key, creating it if needed. `leader` tells the caller
+    // whether it must perform the load and then call finish().
+    CallPtr join(const Key& key, bool& leader) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = calls_.find(key);
+        if (it != calls_.end()) {
+            leader = false;
+            return it->second;
+        }
+        leader = true;
+        auto call = std::make_shared<Call>();
+        calls_.emplace(key, call);
+        return call;
+    }
+
+    void finish(const Key& key, const CallPtr& call, Value value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = calls_.find(key);
+            if (it != calls_.end() && it->second == call) calls_.erase(it);
+        }
+        call->promise.set_value(std::move(value));
+    }
+
+    void invalidate(const Key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = calls_.find(key);
+        if (it == calls_.end()) return;
+        it->second->stale = true;
+        calls_.erase(it);
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<Key, CallPtr> calls_;
+};
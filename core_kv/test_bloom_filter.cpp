@@ -0,0 +1,35 @@
+#include <iostream>
+#include <cassert>
+#include "bloom_filter.h"
+#include "cache_controller.h"
+
+int main() {
+    const int N = 100000;
+    BloomFilter bloom(N, 0.01);
+    for (int i = 0; i < N; ++i) bloom.add("key" + std::to_string(i));
+
+    // No false negatives, ever
+    for (int i = 0; i < N; ++i) assert(bloom.may_contain("key" + std::to_string(i)));
+
+    int false_positives = 0;
+    for (int i = N; i < 2 * N; ++i) {
+        if (bloom.may_contain("key" + std::to_string(i))) ++false_positives;
+    }
+    double fp_rate = 100.0 * false_positives / N;
+    std::cout << "[Bloom] " << bloom.num_bits() << " bits, " << bloom.num_hashes() << " hashes, "
+              << "false positive rate " << fp_rate << "%\n";
+    assert(fp_rate < 2.0);
+
+    // Negative cache: remembered after a miss, forgotten once the key is written
+    CacheController cache(10, CachePolicy::LRU, 10);
+    cache.enable_bloom_filter(100);
+    assert(cache.known_absent("ghost"));   // never written: bloom says no
+    cache.put("k1", "v1");
+    assert(!cache.known_absent("k1"));
+    cache.remove("k1");
+    assert(cache.known_absent("k1"));      // deleted: negative cache says no
+    cache.put("k1", "v2");
+    assert(!cache.known_absent("k1"));
+    std::cout << "[NegativeCache] OK\n";
+    return 0;
+}
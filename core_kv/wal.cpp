@@ -4,7 +4,10 @@
 #include <cstdio>
 #include <iostream>
 
-WAL::WAL(const std::string& filename) {
+WAL::WAL(const std::string& filename)
+    : filename_(filename),
+      append_latency_(MetricsRegistry::Get().histogram("kv_wal_append_latency_us")),
+      sync_latency_(MetricsRegistry::Get().histogram("kv_wal_sync_latency_us")) {
     logfile_.open(filename, std::ios::app); // append mode
 }
 
@@ -13,14 +16,18 @@ WAL::~WAL() {
 }
 
 void WAL::appendPut(const std::string& key, const std::string& value) {
+    ScopedTimer timer(append_latency_);
     std::lock_guard<std::mutex> lock(mutex_);
     logfile_ << "PUT " << key << " " << value << "\n";
+    ScopedTimer sync(sync_latency_);
     logfile_.flush();
 }
 
 void WAL::appendDelete(const std::string& key) {
+    ScopedTimer timer(append_latency_);
     std::lock_guard<std::mutex> lock(mutex_);
     logfile_ << "DELETE " << key << "\n";
+    ScopedTimer sync(sync_latency_);
     logfile_.flush();
 }
 
@@ -49,13 +56,13 @@ WALEntry WALEntry::deserialize(const std::string& line) {
 std::vector<WALEntry> WAL::recover() {
     std::vector<WALEntry> entries;
     
-    std::ifstream infile("wal.log");
+    std::ifstream infile(filename_);
     if (!infile.is_open()) {
-        std::cerr<<"[WAL] Failed to open wal.log for recovery\n";
+        std::cerr<<"[WAL] Failed to open "<<filename_<<" for recovery\n";
         return entries;
     }
 
-    std::cout<<"Reading wal.log now\n";
+    std::cout<<"Reading "<<filename_<<" now\n";
     std::string line;
     while (std::getline(infile, line)) {
         if (!line.empty())
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <mutex>
 #include <vector>
+#include "metrics.h"
 
 enum class WALAction { PUT, DELETE };
 
@@ -25,6 +26,9 @@ public:
     std::vector<WALEntry> recover();
 
 private:
+    std::string filename_;
     std::ofstream logfile_;
     std::mutex mutex_;
+    LatencyHistogram& append_latency_; // whole append incl. flush, microseconds
+    LatencyHistogram& sync_latency_;   // flush to the OS only
 };
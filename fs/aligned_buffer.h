@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "stat.h"
+
+// O_DIRECT requires buffer addresses, lengths and file offsets aligned to the device's
+// logical block size; aligning to the FS block covers every device we run on.
+constexpr size_t DIRECT_IO_ALIGNMENT = BLOCK_SIZE;
+
+struct FreeDeleter {
+    void operator()(char* p) const { std::free(p); }
+};
+using AlignedPtr = std::unique_ptr<char[], FreeDeleter>;
+
+inline AlignedPtr make_aligned(size_t bytes) {
+    void* p = nullptr;
+    if (posix_memalign(&p, DIRECT_IO_ALIGNMENT, bytes) != 0) throw std::bad_alloc();
+    return AlignedPtr((char*)p);
+}
+
+inline bool is_direct_aligned(const void* p, size_t len) {
+    return ((uintptr_t)p % DIRECT_IO_ALIGNMENT) == 0 && (len % DIRECT_IO_ALIGNMENT) == 0;
+}
+
+// Recycles equally sized aligned buffers so steady-state caching does no allocation.
+class AlignedBufferPool {
+public:
+    explicit AlignedBufferPool(size_t buffer_size) : buffer_size_(buffer_size) {}
+
+    AlignedPtr acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_.empty()) {
+                AlignedPtr buf = std::move(free_.back());
+                free_.pop_back();
+                return buf;
+            }
+        }
+        return make_aligned(buffer_size_);
+    }
+
+    void release(AlignedPtr buf) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(std::move(buf));
+    }
+
+    size_t buffer_size() const { return buffer_size_; }
+
+private:
+    size_t buffer_size_;
+    std::mutex mutex_;
+    std::vector<AlignedPtr> free_;
+};
+
+// Move-only handle to one pooled buffer; hands it back to the pool when destroyed.
+class BlockBuffer {
+public:
+    BlockBuffer() = default;
+    explicit BlockBuffer(AlignedBufferPool& pool) : pool_(&pool), buf_(pool.acquire()) {}
+    BlockBuffer(BlockBuffer&& other) noexcept = default;
+    BlockBuffer& operator=(BlockBuffer&& other) noexcept {
+        if (this != &other) {
+            reset();
+            pool_ = other.pool_;
+            buf_ = std::move(other.buf_);
+        }
+        return *this;
+    }
+    ~BlockBuffer() { reset(); }
+
+    char* data() { return buf_.get(); }
+    const char* data() const { return buf_.get(); }
+    size_t size() const { return buf_ ? pool_->buffer_size() : 0; }
+
+private:
+    AlignedBufferPool* pool_ = nullptr;
+    AlignedPtr buf_;
+
+    void reset() {
+        if (buf_) pool_->release(std::move(buf_));
+    }
+};
@@ -0,0 +1,129 @@
+#include "bitmap.h"
+#include <algorithm>
+#include <cstring>
+
+void Bitmap::assign(uint64_t bits) {
+    bits_ = bits;
+    hint_ = 0;
+    words_.assign((bits + 63) / 64, 0);
+    full_.assign((words_.size() + 63) / 64, 0);
+    mark_tail();
+}
+
+// Bits past the end are kept set, and so are the summary bits of words that do not exist,
+// so searches never need a bounds check inside a word
+void Bitmap::mark_tail() {
+    if (bits_ % 64) words_.back() |= ~0ull << (bits_ % 64);
+    if (!words_.empty() && words_.back() == ~0ull) full_.back() |= 1ull << ((words_.size() - 1) % 64);
+    if (words_.size() % 64) full_.back() |= ~0ull << (words_.size() % 64);
+}
+
+uint64_t Bitmap::find_clear_in(uint64_t begin, uint64_t end) const {
+    if (begin >= end) return npos;
+    uint64_t w = begin / 64;
+    uint64_t free_bits = ~words_[w] & (~0ull << (begin % 64));
+    while (!free_bits) {
+        // Next word with a clear bit, found through the summary of full words
+        ++w;
+        uint64_t s = w / 64;
+        if (s >= full_.size()) return npos;
+        uint64_t open = ~full_[s] & (~0ull << (w % 64));
+        while (!open) {
+            if (++s >= full_.size() || s * 64 * 64 >= end) return npos;
+            open = ~full_[s];
+        }
+        w = s * 64 + __builtin_ctzll(open);
+        if (w * 64 >= end) return npos;
+        free_bits = ~words_[w];
+    }
+    uint64_t i = w * 64 + __builtin_ctzll(free_bits);
+    return i < end ? i : npos;
+}
+
+uint64_t Bitmap::find_clear(uint64_t lo, uint64_t from) const {
+    from = std::max(from, lo);
+    uint64_t i = find_clear_in(from, bits_);
+    return i != npos ? i : find_clear_in(lo, from);
+}
+
+uint64_t Bitmap::alloc(uint64_t lo) {
+    uint64_t i = find_clear(lo, hint_ < bits_ ? hint_ : lo);
+    if (i == npos) return npos;
+    set(i);
+    hint_ = i + 1;
+    return i;
+}
+
+uint64_t Bitmap::run_length(uint64_t i, uint64_t max) const {
+    uint64_t n = 0;
+    while (n < max && i < bits_) {
+        uint64_t used = words_[i / 64] >> (i % 64);
+        if (used) return std::min(max, n + __builtin_ctzll(used));
+        n += 64 - i % 64;
+        i += 64 - i % 64;
+    }
+    return std::min(n, max);
+}
+
+uint64_t Bitmap::alloc_run(uint64_t lo, uint64_t goal, uint64_t want, uint64_t gap, uint64_t& got) {
+    got = 0;
+    if (want == 0) return npos;
+    uint64_t from = goal >= lo && goal < bits_ ? goal : (hint_ >= lo && hint_ < bits_ ? hint_ : lo);
+    uint64_t best = npos, best_len = 0;
+    // Free runs from `from` to the end, then from lo back up to `from`
+    uint64_t i = find_clear_in(from, bits_);
+    bool wrapped = false;
+    if (i == npos) {
+        i = find_clear_in(lo, from);
+        wrapped = true;
+    }
+    bool best_roomy = false;
+    for (int probe = 0; i != npos && probe < ALLOC_RUN_PROBES; ++probe) {
+        uint64_t len = run_length(i, want + gap);
+        // Away from the goal, a run with room for the gap beats one that merely fits
+        bool roomy = gap != 0 && i != goal && len == want + gap;
+        uint64_t take = std::min(len, want);
+        if (take > best_len || (take == best_len && roomy && !best_roomy)) {
+            best = roomy ? i + gap : i;
+            best_len = take;
+            best_roomy = roomy;
+        }
+        if (take == want && (roomy || gap == 0 || i == goal)) break;
+        i = find_clear_in(i + len, wrapped ? from : bits_);
+        if (i == npos && !wrapped) {
+            i = find_clear_in(lo, from);
+            wrapped = true;
+        }
+    }
+    if (best == npos) return npos;
+    for (uint64_t b = best; b < best + best_len; ++b) set(b);
+    hint_ = best + best_len;
+    got = best_len;
+    return best;
+}
+
+uint64_t Bitmap::count_set() const {
+    uint64_t n = 0;
+    for (uint64_t w : words_) n += __builtin_popcountll(w);
+    return n - (words_.size() * 64 - bits_); // the tail bits are set too
+}
+
+void Bitmap::store_block(uint64_t b, char* out) const {
+    std::memset(out, 0, BLOCK_SIZE);
+    size_t first = b * BITS_PER_BLOCK / 64;
+    if (first >= words_.size()) return;
+    size_t n = std::min<size_t>(BLOCK_SIZE / 8, words_.size() - first);
+    std::memcpy(out, words_.data() + first, n * 8);
+}
+
+void Bitmap::load_block(uint64_t b, const char* in) {
+    size_t first = b * BITS_PER_BLOCK / 64;
+    if (first >= words_.size()) return;
+    size_t n = std::min<size_t>(BLOCK_SIZE / 8, words_.size() - first);
+    std::memcpy(words_.data() + first, in, n * 8);
+    for (size_t w = first; w < first + n; ++w) {
+        if (words_[w] == ~0ull) full_[w / 64] |= 1ull << (w % 64);
+        else full_[w / 64] &= ~(1ull << (w % 64));
+    }
+    mark_tail();
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "stat.h"
+
+constexpr uint64_t BITS_PER_BLOCK = (uint64_t)BLOCK_SIZE * 8;
+
+inline uint64_t bitmap_blocks(uint64_t bits) { return (bits + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK; }
+
+// Allocation bitmap (bit set = in use) kept as 64-bit words, the same layout it has on disk.
+// A second level marks the words that are completely full, so a search skips 4096 used bits
+// per word it looks at and stays cheap on a nearly full image. Bits past size() read as used.
+class Bitmap {
+public:
+    static constexpr uint64_t npos = UINT64_MAX;
+
+    // `bits` bits, all clear
+    void assign(uint64_t bits);
+    uint64_t size() const { return bits_; }
+
+    bool test(uint64_t i) const { return words_[i / 64] >> (i % 64) & 1; }
+    void set(uint64_t i) {
+        uint64_t w = i / 64;
+        words_[w] |= 1ull << (i % 64);
+        if (words_[w] == ~0ull) full_[w / 64] |= 1ull << (w % 64);
+    }
+    void clear(uint64_t i) {
+        uint64_t w = i / 64;
+        words_[w] &= ~(1ull << (i % 64));
+        full_[w / 64] &= ~(1ull << (w % 64));
+    }
+
+    // First clear bit at or after `from`, wrapping around to `lo`; npos if there is none
+    uint64_t find_clear(uint64_t lo, uint64_t from) const;
+    // Sets and returns the first clear bit from where the previous alloc left off, so
+    // successive allocations walk the bitmap once instead of rescanning its used prefix
+    uint64_t alloc(uint64_t lo);
+    // Sets and returns the start of a run of up to `want` clear bits, its length in `got`. The
+    // run starts at `goal` if that bit is clear; otherwise the first free runs after it (or
+    // after the alloc hint when goal is 0) are tried, up to ALLOC_RUN_PROBES of them, and the
+    // first one long enough wins, else the longest. Away from the goal, runs with `gap` more
+    // bits to spare are preferred and entered that far in, so whatever ends just before one
+    // can still grow in place. npos if no bit is clear.
+    uint64_t alloc_run(uint64_t lo, uint64_t goal, uint64_t want, uint64_t gap, uint64_t& got);
+    // Clear bits starting at i, counting no further than max
+    uint64_t run_length(uint64_t i, uint64_t max) const;
+    uint64_t count_set() const;
+
+    // On-disk form: block b of the bitmap holds bits [b * BITS_PER_BLOCK, (b + 1) * BITS_PER_BLOCK)
+    void store_block(uint64_t b, char* out) const;
+    void load_block(uint64_t b, const char* in);
+    // Copies just the words holding bits [bit, bit + count) into their bitmap block; the range
+    // must not cross into the next block
+    void store_words(uint64_t bit, uint64_t count, char* block) const {
+        uint64_t first = bit / 64, last = (bit + count - 1) / 64;
+        std::memcpy(block + (bit % BITS_PER_BLOCK) / 64 * 8, &words_[first], (last - first + 1) * 8);
+    }
+
+private:
+    uint64_t bits_ = 0;
+    uint64_t hint_ = 0;
+    std::vector<uint64_t> words_;
+    std::vector<uint64_t> full_; // bit w: words_[w] is all ones
+
+    uint64_t find_clear_in(uint64_t begin, uint64_t end) const;
+    void mark_tail();
+};
@@ -3,69 +3,672 @@
 #include <memory>
 #include <cstring>
 #include <mutex>
+#include <iostream>
+#include <algorithm>
 
-BlockCacheController::BlockCacheController(
+// Below this many blocks per shard the per-shard LRU order strays too far from a global one
+static constexpr size_t MIN_SHARD_BLOCKS = 64;
+
+BlockCache::BlockCache(
     size_t capacity_blocks,
     size_t block_size,
-    std::shared_ptr<Disk> disk) : 
+    CachePolicy policy,
+    size_t shards,
+    const WritebackPolicy& writeback) : 
     capacity_blocks_(capacity_blocks),
     block_size_(block_size),
-    disk_(disk),
-    cache_(capacity_blocks) {}
+    policy_(policy),
+    pool_(block_size),
+    writeback_(writeback) {
+    if (shards == 0) {
+        shards = 1;
+        while (shards * 2 <= (size_t)CACHE_SHARDS && shards * 2 * MIN_SHARD_BLOCKS <= capacity_blocks) shards *= 2;
+    }
+    size_t per_shard = std::max<size_t>(1, (capacity_blocks + shards - 1) / shards);
+    for (size_t i = 0; i < shards; ++i) shards_.push_back(std::make_unique<Shard>(per_shard, policy));
+
+    background_limit_ = std::max<size_t>(1, capacity_blocks * writeback_.background_percent / 100);
+    hard_limit_ = std::max(background_limit_ + 1, capacity_blocks * writeback_.limit_percent / 100);
+    if (writeback_.background) flusher_ = std::thread([this] { flusherLoop(); });
+}
+
+BlockCache::~BlockCache() {
+    if (flusher_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lk(flusher_mutex_);
+            flusher_stop_ = true;
+        }
+        flusher_wake_.notify_one();
+        flusher_done_.notify_all();
+        flusher_.join();
+    }
+}
+
+std::unique_ptr<BlockCache::Mount> BlockCache::attach(std::shared_ptr<Disk> disk, size_t reserved, size_t quota) {
+    if (disk->disk_get_num_blocks() > CACHE_BLOCK_MASK + 1) return nullptr;
+    std::lock_guard<std::mutex> lk(mounts_mutex_);
+    if (reserved > capacity_blocks_ - reserved_) return nullptr;
+    reserved_ += reserved;
+    auto m = std::make_unique<Mount>();
+    m->id = next_mount_id_++;
+    m->disk = std::move(disk);
+    m->reserved = reserved;
+    m->quota = quota == 0 ? capacity_blocks_ : std::max(quota, reserved);
+    return m;
+}
+
+void BlockCache::detach(Mount& m) {
+    {
+        std::unique_lock<std::mutex> lk(prefetch_mutex_);
+        prefetch_done_.wait(lk, [&m] { return m.prefetching == 0; });
+    }
+    flush(m);
+    // Holding this keeps flusher passes, which pin the blocks they write, out of the way
+    std::lock_guard<std::mutex> serial(writeback_mutex_);
+    for (auto& shard : shards_) {
+        Shard& s = *shard;
+        std::unique_lock<std::mutex> lock(s.mutex);
+        for (;;) {
+            // Another mount's eviction may still be writing one of ours back
+            bool busy = false;
+            std::vector<BlockKey> keys;
+            for (auto& [key, e] : s.entries) {
+                if (e.mount != &m) continue;
+                if (e.pins > 0) busy = true;
+                else keys.push_back(key);
+            }
+            for (BlockKey key : keys) {
+                BlockEntry* e = find(s, key);
+                if (e->dirty) {
+                    std::cerr<<"[BlockCache] dropping unwritten block "<<blockOf(key)<<"\n";
+                    setDirty(e, false);
+                }
+                erase(s, key);
+            }
+            if (!busy) break;
+            s.settled.wait(lock);
+        }
+    }
+    std::lock_guard<std::mutex> lk(mounts_mutex_);
+    reserved_ -= m.reserved;
+}
+
+BlockCacheController::BlockCacheController(
+    size_t capacity_blocks,
+    size_t block_size,
+    std::shared_ptr<Disk> disk,
+    CachePolicy policy,
+    size_t shards,
+    const WritebackPolicy& writeback) :
+    cache_(std::make_shared<BlockCache>(capacity_blocks, block_size, policy, shards, writeback)),
+    mount_(cache_->attach(std::move(disk), 0, 0)),
+    shared_(false) {}
+
+std::shared_ptr<BlockCacheController> BlockCacheController::attach(
+    std::shared_ptr<BlockCache> cache, std::shared_ptr<Disk> disk, size_t reserved, size_t quota) {
+    std::unique_ptr<BlockCache::Mount> mount = cache->attach(std::move(disk), reserved, quota);
+    if (!mount) return nullptr;
+    return std::shared_ptr<BlockCacheController>(new BlockCacheController(std::move(cache), std::move(mount), true));
+}
+
+BlockRef& BlockRef::operator=(BlockRef&& other) noexcept {
+    if (this != &other) {
+        release();
+        owner_ = std::exchange(other.owner_, nullptr);
+        key_ = other.key_;
+        data_ = std::exchange(other.data_, nullptr);
+        dirty_ = std::exchange(other.dirty_, false);
+    }
+    return *this;
+}
+
+void BlockRef::release() {
+    if (!owner_) return;
+    owner_->unpin(key_, dirty_);
+    owner_ = nullptr;
+    data_ = nullptr;
+    dirty_ = false;
+}
+
+const char* block_kind_name(BlockKind kind) {
+    switch (kind) {
+        case BlockKind::Data: return "data";
+        case BlockKind::Inode: return "inode";
+        case BlockKind::Indirect: return "indirect";
+        case BlockKind::Dir: return "dir";
+        case BlockKind::Bitmap: return "bitmap";
+    }
+    return "?";
+}
+
+BlockCache::Shard& BlockCache::shardFor(BlockKey key) {
+    // Fibonacci hashing spreads consecutive groups (and mounts) over the shards
+    uint64_t group = key / MAX_IO_BLOCKS;
+    return *shards_[(group * 0x9E3779B97F4A7C15ULL >> 32) % shards_.size()];
+}
+
+// Entry bookkeeping; the shard lock is held. Every entry is known to the shard's policy from
+// insert to erase, and the shard and its mount count it (and the metadata ones).
+BlockCache::BlockEntry* BlockCache::find(Shard& s, BlockKey key) {
+    auto it = s.entries.find(key);
+    return it == s.entries.end() ? nullptr : &it->second;
+}
+
+// Adds a Loading entry, pinned by the caller
+BlockCache::BlockEntry* BlockCache::insert(Shard& s, BlockKey key, Mount& m, BlockKind kind) {
+    BlockEntry& e = s.entries.emplace(key, BlockEntry{BlockBuffer(pool_), false, 1, BlockState::Loading}).first->second;
+    e.kind = kind;
+    e.mount = &m;
+    ++m.resident;
+    if (is_metadata(kind)) {
+        ++s.metadata;
+        ++m.metadata;
+    }
+    s.policy->insert(key);
+    return &e;
+}
+
+void BlockCache::erase(Shard& s, BlockKey key) {
+    auto it = s.entries.find(key);
+    Mount& m = *it->second.mount;
+    --m.resident;
+    if (is_metadata(it->second.kind)) {
+        --s.metadata;
+        --m.metadata;
+    }
+    s.policy->remove(key);
+    s.entries.erase(it);
+}
+
+// A hit. The block takes the kind of its latest use, since a freed block can come back as
+// another kind. A prefetched block's first use is the read readahead anticipated, not a re-reference.
+void BlockCache::touch(Shard& s, BlockKey key, BlockEntry* e, BlockKind kind) {
+    if (is_metadata(e->kind) != is_metadata(kind)) {
+        if (is_metadata(kind)) {
+            ++s.metadata;
+            ++e->mount->metadata;
+        } else {
+            --s.metadata;
+            --e->mount->metadata;
+        }
+    }
+    e->kind = kind;
+    if (e->prefetched) {
+        e->prefetched = false;
+        e->mount->stats.prefetch_hits.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        s.policy->access(key);
+    }
+}
+
+// Demand accesses only; prefetch and writeback do not count
+void BlockCache::countAccess(Mount& m, uint64_t block, BlockKind kind, bool hit) {
+    (hit ? m.stats.of(kind).hits : m.stats.of(kind).misses).fetch_add(1, std::memory_order_relaxed);
+    m.stats.hit_rate_curve.access(block);
+}
+
+std::pair<size_t, size_t> BlockCache::residentBlocks() {
+    size_t blocks = 0, metadata = 0;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        blocks += shard->entries.size();
+        metadata += shard->metadata;
+    }
+    return {blocks, metadata};
+}
+
+// Returns the entry for key with a pin taken, reading it from disk first if needed. A read
+// already in flight on another thread is waited for rather than repeated. With load = false the
+// caller is about to overwrite the whole block, so a miss reads nothing. nullptr if the read fails.
+BlockCache::BlockEntry* BlockCache::acquire(
+    Shard& s, std::unique_lock<std::mutex>& lock, Mount& m, BlockKey key, bool load, BlockKind kind) {
+    BlockEntry* e = find(s, key);
+    if (!e) {
+        makeRoom(s, lock, m, 1);
+        e = find(s, key); // the lock may have been dropped for a writeback
+    }
+    countAccess(m, blockOf(key), kind, e != nullptr);
+    if (!e) {
+        e = insert(s, key, m, kind);
+        if (!load) {
+            e->state = BlockState::Ready;
+            return e;
+        }
+        return loadEntry(s, lock, key, e);
+    }
+    ++e->pins;
+    touch(s, key, e, kind);
+    s.settled.wait(lock, [e] { return e->state != BlockState::Loading; });
+    if (e->state == BlockState::Ready) return e;
+    // The previous read failed: try again ourselves, or just take the entry over for an overwrite
+    if (!load) {
+        e->state = BlockState::Ready;
+        s.settled.notify_all();
+        return e;
+    }
+    e->state = BlockState::Loading;
+    return loadEntry(s, lock, key, e);
+}
+
+// e is Loading and pinned by the caller. Its buffer can be filled with the shard unlocked;
+// nobody else touches a Loading entry.
+BlockCache::BlockEntry* BlockCache::loadEntry(
+    Shard& s, std::unique_lock<std::mutex>& lock, BlockKey key, BlockEntry* e) {
+    Mount& m = *e->mount;
+    lock.unlock();
+    auto start = Clock::now();
+    int err = m.disk->disk_pread(blockOf(key), e->data.data());
+    m.stats.miss_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+    lock.lock();
+    e->state = err == 0 ? BlockState::Ready : BlockState::Failed;
+    s.settled.notify_all();
+    if (err == 0) return e;
+    std::cerr<<"[BlockCache] read of block "<<blockOf(key)<<" failed: "<<std::strerror(-err)<<"\n";
+    release(s, key, e, false);
+    return nullptr;
+}
 
-const std::vector<char>& BlockCacheController::getBlock(uint64_t block_num) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    BlockKey key = block_num;
-    if (cache_.contains(key)) {
-        return cache_.get(key).data;
+// Drops a pin. A failed entry disappears with its last pin so the next access retries the read.
+void BlockCache::release(Shard& s, BlockKey key, BlockEntry* e, bool dirty) {
+    --e->pins;
+    if (dirty) setDirty(e, true);
+    if (e->pins == 0 && e->state == BlockState::Failed) erase(s, key);
+}
+
+// All dirty-flag changes go through here (under the shard lock) to keep the dirty counts exact.
+void BlockCache::setDirty(BlockEntry* e, bool dirty) {
+    if (e->dirty == dirty) return;
+    e->dirty = dirty;
+    if (!dirty) {
+        --e->mount->dirty;
+        --dirty_blocks_;
+        return;
+    }
+    e->dirtied = Clock::now();
+    ++e->mount->dirty;
+    // Wake the flusher as the background share is crossed, not on every write past it
+    if (++dirty_blocks_ == background_limit_ + 1 && flusher_.joinable()) kickFlusher();
+}
+
+BlockRef BlockCache::pinBlock(Mount& m, uint64_t block_num, BlockKind kind, bool zero_fill) {
+    BlockKey key = keyOf(m, block_num);
+    Shard& s = shardFor(key);
+    std::unique_lock<std::mutex> lock(s.mutex);
+    BlockEntry* e = acquire(s, lock, m, key, !zero_fill, kind);
+    if (!e) return BlockRef();
+    if (zero_fill) std::memset(e->data.data(), 0, block_size_);
+    return BlockRef(this, key, e->data.data(), zero_fill);
+}
+
+void BlockCache::unpin(BlockKey key, bool dirty) {
+    Shard& s = shardFor(key);
+    std::unique_lock<std::mutex> lock(s.mutex);
+    BlockEntry* e = find(s, key);
+    if (!e) return;
+    Mount& m = *e->mount;
+    release(s, key, e, dirty);
+    // Inserts made while every entry was pinned may have overshot the capacity or the quota
+    if (s.entries.size() > s.capacity || m.resident > m.quota) makeRoom(s, lock, m, 0);
+    lock.unlock();
+    if (dirty) throttle();
+}
+
+void BlockCache::writeBlock(Mount& m, uint64_t block_num, const char* buf) {
+    throttle();
+    BlockKey key = keyOf(m, block_num);
+    Shard& s = shardFor(key);
+    std::unique_lock<std::mutex> lock(s.mutex);
+    // The whole block is overwritten, so a miss needs no read from disk
+    BlockEntry* e = acquire(s, lock, m, key, false, BlockKind::Data);
+    std::memcpy(e->data.data(), buf, block_size_);
+    release(s, key, e, true);
+}
+
+bool BlockCache::readBlocks(Mount& m, uint64_t first_block, size_t count, char* out) {
+    // 1) Serve hits, claim the misses (inserted Loading and pinned) and note blocks another
+    //    thread is already reading
+    std::vector<size_t> owned, waiting;
+    for (size_t i = 0; i < count; ++i) {
+        BlockKey key = keyOf(m, first_block + i);
+        Shard& s = shardFor(key);
+        std::unique_lock<std::mutex> lock(s.mutex);
+        BlockEntry* e = find(s, key);
+        if (!e) {
+            makeRoom(s, lock, m, 1);
+            e = find(s, key);
+        }
+        countAccess(m, first_block + i, BlockKind::Data, e != nullptr);
+        if (!e) {
+            insert(s, key, m, BlockKind::Data);
+            owned.push_back(i);
+            continue;
+        }
+        touch(s, key, e, BlockKind::Data);
+        if (e->state == BlockState::Ready) {
+            std::memcpy(out + i * block_size_, e->data.data(), block_size_);
+        } else {
+            ++e->pins;
+            waiting.push_back(i);
+        }
+    }
+
+    // 2) Read each run of claimed blocks straight into `out`, all in flight at once when there
+    //    is more than one. No lock is held here.
+    std::vector<IORequest> misses;
+    for (size_t i : owned) {
+        if (!misses.empty() && misses.back().first_block + misses.back().count == first_block + i &&
+            misses.back().count < (size_t)MAX_IO_BLOCKS) {
+            ++misses.back().count;
+        } else {
+            misses.push_back({first_block + i, 1, out + i * block_size_, false, 0});
+        }
+    }
+    auto start = Clock::now();
+    if (misses.size() == 1) {
+        misses[0].result = m.disk->read_blocks(misses[0].first_block, misses[0].count, misses[0].buffer);
+    } else if (!misses.empty()) {
+        m.disk->submit_batch(misses);
+    }
+    if (!misses.empty()) {
+        m.stats.miss_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
     }
 
-    // Cache miss: read from disk
-    std::vector<char> buf(block_size_);
-    disk_->disk_read(block_num, buf.data());
+    // 3) Publish what was read and wake anyone waiting on those blocks
+    bool ok = true;
+    for (const IORequest& req : misses) {
+        if (req.result != 0) {
+            std::cerr<<"[BlockCache] read of blocks "<<req.first_block<<"+"<<req.count<<" failed: "<<std::strerror(-req.result)<<"\n";
+            ok = false;
+        }
+        for (size_t j = 0; j < req.count; ++j) {
+            BlockKey key = keyOf(m, req.first_block + j);
+            Shard& s = shardFor(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            BlockEntry* e = find(s, key);
+            if (req.result == 0) {
+                std::memcpy(e->data.data(), req.buffer + j * block_size_, block_size_);
+                e->state = BlockState::Ready;
+            } else {
+                e->state = BlockState::Failed;
+            }
+            s.settled.notify_all();
+            release(s, key, e, false);
+        }
+    }
 
-    BlockEntry entry{std::move(buf), false};
-    cache_.put(key, entry);
-    evictIfNeeded();
+    // 4) Only now wait for the other threads' reads; ours are all settled, so nobody can be
+    //    waiting on us in turn
+    for (size_t i : waiting) {
+        BlockKey key = keyOf(m, first_block + i);
+        Shard& s = shardFor(key);
+        std::unique_lock<std::mutex> lock(s.mutex);
+        BlockEntry* e = find(s, key);
+        s.settled.wait(lock, [e] { return e->state != BlockState::Loading; });
+        if (e->state == BlockState::Ready) {
+            std::memcpy(out + i * block_size_, e->data.data(), block_size_);
+        } else if (m.disk->disk_pread(first_block + i, out + i * block_size_) != 0) {
+            ok = false;
+        }
+        release(s, key, e, false);
+    }
+    return ok;
+}
 
-    return cache_.get(key).data;
+void BlockCache::writeBlocks(Mount& m, uint64_t first_block, size_t count, const char* buf) {
+    for (size_t i = 0; i < count; ++i) writeBlock(m, first_block + i, buf + i * block_size_);
 }
 
-void BlockCacheController::writeBlock(uint64_t block_num, const char* buf) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    BlockKey key = block_num;
-    if (!cache_.contains(key)) {
-        std::vector<char> tmp(block_size_);
-        disk_->disk_read(block_num, tmp.data());
-        cache_.put(key, BlockEntry{std::move(tmp), false});
+// Evicts unpinned entries in the policy's order until `incoming` more fit, both in the shard and
+// in mount m's quota. A mount over its quota gives up its own blocks. If it has none to give in
+// this shard, a demand access goes over for now and is trimmed back by a later insert here;
+// a prefetch (may_write = false) stops. A full shard takes only from mounts above their
+// reservation. If none has anything to give, the shard grows past its capacity; the
+// reservations add up to at most the whole cache, which bounds that.
+//
+// Clean victims are preferred so the caller does not wait on a write; a dirty one (only when
+// nothing clean is left, i.e. the flusher is behind) is written back first with the lock
+// dropped, unless may_write is false. Returns whether the room was made.
+bool BlockCache::makeRoom(Shard& s, std::unique_lock<std::mutex>& lock, Mount& m, size_t incoming, bool may_write) {
+    for (;;) {
+        bool full = s.entries.size() + incoming > s.capacity;
+        std::optional<BlockKey> victim;
+        if (m.resident + incoming > m.quota) {
+            victim = pickVictim(s, may_write, [&m](const BlockEntry& e) { return e.mount == &m; });
+            if (!victim && !may_write) return false;
+        }
+        if (!victim && full) {
+            victim = pickVictim(s, may_write, [](const BlockEntry& e) { return e.mount->resident > e.mount->reserved; });
+        }
+        // With everything pinned or reserved the shard grows past capacity until that changes
+        if (!victim) return !full;
+        BlockEntry* e = find(s, *victim);
+        if (e->dirty) {
+            if (!writeBack(s, lock, *victim)) return false;
+            continue;
+        }
+        e->mount->stats.of(e->kind).evictions.fetch_add(1, std::memory_order_relaxed);
+        erase(s, *victim);
     }
+}
 
-    BlockEntry& entry = cache_.get(key);
-    std::memcpy(entry.data.data(), buf, BLOCK_SIZE);
-    entry.dirty = true;
-    evictIfNeeded();
+// The policy's choice among unpinned entries passing filter, taken in
+// tiers: data before metadata while metadata is within its share of the shard, and within that
+// clean before dirty.
+std::optional<BlockCache::BlockKey> BlockCache::pickVictim(Shard& s, bool may_write, const EntryFilter& filter) {
+    bool protect_metadata = s.metadata <= s.metadata_limit;
+    for (bool data_only : {true, false}) {
+        if (data_only && !protect_metadata) continue;
+        for (bool clean_only : {true, false}) {
+            if (!clean_only && !may_write) break;
+            std::optional<BlockKey> victim = s.policy->victim([&](BlockKey key) {
+                const BlockEntry& e = s.entries.find(key)->second;
+                return e.pins == 0 && (!clean_only || !e.dirty) && (!data_only || e.kind == BlockKind::Data) && filter(e);
+            });
+            if (victim) return victim;
+        }
+    }
+    return std::nullopt;
 }
 
-void BlockCacheController::flushEntry(const BlockKey& key, const BlockEntry& entry) {
-    disk_->disk_write(key, entry.data.data());
+// Writes a dirty block together with the dirty, unpinned blocks physically adjacent to it on the
+// same disk and in the same shard, as one write. The run is copied out and pinned so it stays
+// cached (and readers never fall through to stale disk data) until the write lands; the entries
+// stay cached, clean.
+bool BlockCache::writeBack(Shard& s, std::unique_lock<std::mutex>& lock, BlockKey key) {
+    Mount& m = *find(s, key)->mount;
+    auto eligible = [&](BlockKey k) {
+        BlockEntry* e = find(s, k);
+        return e && e->mount == &m && e->dirty && e->pins == 0 && e->state == BlockState::Ready;
+    };
+    BlockKey first = key, last = key;
+    while (blockOf(first) > 0 && last - first + 1 < (size_t)MAX_IO_BLOCKS && eligible(first - 1)) --first;
+    while (last - first + 1 < (size_t)MAX_IO_BLOCKS && eligible(last + 1)) ++last;
+    size_t n = last - first + 1;
+
+    AlignedPtr staging = make_aligned(n * block_size_);
+    for (BlockKey k = first; k <= last; ++k) {
+        BlockEntry* e = find(s, k);
+        std::memcpy(staging.get() + (k - first) * block_size_, e->data.data(), block_size_);
+        setDirty(e, false);
+        ++e->pins;
+    }
+    lock.unlock();
+    int err = m.disk->write_blocks(blockOf(first), n, staging.get());
+    lock.lock();
+    for (BlockKey k = first; k <= last; ++k) {
+        BlockEntry* e = find(s, k);
+        if (err == 0) m.stats.of(e->kind).writebacks.fetch_add(1, std::memory_order_relaxed);
+        release(s, k, e, err != 0);
+    }
+    s.settled.notify_all();
+    if (err != 0) {
+        std::cerr<<"[BlockCache] writeback of blocks "<<blockOf(first)<<"+"<<n<<" failed: "<<std::strerror(-err)<<"\n";
+    }
+    return err == 0;
 }
 
-void BlockCacheController::evictIfNeeded() {
-    while (cache_.size() > capacity_blocks_) {
-        auto evicted = cache_.evictLeastRecentlyUsed();
-        if (evicted.has_value()) {
-            const auto& [key, entry] = evicted.value();
-            if (entry.dirty) {
-                flushEntry(key, entry);
+// Stages the selected dirty blocks shard by shard, then writes each mount's as one batch in
+// block-number order, followed by a sync of that disk if asked. The entries are marked clean up
+// front and stay pinned until their write lands (see writeBack); a failed write makes them dirty
+// again. Returns the number of blocks written.
+//
+// Pinned blocks are skipped: a BlockRef holder may be changing the bytes in place, and an
+// eviction writeback may still be in flight (an older copy landing after ours would win). They
+// are picked up by a later pass. Calls are serialized for the same reason, and so that detach
+// never races a pass over the mount it is dropping.
+size_t BlockCache::writeDirty(const EntryFilter& select, bool sync) {
+    std::lock_guard<std::mutex> serial(writeback_mutex_);
+    std::unordered_map<Mount*, std::vector<IORequest>> runs;
+    std::vector<AlignedPtr> staging;
+    for (auto& shard : shards_) {
+        Shard& s = *shard;
+        std::unique_lock<std::mutex> lock(s.mutex);
+        std::vector<BlockKey> dirty;
+        for (auto& [key, e] : s.entries) {
+            if (e.dirty && e.pins == 0 && e.state == BlockState::Ready && select(e)) dirty.push_back(key);
+        }
+        std::sort(dirty.begin(), dirty.end());
+        size_t i = 0;
+        while (i < dirty.size()) {
+            Mount* m = find(s, dirty[i])->mount;
+            size_t n = 1;
+            while (i + n < dirty.size() && n < (size_t)MAX_IO_BLOCKS && dirty[i + n] == dirty[i] + n &&
+                   find(s, dirty[i + n])->mount == m) {
+                ++n;
+            }
+            staging.push_back(make_aligned(n * block_size_));
+            for (size_t j = 0; j < n; ++j) {
+                BlockEntry* e = find(s, dirty[i + j]);
+                std::memcpy(staging.back().get() + j * block_size_, e->data.data(), block_size_);
+                setDirty(e, false);
+                ++e->pins;
             }
+            runs[m].push_back({blockOf(dirty[i]), n, staging.back().get(), true, 0});
+            i += n;
+        }
+    }
+    size_t written = 0;
+    for (auto& [m, reqs] : runs) {
+        std::sort(reqs.begin(), reqs.end(), [](const IORequest& a, const IORequest& b) { return a.first_block < b.first_block; });
+        m->disk->submit_batch(reqs);
+        for (const IORequest& req : reqs) {
+            if (req.result != 0) {
+                std::cerr<<"[BlockCache] writeback of blocks "<<req.first_block<<"+"<<req.count<<" failed: "<<std::strerror(-req.result)<<"\n";
+            } else {
+                written += req.count;
+            }
+            for (size_t j = 0; j < req.count; ++j) {
+                BlockKey key = keyOf(*m, req.first_block + j);
+                Shard& s = shardFor(key);
+                std::lock_guard<std::mutex> lock(s.mutex);
+                BlockEntry* e = find(s, key);
+                if (req.result == 0) m->stats.of(e->kind).writebacks.fetch_add(1, std::memory_order_relaxed);
+                release(s, key, e, req.result != 0);
+            }
+        }
+        if (sync) m->disk->disk_sync();
+    }
+    return written;
+}
+
+void BlockCache::prefetch(Mount& m, uint64_t first_block, size_t count) {
+    std::vector<IORequest> runs;
+    for (size_t i = 0; i < count; ++i) {
+        BlockKey key = keyOf(m, first_block + i);
+        Shard& s = shardFor(key);
+        std::unique_lock<std::mutex> lock(s.mutex);
+        if (find(s, key)) continue;
+        // A speculative read is not worth a synchronous writeback
+        if (!makeRoom(s, lock, m, 1, /*may_write=*/false)) break;
+        insert(s, key, m, BlockKind::Data)->prefetched = true;
+        m.stats.prefetched.fetch_add(1, std::memory_order_relaxed);
+        if (!runs.empty() && runs.back().first_block + runs.back().count == first_block + i &&
+            runs.back().count < (size_t)MAX_IO_BLOCKS) {
+            ++runs.back().count;
+        } else {
+            runs.push_back({first_block + i, 1, nullptr, false, 0});
+        }
+    }
+    // Submitted with no shard lock held: on a mapped image the callback runs right here
+    for (IORequest& req : runs) {
+        std::shared_ptr<char> buf(make_aligned(req.count * block_size_).release(), FreeDeleter());
+        req.buffer = buf.get();
+        {
+            std::lock_guard<std::mutex> lk(prefetch_mutex_);
+            ++m.prefetching;
         }
+        m.disk->submit_async(req, [this, &m, req, buf](int result) { finishPrefetch(m, req, result); });
     }
 }
 
-void BlockCacheController::flushAll() {
-    for (const auto& [key, entry] : cache_.getAll()) {
-        if (entry.dirty) {
-            flushEntry(key, entry);
+// Runs on an engine thread. Publishes the blocks like readBlocks does, then lets a waiting
+// detach go on once the mount's last prefetch is done with it.
+void BlockCache::finishPrefetch(Mount& m, const IORequest& req, int result) {
+    if (result != 0) {
+        std::cerr<<"[BlockCache] prefetch of blocks "<<req.first_block<<"+"<<req.count<<" failed: "<<std::strerror(-result)<<"\n";
+    }
+    for (size_t j = 0; j < req.count; ++j) {
+        BlockKey key = keyOf(m, req.first_block + j);
+        Shard& s = shardFor(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        BlockEntry* e = find(s, key);
+        if (result == 0) {
+            std::memcpy(e->data.data(), req.buffer + j * block_size_, block_size_);
+            e->state = BlockState::Ready;
+        } else {
+            e->state = BlockState::Failed;
         }
+        s.settled.notify_all();
+        release(s, key, e, false);
+    }
+    std::lock_guard<std::mutex> lk(prefetch_mutex_);
+    --m.prefetching;
+    prefetch_done_.notify_all(); // under the lock: once it drops, detach may free the mount
+}
+
+void BlockCache::flush(Mount& m) {
+    writeDirty([&m](const BlockEntry& e) { return e.mount == &m; }, false);
+    m.disk->disk_sync();
+}
+
+// Wakes every interval_ms, or early once the dirty share passes background_percent, and writes
+// back the blocks that have been dirty longer than expire_ms; above the background share it
+// writes them all. Each disk written to is synced, so a crash loses at most about expire_ms of writes.
+void BlockCache::flusherLoop() {
+    std::unique_lock<std::mutex> lk(flusher_mutex_);
+    while (!flusher_stop_) {
+        flusher_wake_.wait_for(lk, std::chrono::milliseconds(writeback_.interval_ms),
+                               [this] { return flusher_stop_ || flusher_kicked_; });
+        if (flusher_stop_) break;
+        flusher_kicked_ = false;
+        lk.unlock();
+        bool over = dirty_blocks_.load() > background_limit_;
+        Clock::time_point cutoff = Clock::now() - std::chrono::milliseconds(writeback_.expire_ms);
+        writeDirty([&](const BlockEntry& e) { return over || e.dirtied <= cutoff; }, true);
+        lk.lock();
+        flusher_done_.notify_all();
+    }
+}
+
+void BlockCache::kickFlusher() {
+    std::lock_guard<std::mutex> lk(flusher_mutex_);
+    flusher_kicked_ = true;
+    flusher_wake_.notify_one();
+}
+
+// Called by writers with no shard lock held. Past the hard limit they wait for the flusher
+// (or, without one, write everything back themselves) instead of letting dirty data pile up.
+void BlockCache::throttle() {
+    if (dirty_blocks_.load() <= hard_limit_) return;
+    if (!flusher_.joinable()) {
+        writeDirty([](const BlockEntry&) { return true; }, false);
+        return;
+    }
+    std::unique_lock<std::mutex> lk(flusher_mutex_);
+    while (dirty_blocks_.load() > hard_limit_ && !flusher_stop_) {
+        flusher_kicked_ = true;
+        flusher_wake_.notify_one();
+        // Timed, since blocks pinned by their writers can keep a pass from getting under the limit
+        flusher_done_.wait_for(lk, std::chrono::milliseconds(writeback_.interval_ms));
     }
 }
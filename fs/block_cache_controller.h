@@ -6,36 +6,284 @@
 #include <utility>
 #include <unordered_map>
 #include <optional>
-#include "lru_cache.h"
+#include "cache_policy.h"
+#include "aligned_buffer.h"
+#include "io_engine.h"
+#include "io_stats.h"
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
 
 class Disk; // foward declare for disk I/O
+class BlockCache;
 
-class BlockCacheController {
+// What a cached block holds, for eviction priority and statistics. Everything but Data is
+// metadata: eviction takes data blocks first as long as metadata stays within
+// CACHE_METADATA_PERCENT of the cache, so streaming through a large file does not flush the
+// blocks every path lookup needs. (The superblock is read once at mount and never cached.)
+// Indirect covers every block-mapping block: indirect blocks and extent tree nodes.
+enum class BlockKind { Data, Inode, Indirect, Dir, Bitmap };
+constexpr int NUM_BLOCK_KINDS = 5;
+inline bool is_metadata(BlockKind kind) { return kind != BlockKind::Data; }
+const char* block_kind_name(BlockKind kind);
+
+// Counters are relaxed atomics, updated as the events happen; read them at any time.
+struct CacheStats {
+    struct PerKind {
+        std::atomic<uint64_t> hits{0};       // demand accesses that found the block cached
+        std::atomic<uint64_t> misses{0};     // ... and that had to insert it
+        std::atomic<uint64_t> evictions{0};
+        std::atomic<uint64_t> writebacks{0}; // blocks written to disk, by eviction or flushing
+    };
+    PerKind kinds[NUM_BLOCK_KINDS];
+    std::atomic<uint64_t> prefetched{0};    // blocks read ahead
+    std::atomic<uint64_t> prefetch_hits{0}; // ... and used before being evicted
+    LatencyHistogram miss_latency;          // time a demand read spent waiting on disk, in us
+    HitRateCurve hit_rate_curve;            // over demand accesses
+
+    PerKind& of(BlockKind kind) { return kinds[(int)kind]; }
+};
+
+// Cache keys pack (mount, block) as mount << CACHE_BLOCK_BITS | block, so images are limited
+// to 2^40 blocks and a process to 2^24 mounts.
+constexpr int CACHE_BLOCK_BITS = 40;
+constexpr uint64_t CACHE_BLOCK_MASK = (1ull << CACHE_BLOCK_BITS) - 1;
+
+// Handle to a pinned cache block. While it is held the block stays resident, so callers work on
+// the cached bytes in place instead of copying them out. After changing them, call markDirty()
+// and the block is marked for writeback when the handle is released.
+class BlockRef {
 public:
-    using BlockKey = uint64_t; // block_num
+    BlockRef() = default;
+    BlockRef(BlockRef&& other) noexcept { *this = std::move(other); }
+    BlockRef& operator=(BlockRef&& other) noexcept;
+    BlockRef(const BlockRef&) = delete;
+    BlockRef& operator=(const BlockRef&) = delete;
+    ~BlockRef() { release(); }
+
+    explicit operator bool() const { return data_ != nullptr; }
+    char* data() const { return data_; }
+    void markDirty() { dirty_ = true; }
+    uint64_t block() const { return key_ & CACHE_BLOCK_MASK; }
+
+    // Unpins early; the handle becomes empty.
+    void release();
+
+private:
+    friend class BlockCache;
+    BlockRef(BlockCache* owner, uint64_t key, char* data, bool dirty)
+        : owner_(owner), key_(key), data_(data), dirty_(dirty) {}
+
+    BlockCache* owner_ = nullptr;
+    uint64_t key_ = 0;
+    char* data_ = nullptr;
+    bool dirty_ = false;
+};
+
+// When dirty blocks go to disk besides eviction and flushAll. Defaults come from stat.h.
+struct WritebackPolicy {
+    bool background = true; // run the flusher thread; otherwise throttled writers flush themselves
+    int interval_ms = WRITEBACK_INTERVAL_MS;
+    int expire_ms = DIRTY_EXPIRE_MS;
+    int background_percent = DIRTY_BACKGROUND_PERCENT;
+    int limit_percent = DIRTY_LIMIT_PERCENT;
+};
+
+// Block cache that any number of mounts share, keyed by (mount, block), so memory an idle mount
+// is not using goes to busy ones. Each mount has a reservation that other mounts' pressure never
+// evicts it below and a quota it does not grow past (see makeRoom for how strictly).
+//
+// The cache is split into independently locked shards. Blocks are assigned to shards in groups
+// of MAX_IO_BLOCKS, so physically adjacent blocks usually share a shard and can be written back
+// as one run. Disk I/O never happens under a shard lock: a missing block is inserted in the
+// Loading state, read with the lock dropped, and threads wanting it meanwhile wait only for it.
+class BlockCache {
+public:
+    using BlockKey = uint64_t; // mount id << CACHE_BLOCK_BITS | block_num
+    using Clock = std::chrono::steady_clock;
+
+    enum class BlockState { Loading, Ready, Failed };
+
+    // One attached disk. Counts are kept as its entries come and go.
+    struct Mount {
+        uint64_t id;
+        std::shared_ptr<Disk> disk;
+        size_t reserved; // blocks other mounts cannot evict it below
+        size_t quota;    // blocks it may hold
+        std::atomic<size_t> resident{0};
+        std::atomic<size_t> metadata{0};
+        std::atomic<size_t> dirty{0};
+        size_t prefetching = 0; // prefetch reads in flight, under prefetch_mutex_
+        CacheStats stats;
+    };
 
     struct BlockEntry {
-        std::vector<char> data;
+        BlockBuffer data; // aligned, so O_DIRECT I/O can use it in place
         bool dirty;
+        int pins = 0;     // BlockRefs and in-flight I/O; pinned entries are never evicted
+        BlockState state = BlockState::Ready;
+        Clock::time_point dirtied{}; // when it last went from clean to dirty
+        BlockKind kind = BlockKind::Data; // from the most recent access
+        bool prefetched = false; // read ahead and not yet used; the first use is not a re-reference
+        Mount* mount = nullptr;
     };
 
-    BlockCacheController(size_t capacity_blocks, size_t block_size, std::shared_ptr<Disk> disk);
+    // shards = 0 picks a count from the capacity (at most CACHE_SHARDS). Each shard runs its
+    // own instance of the replacement policy.
+    BlockCache(size_t capacity_blocks, size_t block_size, CachePolicy policy = CachePolicy::LRU,
+               size_t shards = 0, const WritebackPolicy& writeback = WritebackPolicy());
+    // Stops the flusher. Every mount must have been detached.
+    ~BlockCache();
+
+    // Starts caching a disk. quota = 0 means the whole cache. nullptr if the reservation does not
+    // fit beside the other mounts' or the disk has more blocks than a key can address.
+    std::unique_ptr<Mount> attach(std::shared_ptr<Disk> disk, size_t reserved, size_t quota);
+    // Waits for the mount's prefetches, writes back its dirty blocks and drops all of them
+    void detach(Mount& m);
 
-    const std::vector<char>& getBlock(uint64_t block_num);
+    // Pins a block, reading it on a miss. With zero_fill the block is cleared instead of read
+    // (for freshly allocated blocks) and the handle starts dirty. Empty handle if the read fails.
+    BlockRef pinBlock(Mount& m, uint64_t block_num, BlockKind kind, bool zero_fill);
 
-    void writeBlock(uint64_t block_num, const char* buf);
+    void writeBlock(Mount& m, uint64_t block_num, const char* buf);
 
-    void flushAll();
+    // Copies `count` consecutive blocks into out. Each run of missing blocks is fetched
+    // with one vectored disk read. Returns false if a disk read failed.
+    bool readBlocks(Mount& m, uint64_t first_block, size_t count, char* out);
+
+    // Overwrites `count` whole consecutive blocks. Nothing is read from disk.
+    void writeBlocks(Mount& m, uint64_t first_block, size_t count, const char* buf);
+
+    // Starts reading `count` consecutive blocks into the cache and returns without waiting.
+    // Cached blocks are skipped; the others are inserted Loading, so a reader reaching one
+    // before its read lands waits for that read instead of issuing another. Stops early rather
+    // than evict a dirty block to make room.
+    void prefetch(Mount& m, uint64_t first_block, size_t count);
+
+    // Writes back the mount's dirty blocks and syncs its disk
+    void flush(Mount& m);
+
+    size_t shardCount() const { return shards_.size(); }
+    CachePolicy policy() const { return policy_; }
+    size_t capacity() const { return capacity_blocks_; }
+    size_t dirtyBlocks() const { return dirty_blocks_.load(); }
+    // Entries across all shards (each shard locked in turn), and the metadata ones among them
+    std::pair<size_t, size_t> residentBlocks();
 
 private:
+    friend class BlockRef;
+
+    struct Shard {
+        Shard(size_t capacity, CachePolicy policy)
+            : capacity(capacity), metadata_limit(capacity * CACHE_METADATA_PERCENT / 100),
+              policy(ReplacementPolicy::create(policy, capacity)) {}
+        std::mutex mutex;
+        std::condition_variable settled; // a Loading entry settled, or an eviction write landed
+        size_t capacity;
+        size_t metadata_limit; // metadata entries that outrank data ones
+        size_t metadata = 0;   // metadata entries cached
+        // Map nodes never move, so an entry pointer stays valid while the lock is dropped
+        std::unordered_map<BlockKey, BlockEntry> entries;
+        std::unique_ptr<ReplacementPolicy> policy; // orders entries for eviction; makeRoom enforces the capacity
+    };
+    using EntryFilter = std::function<bool(const BlockEntry&)>;
+
     size_t capacity_blocks_;
     size_t block_size_;
-    std::shared_ptr<Disk> disk_;
-    std::mutex mutex_;
-    // switch to LFU if needed
-    LRUCache<BlockKey, BlockEntry> cache_;
+    CachePolicy policy_;
+    AlignedBufferPool pool_; // must outlive shards_, whose entries return buffers to it
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    std::mutex mounts_mutex_;
+    uint64_t next_mount_id_ = 0; // never reused
+    size_t reserved_ = 0;        // sum of the attached mounts' reservations
+
+    WritebackPolicy writeback_;
+    size_t background_limit_; // dirty blocks that wake the flusher early
+    size_t hard_limit_;       // dirty blocks beyond which writers are throttled
+    std::atomic<size_t> dirty_blocks_{0};
+    std::mutex writeback_mutex_; // one writeDirty at a time, so a block never has two writes in flight
+    std::mutex flusher_mutex_;
+    std::condition_variable flusher_wake_;
+    std::condition_variable flusher_done_; // a flusher pass finished
+    bool flusher_kicked_ = false;
+    bool flusher_stop_ = false;
+    std::thread flusher_;
+
+    std::mutex prefetch_mutex_;
+    std::condition_variable prefetch_done_;
+
+    static BlockKey keyOf(const Mount& m, uint64_t block) { return m.id << CACHE_BLOCK_BITS | block; }
+    static uint64_t blockOf(BlockKey key) { return key & CACHE_BLOCK_MASK; }
+
+    Shard& shardFor(BlockKey key);
+    BlockEntry* find(Shard& s, BlockKey key);
+    BlockEntry* insert(Shard& s, BlockKey key, Mount& m, BlockKind kind);
+    void erase(Shard& s, BlockKey key);
+    void touch(Shard& s, BlockKey key, BlockEntry* e, BlockKind kind);
+    void countAccess(Mount& m, uint64_t block, BlockKind kind, bool hit);
+    std::optional<BlockKey> pickVictim(Shard& s, bool may_write, const EntryFilter& filter);
+    BlockEntry* acquire(Shard& s, std::unique_lock<std::mutex>& lock, Mount& m, BlockKey key, bool load, BlockKind kind);
+    BlockEntry* loadEntry(Shard& s, std::unique_lock<std::mutex>& lock, BlockKey key, BlockEntry* e);
+    void release(Shard& s, BlockKey key, BlockEntry* e, bool dirty);
+    void unpin(BlockKey key, bool dirty);
+    bool makeRoom(Shard& s, std::unique_lock<std::mutex>& lock, Mount& m, size_t incoming, bool may_write = true);
+    bool writeBack(Shard& s, std::unique_lock<std::mutex>& lock, BlockKey key);
+    void finishPrefetch(Mount& m, const IORequest& req, int result);
+    void setDirty(BlockEntry* e, bool dirty);
+    size_t writeDirty(const EntryFilter& select, bool sync);
+    void flusherLoop();
+    void kickFlusher();
+    void throttle();
+};
+
+// One mount's view of a block cache: block numbers are the mount's own and statistics cover only
+// its blocks. The cache is either shared with other mounts or private to this one.
+class BlockCacheController {
+public:
+    // A private cache, sized for this mount alone
+    BlockCacheController(size_t capacity_blocks, size_t block_size, std::shared_ptr<Disk> disk,
+                         CachePolicy policy = CachePolicy::LRU, size_t shards = 0,
+                         const WritebackPolicy& writeback = WritebackPolicy());
+    // A share of `cache`; see BlockCache::attach. nullptr if the reservation does not fit.
+    static std::shared_ptr<BlockCacheController> attach(std::shared_ptr<BlockCache> cache, std::shared_ptr<Disk> disk,
+                                                        size_t reserved = 0, size_t quota = 0);
+    // Writes back and drops this mount's blocks
+    ~BlockCacheController() { cache_->detach(*mount_); }
+
+    BlockRef pinBlock(uint64_t block_num, BlockKind kind = BlockKind::Data, bool zero_fill = false) {
+        return cache_->pinBlock(*mount_, block_num, kind, zero_fill);
+    }
+    void writeBlock(uint64_t block_num, const char* buf) { cache_->writeBlock(*mount_, block_num, buf); }
+    bool readBlocks(uint64_t first_block, size_t count, char* out) {
+        return cache_->readBlocks(*mount_, first_block, count, out);
+    }
+    void writeBlocks(uint64_t first_block, size_t count, const char* buf) {
+        cache_->writeBlocks(*mount_, first_block, count, buf);
+    }
+    void prefetch(uint64_t first_block, size_t count) { cache_->prefetch(*mount_, first_block, count); }
+    void flushAll() { cache_->flush(*mount_); }
+
+    BlockCache& cache() { return *cache_; }
+    bool shared() const { return shared_; }
+    size_t shardCount() const { return cache_->shardCount(); }
+    CachePolicy policy() const { return cache_->policy(); }
+    size_t capacity() const { return cache_->capacity(); } // of the whole cache
+    size_t quota() const { return mount_->quota; }
+    size_t reserved() const { return mount_->reserved; }
+    size_t dirtyBlocks() const { return mount_->dirty.load(); }
+    // This mount's cached blocks, and the metadata ones among them
+    std::pair<size_t, size_t> residentBlocks() const { return {mount_->resident.load(), mount_->metadata.load()}; }
+    CacheStats& stats() { return mount_->stats; }
+
+private:
+    BlockCacheController(std::shared_ptr<BlockCache> cache, std::unique_ptr<BlockCache::Mount> mount, bool shared)
+        : cache_(std::move(cache)), mount_(std::move(mount)), shared_(shared) {}
 
-    void evictIfNeeded();
-    void flushEntry(const BlockKey& key, const BlockEntry& entry);
+    std::shared_ptr<BlockCache> cache_;
+    std::unique_ptr<BlockCache::Mount> mount_;
+    bool shared_;
 };
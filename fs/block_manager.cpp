@@ -1,27 +1,165 @@
 #include "block_manager.h"
 #include "stat.h"
 #include "fs_context.h"
+#include "disk.h"
+#include "inode.h"
+#include "aligned_buffer.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
 
-void block_manager_init(FSContext& ctx) {
-    ctx.block_bitmap.assign(NUM_BLOCKS, false);
-    // reserve superblock + inode-table blocks:
-    for (int i = 0;i < RESERVED_BLOCKS; ++i) {
-        ctx.block_bitmap[i] = true;
+// Bitmap blocks are always written whole from the in-memory words, so nothing is read first
+static bool store_bitmap_block(FSContext& ctx, const Bitmap& map, uint64_t start, uint64_t b) {
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    char* data = block_load(ctx, start + b, ref, scratch, BlockKind::Bitmap, /*zero_fill=*/true);
+    if (!data) return false;
+    map.store_block(b, data);
+    return block_store(ctx, start + b, ref, data);
+}
+
+static bool store_bitmap(FSContext& ctx, const Bitmap& map, uint64_t start, uint64_t blocks) {
+    for (uint64_t b = 0; b < blocks; ++b) {
+        if (!store_bitmap_block(ctx, map, start, b)) return false;
+    }
+    return true;
+}
+
+static bool load_bitmap(FSContext& ctx, Bitmap& map, uint64_t start, uint64_t blocks) {
+    AlignedPtr buf = make_aligned((size_t)MAX_IO_BLOCKS * BLOCK_SIZE);
+    for (uint64_t b = 0; b < blocks; b += MAX_IO_BLOCKS) {
+        size_t n = std::min<uint64_t>(MAX_IO_BLOCKS, blocks - b);
+        if (ctx.disk->read_blocks(start + b, n, buf.get()) != 0) return false;
+        for (size_t i = 0; i < n; ++i) map.load_block(b + i, buf.get() + i * BLOCK_SIZE);
+    }
+    return true;
+}
+
+// Images from before the bitmaps existed get them in the first free run of the data area
+// that fits both; the superblock is rewritten only once they are on disk.
+static bool place_bitmaps(FSContext& ctx) {
+    Superblock sb = ctx.sb;
+    sb.inode_bitmap_blocks = bitmap_blocks(sb.num_inodes);
+    sb.block_bitmap_blocks = bitmap_blocks(sb.num_blocks);
+    uint64_t need = sb.inode_bitmap_blocks + sb.block_bitmap_blocks;
+    uint64_t start = 0, run = 0;
+    for (uint64_t b = sb.data_start; b < sb.num_blocks && run < need; ++b) {
+        if (ctx.block_bitmap.test(b)) run = 0;
+        else if (run++ == 0) start = b;
+    }
+    if (run < need) return false;
+    for (uint64_t b = start; b < start + need; ++b) ctx.block_bitmap.set(b);
+    sb.inode_bitmap_start = start;
+    sb.block_bitmap_start = start + sb.inode_bitmap_blocks;
+    sb.version = SFS_VERSION;
+    if (!store_bitmap(ctx, ctx.inode_bitmap, sb.inode_bitmap_start, sb.inode_bitmap_blocks) ||
+        !store_bitmap(ctx, ctx.block_bitmap, sb.block_bitmap_start, sb.block_bitmap_blocks)) {
+        return false;
     }
+    if (ctx.use_cache) ctx.cache_controller->flushAll();
+    else ctx.disk->disk_sync();
+    if (!superblock_write(*ctx.disk, sb)) return false;
+    ctx.sb = sb;
+    return true;
 }
 
-int block_alloc(FSContext& ctx) {
-    for (int i = RESERVED_BLOCKS;i < NUM_BLOCKS; ++i) {
-        if (!ctx.block_bitmap[i]) {
-            ctx.block_bitmap[i] = true;
-            return i;
+void block_manager_init(FSContext& ctx, bool formatted) {
+    const Superblock& sb = ctx.sb;
+    ctx.block_bitmap.assign(sb.num_blocks);
+    ctx.inode_bitmap.assign(sb.num_inodes);
+    if (sb.block_bitmap_start != 0 && !formatted) {
+        if (load_bitmap(ctx, ctx.inode_bitmap, sb.inode_bitmap_start, sb.inode_bitmap_blocks) &&
+            load_bitmap(ctx, ctx.block_bitmap, sb.block_bitmap_start, sb.block_bitmap_blocks)) {
+            return;
+        }
+        std::cerr<<"[SFS] bitmaps unreadable, rebuilding them from the inode table\n";
+        ctx.block_bitmap.assign(sb.num_blocks);
+        ctx.inode_bitmap.assign(sb.num_inodes);
+    }
+    // superblock, inode table and bitmaps; inode 0 is never handed out
+    for (uint64_t i = 0; i < sb.data_start; ++i) ctx.block_bitmap.set(i);
+    ctx.inode_bitmap.set(0);
+    if (!formatted) inode_mark_used(ctx);
+    if (sb.block_bitmap_start == 0) {
+        if (place_bitmaps(ctx)) {
+            std::cout<<"[SFS] Added allocation bitmaps at block "<<ctx.sb.inode_bitmap_start<<"\n";
+        } else {
+            std::cerr<<"[SFS] No room for allocation bitmaps; they are rebuilt on every mount\n";
         }
+        return;
     }
-    return -1;
+    store_bitmap(ctx, ctx.inode_bitmap, sb.inode_bitmap_start, sb.inode_bitmap_blocks);
+    store_bitmap(ctx, ctx.block_bitmap, sb.block_bitmap_start, sb.block_bitmap_blocks);
+}
+
+bool bitmap_store(FSContext& ctx, const Bitmap& map, uint64_t start, uint64_t bit, uint64_t count) {
+    if (start == 0) return true;
+    for (uint64_t end = bit + count; bit < end;) {
+        uint64_t b = bit / BITS_PER_BLOCK;
+        uint64_t n = std::min(end, (b + 1) * BITS_PER_BLOCK) - bit;
+        // A cached or mapped block is updated in place, just the words that changed; otherwise
+        // it is written whole
+        if (!ctx.use_cache && !ctx.disk->mutable_block_ptr(start + b)) {
+            if (!store_bitmap_block(ctx, map, start, b)) return false;
+        } else {
+            BlockRef ref;
+            char* data = block_load(ctx, start + b, ref, nullptr, BlockKind::Bitmap);
+            if (!data) return false;
+            map.store_words(bit, n, data);
+            if (!block_store(ctx, start + b, ref, data)) return false;
+        }
+        bit += n;
+    }
+    return true;
+}
+
+int block_alloc(FSContext& ctx, uint32_t goal) {
+    int got;
+    return block_alloc_range(ctx, 1, got, goal);
+}
+
+int block_alloc_range(FSContext& ctx, int want, int& got, uint32_t goal) {
+    uint64_t n;
+    // Only a file that is growing (it has a goal) cares about room after its own blocks
+    uint64_t gap = goal != 0 ? ALLOC_GAP_BLOCKS : 0;
+    uint64_t b = ctx.block_bitmap.alloc_run(ctx.sb.data_start, goal, std::max(want, 1), gap, n);
+    got = (int)n;
+    if (b == Bitmap::npos) return -1;
+    bitmap_store(ctx, ctx.block_bitmap, ctx.sb.block_bitmap_start, b, n);
+    return (int)b;
 }
 
 void block_free(FSContext& ctx, int block_num) {
-    if (block_num >= RESERVED_BLOCKS && block_num < NUM_BLOCKS) {
-        ctx.block_bitmap[block_num] = false;
+    if (block_num >= 0) block_free_range(ctx, block_num, 1);
+}
+
+void block_free_range(FSContext& ctx, uint64_t first, uint64_t count) {
+    uint64_t end = std::min(first + count, ctx.sb.num_blocks);
+    first = std::max(first, ctx.sb.data_start);
+    if (first >= end) return;
+    for (uint64_t b = first; b < end; ++b) ctx.block_bitmap.clear(b);
+    bitmap_store(ctx, ctx.block_bitmap, ctx.sb.block_bitmap_start, first, end - first);
+}
+
+char* block_load(FSContext& ctx, uint64_t block_num, BlockRef& ref, char* scratch, BlockKind kind, bool zero_fill) {
+    if (ctx.use_cache) {
+        ref = ctx.cache_controller->pinBlock(block_num, kind, zero_fill);
+        return ref.data();
+    }
+    char* data = ctx.disk->mutable_block_ptr(block_num);
+    if (!data) {
+        data = scratch;
+        if (!zero_fill && !ctx.disk->disk_read(block_num, data)) return nullptr;
+    }
+    if (zero_fill) std::memset(data, 0, BLOCK_SIZE);
+    return data;
+}
+
+bool block_store(FSContext& ctx, uint64_t block_num, BlockRef& ref, const char* data) {
+    if (ref) {
+        ref.markDirty();
+        return true;
     }
+    if (data == ctx.disk->block_ptr(block_num)) return true; // mapped: already in place
+    return ctx.disk->disk_write(block_num, data);
 }
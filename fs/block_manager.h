@@ -7,8 +7,35 @@
 
 struct FSContext;
 
-void block_manager_init(FSContext &ctx);
+// Loads the allocation bitmaps from disk. A freshly formatted image starts them empty; one that
+// predates them has them rebuilt from the inode table and written into free space.
+void block_manager_init(FSContext &ctx, bool formatted);
 
-int block_alloc(FSContext &ctx);
+// One data block, at `goal` when it is free (0: wherever the previous allocation ended). When
+// the goal is taken the block goes ALLOC_GAP_BLOCKS into the next free run that has room, so
+// two files growing side by side do not interleave block by block.
+int block_alloc(FSContext &ctx, uint32_t goal = 0);
+
+// Up to `want` contiguous data blocks, placed like block_alloc's; returns the first and the
+// count in `got`, or -1 when the image is full. Fewer than `want` only when no free run that
+// long turned up, so callers loop until they have all they need.
+int block_alloc_range(FSContext &ctx, int want, int &got, uint32_t goal = 0);
 
 void block_free(FSContext &ctx, int block_num);
+// Frees data blocks [first, first + count), writing each bitmap block once
+void block_free_range(FSContext &ctx, uint64_t first, uint64_t count);
+
+// Writes the on-disk blocks of a bitmap starting at block `start` that hold bits
+// [bit, bit + count). A no-op while the image has no bitmaps on disk (start == 0).
+bool bitmap_store(FSContext &ctx, const Bitmap &map, uint64_t start, uint64_t bit, uint64_t count = 1);
+
+// In-place access to a block's bytes. With the cache on, `ref` pins the cached copy; on a mapped
+// image the mapping itself is returned; otherwise the block is read into `scratch`. kind tells
+// the cache what the block holds (see BlockKind). zero_fill clears the block instead of reading
+// it. nullptr if the read fails.
+char* block_load(FSContext &ctx, uint64_t block_num, BlockRef &ref, char* scratch,
+                 BlockKind kind = BlockKind::Data, bool zero_fill = false);
+
+// Publishes changes made through block_load's pointer: marks the pinned block dirty, or writes
+// `scratch` back when the block was read into it.
+bool block_store(FSContext &ctx, uint64_t block_num, BlockRef &ref, const char* data);
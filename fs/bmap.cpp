@@ -0,0 +1,171 @@
+#include "bmap.h"
+#include "extent.h"
+#include "inode.h"
+#include "block_manager.h"
+#include <algorithm>
+#include <cstring>
+
+static bool uses_extents(const Inode& ino) { return ino.mode & INODE_EXTENTS; }
+
+void bmap_init(FSContext &ctx, Inode &ino) {
+    std::memset(ino.extents, 0, sizeof(ino.extents));
+    if (ctx.sb.version >= SFS_VERSION_EXTENTS) ino.mode |= INODE_EXTENTS;
+}
+
+int bmap_max_blocks(FSContext &ctx, const Inode &ino) {
+    bool extents = uses_extents(ino) || ctx.sb.version >= SFS_VERSION_EXTENTS;
+    return extents ? MAX_EXTENT_FILE_BLOCKS : MAX_FILE_BLOCKS;
+}
+
+// Pointers from ptrs[i] on (of n) that continue it on disk, or that are holes like it
+static int pointer_run(const uint32_t* ptrs, int i, int n) {
+    int run = 1;
+    if (ptrs[i] == 0) {
+        while (i + run < n && ptrs[i + run] == 0) ++run;
+    } else {
+        while (i + run < n && ptrs[i + run] == ptrs[i] + run) ++run;
+    }
+    return run;
+}
+
+int bmap_lookup(FSContext &ctx, const Inode &ino, int file_block, int *run, BmapRun *cache) {
+    if (file_block < 0 || file_block >= bmap_max_blocks(ctx, ino)) return -1;
+    if (cache && file_block >= cache->file_block && file_block - cache->file_block < cache->count) {
+        if (run) *run = cache->count - (file_block - cache->file_block);
+        return cache->block + (file_block - cache->file_block);
+    }
+    int block, len;
+    if (uses_extents(ino)) {
+        uint32_t n;
+        block = extent_lookup(ctx, ino, file_block, n);
+        len = (int)std::min<uint32_t>(n, MAX_EXTENT_FILE_BLOCKS - file_block);
+    } else if (file_block >= MAX_FILE_BLOCKS) {
+        block = 0; // not mapped until bmap_alloc converts the inode
+        len = MAX_EXTENT_FILE_BLOCKS - file_block;
+    } else if (file_block < NDIRECT) {
+        // A hole here stops at the last direct block even without an indirect block, so
+        // bmap_alloc places that one before the data it maps
+        block = ino.direct[file_block];
+        len = pointer_run(ino.direct, file_block, NDIRECT);
+    } else if (ino.indirect == 0) {
+        block = 0;
+        len = MAX_FILE_BLOCKS - file_block;
+    } else {
+        uint32_t scratch[NINDIRECT];
+        BlockRef ref;
+        const uint32_t* indirect_block = (const uint32_t*)block_load(ctx, ino.indirect, ref, (char*)scratch, BlockKind::Indirect);
+        if (!indirect_block) return -1;
+        block = indirect_block[file_block - NDIRECT];
+        len = pointer_run(indirect_block, file_block - NDIRECT, NINDIRECT);
+    }
+    if (cache && block > 0) *cache = BmapRun{file_block, (uint32_t)block, len};
+    if (run) *run = len;
+    return block;
+}
+
+// Points file blocks [file_block, file_block + count) at [start, start + count) in the
+// pointer format; past the direct blocks the indirect block must already exist
+static bool set_pointers(FSContext& ctx, Inode& ino, int file_block, uint32_t start, int count) {
+    int i = 0;
+    for (; i < count && file_block + i < NDIRECT; ++i) ino.direct[file_block + i] = start + i;
+    if (i == count) return true;
+    uint32_t scratch[NINDIRECT];
+    BlockRef ref;
+    uint32_t* indirect_block = (uint32_t*)block_load(ctx, ino.indirect, ref, (char*)scratch, BlockKind::Indirect);
+    if (!indirect_block) return false;
+    for (; i < count; ++i) indirect_block[file_block + i - NDIRECT] = start + i;
+    return block_store(ctx, ino.indirect, ref, (char*)indirect_block);
+}
+
+// Rebuilds a pointer-mapped inode's mapping as an extent tree. On failure the tree blocks
+// allocated so far are freed and `ino` is left as it was.
+static bool convert_to_extents(FSContext& ctx, Inode& ino) {
+    Inode converted = ino;
+    std::memset(converted.extents, 0, sizeof(converted.extents));
+    converted.mode |= INODE_EXTENTS;
+    bool inserted = true;
+    bool readable = bmap_walk(ctx, ino, [&](int file_block, uint32_t block, int count) {
+        inserted = extent_insert(ctx, converted, Extent{(uint32_t)file_block, block, (uint32_t)count});
+        return inserted;
+    });
+    if (!readable || !inserted) {
+        extent_walk(ctx, converted, [](const Extent&) { return true; }, [&](uint32_t block) { block_free(ctx, block); });
+        return false;
+    }
+    if (ino.indirect) block_free(ctx, ino.indirect);
+    ino = converted;
+    return true;
+}
+
+bool bmap_alloc(FSContext &ctx, Inode &ino, int first, int count) {
+    if (!uses_extents(ino) && first + count > MAX_FILE_BLOCKS && ctx.sb.version >= SFS_VERSION_EXTENTS &&
+        !convert_to_extents(ctx, ino)) {
+        return false;
+    }
+    int end = std::min(first + count, bmap_max_blocks(ctx, ino));
+    for (int b = first; b < end;) {
+        int run;
+        int block_no = bmap_lookup(ctx, ino, b, &run);
+        if (block_no < 0) return false;
+        if (block_no > 0) {
+            b += run;
+            continue;
+        }
+        int prev = b > 0 ? bmap_lookup(ctx, ino, b - 1) : 0;
+        uint32_t goal = prev > 0 ? prev + 1 : 0;
+        if (!uses_extents(ino) && b >= NDIRECT && ino.indirect == 0) {
+            int indirect = block_alloc(ctx, goal);
+            if (indirect < 0) return false;
+            char scratch[BLOCK_SIZE];
+            BlockRef ref;
+            char* data = block_load(ctx, indirect, ref, scratch, BlockKind::Indirect, /*zero_fill=*/true);
+            if (!data || !block_store(ctx, indirect, ref, data)) return false;
+            ino.indirect = indirect;
+            goal = indirect + 1;
+        }
+        int got;
+        int start = block_alloc_range(ctx, std::min(run, end - b), got, goal);
+        if (start < 0) return false;
+        bool mapped = uses_extents(ino)
+            ? extent_insert(ctx, ino, Extent{(uint32_t)b, (uint32_t)start, (uint32_t)got})
+            : set_pointers(ctx, ino, b, start, got);
+        if (!mapped) {
+            block_free_range(ctx, start, got);
+            return false;
+        }
+        b += got;
+    }
+    return true;
+}
+
+bool bmap_walk(FSContext &ctx, const Inode &ino, const std::function<bool(int, uint32_t, int)> &data,
+               const std::function<void(uint32_t)> &meta) {
+    if (uses_extents(ino)) {
+        return extent_walk(ctx, ino, [&](const Extent& e) { return data(e.logical, e.start, e.len); }, meta);
+    }
+    int run;
+    for (int i = 0; i < NDIRECT; i += run) {
+        run = pointer_run(ino.direct, i, NDIRECT);
+        if (ino.direct[i] && !data(i, ino.direct[i], run)) return true;
+    }
+    if (ino.indirect == 0) return true;
+    if (meta) meta(ino.indirect);
+    uint32_t scratch[NINDIRECT];
+    BlockRef ref;
+    const uint32_t* indirect_block = (const uint32_t*)block_load(ctx, ino.indirect, ref, (char*)scratch, BlockKind::Indirect);
+    if (!indirect_block) return false;
+    for (int i = 0; i < NINDIRECT; i += run) {
+        run = pointer_run(indirect_block, i, NINDIRECT);
+        if (indirect_block[i] && !data(NDIRECT + i, indirect_block[i], run)) return true;
+    }
+    return true;
+}
+
+void bmap_free(FSContext &ctx, const Inode &ino) {
+    bmap_walk(ctx, ino,
+              [&](int, uint32_t block, int count) {
+                  block_free_range(ctx, block, count);
+                  return true;
+              },
+              [&](uint32_t block) { block_free(ctx, block); });
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include "stat.h"
+
+struct FSContext;
+struct Inode;
+
+// File block -> data block mapping, for both inode formats: NDIRECT direct pointers plus one
+// indirect block, or an extent tree (extent.h, INODE_EXTENTS). sfs and dir go through these and
+// never look at the pointers themselves.
+
+// Starts a new inode with nothing mapped, extent-mapped when the image supports it
+void bmap_init(FSContext &ctx, Inode &ino);
+
+// File blocks the inode can map: past MAX_FILE_BLOCKS a pointer-mapped inode converts to an
+// extent tree (see bmap_alloc) where the image supports those
+int bmap_max_blocks(FSContext &ctx, const Inode &ino);
+
+// The last mapped run a lookup resolved for an open file (OpenFile::map). Blocks never move once
+// mapped, so sequential access through the run needs no walk of the indirect block or extent
+// tree; sfs_remove clears the runs of the removed inode.
+struct BmapRun {
+    int file_block = 0;
+    uint32_t block = 0;
+    int count = 0; // 0: nothing cached
+};
+
+// Data block of file block `file_block`: 0 for a hole, -1 if out of range or unreadable.
+// `run`, if given, gets how many blocks from there on are contiguous on disk (for a hole, how
+// many stay unmapped) as far as this one lookup can see. With `cache`, a block inside the
+// cached run is answered from it, and a mapped run that had to be resolved replaces it.
+int bmap_lookup(FSContext &ctx, const Inode &ino, int file_block, int *run = nullptr, BmapRun *cache = nullptr);
+
+// Gives the unmapped file blocks among [first, first + count) data blocks. Each stretch of them
+// is allocated as a run with block_alloc_range, aimed right after the file's previous block so
+// a file written in pieces still ends up contiguous on disk; an indirect block goes in line
+// with the data. A pointer-mapped inode asked to grow past MAX_FILE_BLOCKS is first converted
+// to an extent tree, its runs becoming extents and its indirect block freed. Stops at the
+// first allocation that fails; what was mapped stays in `ino`, which the caller writes back.
+bool bmap_alloc(FSContext &ctx, Inode &ino, int first, int count);
+
+// Calls data(file_block, block, count) for every run of contiguous mapped blocks in file order
+// until it returns false, and meta(block) for every indirect or extent tree block. False if
+// one of those cannot be read.
+bool bmap_walk(FSContext &ctx, const Inode &ino, const std::function<bool(int, uint32_t, int)> &data,
+               const std::function<void(uint32_t)> &meta = nullptr);
+
+// Frees every block the inode maps, the mapping's own blocks included
+void bmap_free(FSContext &ctx, const Inode &ino);
@@ -0,0 +1,131 @@
+#include "cache_policy.h"
+#include <algorithm>
+
+std::optional<CachePolicy> parse_cache_policy(const std::string& name) {
+    if (name.empty() || name == "lru") return CachePolicy::LRU;
+    if (name == "2q") return CachePolicy::TwoQ;
+    if (name == "arc") return CachePolicy::ARC;
+    return std::nullopt;
+}
+
+const char* cache_policy_name(CachePolicy policy) {
+    switch (policy) {
+        case CachePolicy::LRU: return "lru";
+        case CachePolicy::TwoQ: return "2q";
+        case CachePolicy::ARC: return "arc";
+    }
+    return "?";
+}
+
+class LruPolicy : public ReplacementPolicy {
+public:
+    void insert(Key key) override { lru_.pushFront(key); }
+    void access(Key key) override { lru_.moveToFront(key); }
+    void remove(Key key) override { lru_.erase(key); }
+    std::optional<Key> victim(const Evictable& evictable) const override { return lru_.findBack(evictable); }
+
+private:
+    KeyList lru_;
+};
+
+// Full 2Q (Johnson & Shasha, VLDB '94) with their suggested sizes: A1in, the FIFO for first
+// references, gets a quarter of the cache; A1out remembers the keys of half a cache's worth of
+// blocks pushed out of A1in. A miss on a key in A1out goes straight to Am, the main LRU.
+class TwoQPolicy : public ReplacementPolicy {
+public:
+    explicit TwoQPolicy(size_t capacity)
+        : kin_(std::max<size_t>(1, capacity / 4)), kout_(std::max<size_t>(1, capacity / 2)) {}
+
+    void insert(Key key) override {
+        if (a1out_.erase(key)) am_.pushFront(key);
+        else a1in_.pushFront(key);
+    }
+
+    // Hits in A1in are left alone: they are usually correlated references right after the miss
+    void access(Key key) override {
+        if (am_.contains(key)) am_.moveToFront(key);
+    }
+
+    void remove(Key key) override {
+        if (!a1in_.erase(key)) {
+            am_.erase(key);
+            return;
+        }
+        a1out_.pushFront(key);
+        if (a1out_.size() > kout_) a1out_.popBack();
+    }
+
+    std::optional<Key> victim(const Evictable& evictable) const override {
+        bool from_in = a1in_.size() > kin_ || am_.empty();
+        const KeyList& first = from_in ? a1in_ : am_;
+        const KeyList& second = from_in ? am_ : a1in_;
+        if (auto key = first.findBack(evictable)) return key;
+        return second.findBack(evictable);
+    }
+
+private:
+    size_t kin_, kout_;
+    KeyList a1in_, a1out_, am_;
+};
+
+// ARC (Megiddo & Modha, FAST '03). T1 holds blocks seen once recently, T2 blocks seen at least
+// twice; B1 and B2 remember keys recently evicted from each. p is the target size of T1: a miss
+// that hits B1 means T1 was evicted too eagerly and grows it, a hit in B2 shrinks it.
+class ArcPolicy : public ReplacementPolicy {
+public:
+    explicit ArcPolicy(size_t capacity) : c_(std::max<size_t>(1, capacity)) {}
+
+    void insert(Key key) override {
+        if (t1_.contains(key) || t2_.contains(key)) return access(key);
+        if (b1_.erase(key)) {
+            p_ = std::min(c_, p_ + std::max<size_t>(1, b2_.size() / (b1_.size() + 1)));
+            t2_.pushFront(key);
+        } else if (b2_.erase(key)) {
+            size_t delta = std::max<size_t>(1, b1_.size() / (b2_.size() + 1));
+            p_ = p_ > delta ? p_ - delta : 0;
+            t2_.pushFront(key);
+        } else {
+            t1_.pushFront(key);
+        }
+        trimGhosts();
+    }
+
+    void access(Key key) override {
+        if (t1_.erase(key)) t2_.pushFront(key);
+        else t2_.moveToFront(key);
+    }
+
+    void remove(Key key) override {
+        if (t1_.erase(key)) b1_.pushFront(key);
+        else if (t2_.erase(key)) b2_.pushFront(key);
+        trimGhosts();
+    }
+
+    std::optional<Key> victim(const Evictable& evictable) const override {
+        bool from_t1 = !t1_.empty() && (t1_.size() > p_ || t2_.empty());
+        const KeyList& first = from_t1 ? t1_ : t2_;
+        const KeyList& second = from_t1 ? t2_ : t1_;
+        if (auto key = first.findBack(evictable)) return key;
+        return second.findBack(evictable);
+    }
+
+private:
+    size_t c_;
+    size_t p_ = 0;
+    KeyList t1_, t2_, b1_, b2_;
+
+    // The directory stays within 2c keys, c of them on the recency side
+    void trimGhosts() {
+        while (t1_.size() + b1_.size() > c_ && !b1_.empty()) b1_.popBack();
+        while (t1_.size() + t2_.size() + b1_.size() + b2_.size() > 2 * c_ && !b2_.empty()) b2_.popBack();
+    }
+};
+
+std::unique_ptr<ReplacementPolicy> ReplacementPolicy::create(CachePolicy policy, size_t capacity) {
+    switch (policy) {
+        case CachePolicy::TwoQ: return std::make_unique<TwoQPolicy>(capacity);
+        case CachePolicy::ARC: return std::make_unique<ArcPolicy>(capacity);
+        case CachePolicy::LRU: break;
+    }
+    return std::make_unique<LruPolicy>();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+// Replacement policies for the block cache. A policy only orders keys; the cache owns the
+// blocks and tells the policy what happened to them. Eviction is driven by the cache, which
+// asks for a victim among the keys it is able to drop (unpinned, clean, ...).
+//  LRU - plain recency; one large scan flushes everything else
+//  2Q  - new blocks wait in a small FIFO and only reach the main LRU when re-referenced after
+//        leaving it, so blocks touched once (scans, readahead) never displace hot ones
+//  ARC - adapts the split between recently and frequently used blocks from hits on ghost
+//        lists of recently evicted keys
+enum class CachePolicy { LRU, TwoQ, ARC };
+
+// Parses "lru", "2q" or "arc"; an empty string is LRU. nullopt for anything else.
+std::optional<CachePolicy> parse_cache_policy(const std::string& name);
+const char* cache_policy_name(CachePolicy policy);
+
+class ReplacementPolicy {
+public:
+    using Key = uint64_t;
+    using Evictable = std::function<bool(Key)>;
+
+    virtual ~ReplacementPolicy() = default;
+
+    // key was brought into the cache (a miss)
+    virtual void insert(Key key) = 0;
+    // key was referenced again while cached (a hit)
+    virtual void access(Key key) = 0;
+    // key left the cache, evicted or dropped
+    virtual void remove(Key key) = 0;
+    // The key the policy would evict next among those for which evictable holds; nullopt if
+    // none does. Nothing changes until the cache calls remove().
+    virtual std::optional<Key> victim(const Evictable& evictable) const = 0;
+
+    // capacity is the number of blocks the cache holds; 2Q and ARC size their lists from it
+    static std::unique_ptr<ReplacementPolicy> create(CachePolicy policy, size_t capacity);
+};
+
+// Recency-ordered key list with O(1) move-to-front and removal, the building block of the
+// policies above.
+class KeyList {
+public:
+    using Key = ReplacementPolicy::Key;
+
+    bool contains(Key key) const { return index_.count(key) != 0; }
+    size_t size() const { return list_.size(); }
+    bool empty() const { return list_.empty(); }
+
+    void pushFront(Key key) {
+        list_.push_front(key);
+        index_[key] = list_.begin();
+    }
+    bool erase(Key key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) return false;
+        list_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+    void moveToFront(Key key) { list_.splice(list_.begin(), list_, index_.at(key)); }
+    Key back() const { return list_.back(); }
+    void popBack() {
+        index_.erase(list_.back());
+        list_.pop_back();
+    }
+
+    // Least recent key satisfying pred
+    std::optional<Key> findBack(const ReplacementPolicy::Evictable& pred) const {
+        for (auto it = list_.rbegin(); it != list_.rend(); ++it) {
+            if (pred(*it)) return *it;
+        }
+        return std::nullopt;
+    }
+
+private:
+    std::list<Key> list_;
+    std::unordered_map<Key, std::list<Key>::iterator> index_;
+};
@@ -0,0 +1,108 @@
+#include "dcache.h"
+
+DentryCache::DentryCache(size_t capacity, size_t path_capacity)
+    : capacity_(capacity), path_capacity_(path_capacity) {}
+
+DentryCache::Dentry* DentryCache::find(int dir, const std::string& name) {
+    auto d = dirs_.find(dir);
+    if (d == dirs_.end()) return nullptr;
+    auto it = d->second.find(name);
+    return it == d->second.end() ? nullptr : &it->second;
+}
+
+bool DentryCache::lookup(int dir, const std::string& name, int& inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    Dentry* dentry = find(dir, name);
+    if (!dentry) {
+        ++stats_.misses;
+        return false;
+    }
+    ++stats_.hits;
+    lru_.splice(lru_.begin(), lru_, dentry->lru);
+    inum = dentry->inum;
+    return true;
+}
+
+void DentryCache::insert(int dir, const std::string& name, int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto& entries = dirs_[dir];
+    auto it = entries.find(name);
+    if (it != entries.end()) {
+        it->second.inum = inum;
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        return;
+    }
+    lru_.emplace_front(dir, name);
+    entries.emplace(name, Dentry{inum, lru_.begin()});
+    if (++size_ > capacity_) {
+        Key victim = lru_.back();
+        erase(victim.first, victim.second);
+    }
+}
+
+void DentryCache::added(int dir, const std::string& name, int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    Dentry* dentry = find(dir, name);
+    if (dentry && dentry->inum == kMissing) {
+        dentry->inum = inum;
+        lru_.splice(lru_.begin(), lru_, dentry->lru);
+        return;
+    }
+    // Another entry of that name may exist and, depending on the slot the new one took, now
+    // be shadowed by it
+    erase(dir, name);
+    paths_.clear();
+}
+
+void DentryCache::removed(int dir, const std::string& name) {
+    std::lock_guard<std::mutex> lk(mu_);
+    erase(dir, name);
+    paths_.clear();
+}
+
+void DentryCache::forgetDir(int dir) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto d = dirs_.find(dir);
+    if (d != dirs_.end()) {
+        for (auto& [name, dentry] : d->second) lru_.erase(dentry.lru);
+        size_ -= d->second.size();
+        dirs_.erase(d);
+    }
+    paths_.clear();
+}
+
+bool DentryCache::lookupPath(const std::string& path, int& inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = paths_.find(path);
+    if (it == paths_.end()) return false;
+    ++stats_.path_hits;
+    inum = it->second;
+    return true;
+}
+
+void DentryCache::insertPath(const std::string& path, int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (paths_.size() >= path_capacity_) paths_.clear();
+    paths_[path] = inum;
+}
+
+size_t DentryCache::size() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return size_;
+}
+
+DentryCache::Stats DentryCache::stats() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return stats_;
+}
+
+void DentryCache::erase(int dir, const std::string& name) {
+    auto d = dirs_.find(dir);
+    if (d == dirs_.end()) return;
+    auto it = d->second.find(name);
+    if (it == d->second.end()) return;
+    lru_.erase(it->second.lru);
+    d->second.erase(it);
+    --size_;
+    if (d->second.empty()) dirs_.erase(d);
+}
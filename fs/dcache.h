@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "stat.h"
+
+// Dentry cache (dcache): the result of looking a name up in a directory, keyed by (directory
+// inum, name), so resolving a path costs one hash lookup per component rather than a scan of
+// each directory's blocks. A name known to be missing is cached as a negative entry (inum -1),
+// which is what lets the create after a failed open skip its scan. Entries are kept in LRU
+// order up to DCACHE_ENTRIES.
+//
+// On top of it, whole paths that resolved are cached up to DCACHE_PATHS (all of them are
+// dropped when that fills up), so a hot path is a single lookup however deep it is.
+//
+// dir_add and dir_remove keep both up to date: a cached path can only change when an entry
+// it goes through is removed or shadowed by an added duplicate name, and those drop every
+// cached path. A removed directory's entries go with it (forgetDir), as its inum can be
+// reused. Locked, since shared-lock operations resolve paths concurrently.
+class DentryCache {
+public:
+    static constexpr int kMissing = -1; // a negative entry
+
+    struct Stats {
+        uint64_t hits = 0;      // dentries found, positive or negative
+        uint64_t misses = 0;    // names the directory had to be scanned for
+        uint64_t path_hits = 0; // whole paths found
+    };
+
+    explicit DentryCache(size_t capacity = DCACHE_ENTRIES, size_t path_capacity = DCACHE_PATHS);
+
+    // True with `inum` set (kMissing for a negative entry) if dir/name is cached
+    bool lookup(int dir, const std::string& name, int& inum);
+    // Records what a scan of dir found for name, kMissing if nothing
+    void insert(int dir, const std::string& name, int inum);
+    // name was added to dir as inum
+    void added(int dir, const std::string& name, int inum);
+    // name was removed from dir, or may have changed in a way not tracked
+    void removed(int dir, const std::string& name);
+    // dir is gone: drops its entries and every cached path
+    void forgetDir(int dir);
+
+    bool lookupPath(const std::string& path, int& inum);
+    void insertPath(const std::string& path, int inum);
+
+    size_t size();
+    Stats stats();
+
+private:
+    using Key = std::pair<int, std::string>;
+    struct Dentry {
+        int inum;
+        std::list<Key>::iterator lru;
+    };
+
+    Dentry* find(int dir, const std::string& name);
+    void erase(int dir, const std::string& name);
+
+    std::mutex mu_;
+    std::unordered_map<int, std::unordered_map<std::string, Dentry>> dirs_;
+    std::list<Key> lru_; // most recently used first
+    size_t size_ = 0;
+    size_t capacity_;
+    std::unordered_map<std::string, int> paths_;
+    size_t path_capacity_;
+    Stats stats_;
+};
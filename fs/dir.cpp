@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include "stat.h"
 #include "fs_context.h"
 #include "inode.h"
+#include "bmap.h"
 #include "block_manager.h"
 #include "block_cache_controller.h"
 
@@ -10,299 +13,488 @@ struct DirEntry {
     char name[252];
 };
 
-int dir_lookup(FSContext &ctx, int dir_inum, const std::string &name) {
-    Inode dir_inode;
+constexpr int DIR_ENTRIES = BLOCK_SIZE / sizeof(DirEntry);
 
-    if (!inode_read(ctx, dir_inum, dir_inode)) return -1;
-    
-    char block[BLOCK_SIZE];
-    // Search in direct blocks
-    for (int i = 0; i < NDIRECT; ++i) {
-        if (dir_inode.direct[i] == 0) continue;
-        //if (!ctx.disk.disk_read(dir_inode.direct[i], block)) return false;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(dir_inode.direct[i]);
-            std::memcpy(block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.direct[i], block)) return false;        
-        }
-        
+// Indexed directories (INODE_DIR_INDEX) are laid out like ext4's htree. File block 0 is the root
+// of an index on a hash of the name; entries live in leaf blocks of the usual DirEntry format,
+// each holding the names whose hash falls in its range, so a lookup reads one block per index
+// level plus one leaf. An index entry covers the hashes from its own up to the next entry's
+// (the first is always 0). The root points at leaves (depth 0) or at index blocks that do
+// (depth 1). A full leaf is split at a hash boundary, so all names of one hash share a leaf.
+// Blocks are never given back: the inode's size counts the file blocks and new ones are appended.
+struct DirIndexHeader {
+    uint32_t magic;
+    uint16_t depth; // index levels below this block
+    uint16_t count;
+};
 
-        DirEntry* entries = (DirEntry*) block;
-        int num_entries = BLOCK_SIZE / sizeof(DirEntry);
+struct DirIndexEntry {
+    uint32_t hash;       // lowest name hash under this entry
+    uint32_t file_block; // a leaf, or an index block one level down
+};
 
-        for (int j = 0; j < num_entries; ++j) {
-            if (entries[j].inum != 0 && name == entries[j].name) {
-                int inum_out = entries[j].inum;
-                return inum_out;
-            }
-        }
+constexpr uint32_t DIR_INDEX_MAGIC = 0x58444944; // "DIDX"
+constexpr int DIR_INDEX_ENTRIES = (BLOCK_SIZE - sizeof(DirIndexHeader)) / sizeof(DirIndexEntry);
+constexpr int DIR_INDEX_MAX_DEPTH = 1;
+// Leaf and index block fill when a directory is first indexed, so the next adds do not all split
+constexpr int DIR_LEAF_FILL = DIR_ENTRIES * 3 / 4;
+constexpr int DIR_INDEX_FILL = DIR_INDEX_ENTRIES * 3 / 4;
+
+static bool indexed(const Inode &dir) { return dir.mode & INODE_DIR_INDEX; }
+
+// FNV-1a
+static uint32_t name_hash(const char* name) {
+    uint32_t h = 2166136261u;
+    for (; *name; ++name) h = (h ^ (unsigned char)*name) * 16777619u;
+    return h;
+}
+
+static void set_entry(DirEntry &e, const std::string &name, int inum) {
+    e.inum = inum;
+    std::strncpy(e.name, name.c_str(), sizeof(e.name) - 1);
+    e.name[sizeof(e.name) - 1] = '\0';
+}
+
+// An entry with its name's hash, ordered as in an indexed directory's listing
+struct HashedEntry {
+    uint32_t hash;
+    DirEntry entry;
+    bool operator<(const HashedEntry &o) const {
+        return hash != o.hash ? hash < o.hash : std::strcmp(entry.name, o.entry.name) < 0;
     }
+};
 
-    // Search in indirect blocks
-    if (dir_inode.indirect != 0) {
-        uint32_t indirect_block[NINDIRECT];
-        //if (!ctx.disk.disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(dir_inode.indirect);
-            std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        }
+static HashedEntry hashed(const DirEntry &e) { return {name_hash(e.name), e}; }
+
+// Directory blocks are scanned in place: pinned in the cache, in the mapping, or in a scratch
+// buffer when going straight to disk.
 
-        for (int k = 0; k < NINDIRECT; ++k) {
-            if (indirect_block[k] == 0) continue;
-            //if (!ctx.disk.disk_read(indirect_block[k], block)) return false;
-            if (ctx.use_cache) {
-                auto& data = ctx.cache_controller->getBlock(indirect_block[k]);
-                std::memcpy(block, data.data(), BLOCK_SIZE);
-            } else {
-                if (!ctx.disk->disk_read(indirect_block[k], block)) return false;
+// Calls fn(block, ref, entries) on the directory's blocks in file order until it returns true.
+// 1 if fn stopped the scan, 0 if every block was seen, -1 if one could not be read. `end`, if
+// given, gets one past the last file block seen.
+static int scan_dir(FSContext &ctx, const Inode &dir_inode,
+                    const std::function<bool(uint32_t, BlockRef&, DirEntry*)> &fn, int* end = nullptr) {
+    char scratch[BLOCK_SIZE];
+    int result = 0;
+    bool readable = bmap_walk(ctx, dir_inode, [&](int file_block, uint32_t first, int count) {
+        for (int b = 0; b < count; ++b) {
+            BlockRef ref;
+            DirEntry* entries = (DirEntry*)block_load(ctx, first + b, ref, scratch, BlockKind::Dir);
+            if (!entries) {
+                result = -1;
+                return false;
             }
-            DirEntry* entries = (DirEntry*) block;
-            int num_entries = BLOCK_SIZE / sizeof(DirEntry);
-
-            for (int j = 0; j < num_entries; ++j) {
-                if (entries[j].inum != 0 && name == entries[j].name) {
-                    int inum_out = entries[j].inum;
-                    return inum_out;
-                }
+            if (fn(first + b, ref, entries)) {
+                result = 1;
+                return false;
             }
         }
+        if (end) *end = file_block + count;
+        return true;
+    });
+    return readable ? result : -1;
+}
+
+// File block `file_block` of a directory, loaded in place the same way; nullptr if it is not
+// mapped or cannot be read
+static char* load_dir_block(FSContext &ctx, const Inode &dir, int file_block, uint32_t &block, BlockRef &ref,
+                            char* scratch, bool zero_fill = false) {
+    int b = bmap_lookup(ctx, dir, file_block);
+    if (b <= 0) return nullptr;
+    block = b;
+    return block_load(ctx, block, ref, scratch, BlockKind::Dir, zero_fill);
+}
+
+// An index block copied out, to be searched or changed
+struct IndexNode {
+    int file_block = 0;
+    uint16_t depth = 0;
+    std::vector<DirIndexEntry> entries;
+};
+
+static bool read_index(FSContext &ctx, const Inode &dir, int file_block, IndexNode &out) {
+    char scratch[BLOCK_SIZE];
+    uint32_t block;
+    BlockRef ref;
+    const char* data = load_dir_block(ctx, dir, file_block, block, ref, scratch);
+    if (!data) return false;
+    DirIndexHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    if (h.magic != DIR_INDEX_MAGIC || h.depth > DIR_INDEX_MAX_DEPTH || h.count == 0 || h.count > DIR_INDEX_ENTRIES) {
+        return false;
     }
-    return -1;
+    const DirIndexEntry* e = (const DirIndexEntry*)(data + sizeof(h));
+    out.file_block = file_block;
+    out.depth = h.depth;
+    out.entries.assign(e, e + h.count);
+    return true;
 }
 
-int dir_add(FSContext &ctx, int dir_inum, const std::string &name, int inum) {
-    Inode dir_inode;
-    if (!inode_read(ctx, dir_inum, dir_inode)) return false;
+static bool write_index(FSContext &ctx, const Inode &dir, const IndexNode &node) {
+    char scratch[BLOCK_SIZE];
+    uint32_t block;
+    BlockRef ref;
+    char* data = load_dir_block(ctx, dir, node.file_block, block, ref, scratch, /*zero_fill=*/true);
+    if (!data) return false;
+    std::memset(data, 0, BLOCK_SIZE);
+    DirIndexHeader h{DIR_INDEX_MAGIC, node.depth, (uint16_t)node.entries.size()};
+    std::memcpy(data, &h, sizeof(h));
+    std::memcpy(data + sizeof(h), node.entries.data(), node.entries.size() * sizeof(DirIndexEntry));
+    return block_store(ctx, block, ref, data);
+}
 
-    char block[BLOCK_SIZE];
-
-    // Search for empty spot in direct blocks
-    for (int i = 0; i < NDIRECT; ++i) {
-        if (dir_inode.direct[i] == 0) {
-            dir_inode.direct[i] = block_alloc(ctx);
-            inode_write(ctx, dir_inum, dir_inode);
-            std::memset(block, 0, sizeof(block));
-        } else {
-            //if (!ctx.disk.disk_read(dir_inode.direct[i], block)) return false;
-            if (ctx.use_cache) {
-                auto& data = ctx.cache_controller->getBlock(dir_inode.direct[i]);
-                std::memcpy(block, data.data(), BLOCK_SIZE);
-            } else {
-                if (!ctx.disk->disk_read(dir_inode.direct[i], block)) return false;
-            }
+// Writes entries [first, last) as the whole of leaf `file_block`
+static bool write_leaf(FSContext &ctx, const Inode &dir, int file_block, const HashedEntry* first,
+                       const HashedEntry* last) {
+    char scratch[BLOCK_SIZE];
+    uint32_t block;
+    BlockRef ref;
+    DirEntry* entries = (DirEntry*)load_dir_block(ctx, dir, file_block, block, ref, scratch, /*zero_fill=*/true);
+    if (!entries) return false;
+    std::memset(entries, 0, BLOCK_SIZE);
+    for (int j = 0; first + j < last; ++j) entries[j] = first[j].entry;
+    return block_store(ctx, block, ref, (char*)entries);
+}
+
+// Route from the root to the leaf covering a hash: the index block at each level (root first),
+// the entry followed there and how many it has
+struct IndexPath {
+    int depth = 0; // the root's
+    IndexNode node[DIR_INDEX_MAX_DEPTH + 1];
+    int slot[DIR_INDEX_MAX_DEPTH + 1];
+    int leaf = 0;
+};
+
+static bool find_leaf(FSContext &ctx, const Inode &dir, uint32_t hash, IndexPath &path) {
+    int file_block = 0;
+    for (int level = 0; level <= DIR_INDEX_MAX_DEPTH; ++level) {
+        IndexNode &node = path.node[level];
+        if (!read_index(ctx, dir, file_block, node)) return false;
+        if (level == 0) path.depth = node.depth;
+        else if (node.depth != path.depth - level) return false;
+        auto after = std::upper_bound(node.entries.begin(), node.entries.end(), hash,
+                                      [](uint32_t h, const DirIndexEntry &e) { return h < e.hash; });
+        int slot = std::max(0, (int)(after - node.entries.begin()) - 1);
+        path.slot[level] = slot;
+        file_block = node.entries[slot].file_block;
+        if (node.depth == 0) {
+            path.leaf = file_block;
+            return true;
         }
+    }
+    return false;
+}
 
-        DirEntry* entries = (DirEntry*) block;
-        int num_entries = BLOCK_SIZE / sizeof(DirEntry);
+// Maps and zeroes file blocks [from, to) of a directory
+static bool zero_blocks(FSContext &ctx, Inode &dir, int from, int to) {
+    if (from >= to) return true;
+    bool mapped = bmap_alloc(ctx, dir, from, to - from);
+    for (int fb = from; fb < to; ++fb) write_leaf(ctx, dir, fb, nullptr, nullptr);
+    return mapped;
+}
 
-        for (int j = 0; j < num_entries; ++j) {
-            if (entries[j].inum == 0) {
-                entries[j].inum = inum;
-                std::strncpy(entries[j].name, name.c_str(), sizeof(entries[j].name) - 1);
-                entries[j].name[sizeof(entries[j].name) - 1] = '\0';
-                if (ctx.use_cache) {
-                    ctx.cache_controller->writeBlock(dir_inode.direct[i], block);
-                    return true;
-                } 
-                return ctx.disk->disk_write(dir_inode.direct[i], block);
-            }
+// Appends a zeroed block to an indexed directory; its file block, or -1
+static int append_block(FSContext &ctx, Inode &dir) {
+    int file_block = dir.size / BLOCK_SIZE;
+    if (!zero_blocks(ctx, dir, file_block, file_block + 1)) return -1;
+    dir.size += BLOCK_SIZE;
+    return file_block;
+}
+
+// Turns a linear directory whose blocks [0, end) are all full into an indexed one holding the
+// same entries plus the new one. Nothing is overwritten before the new layout is known to fit,
+// so when that fails the directory is still linear (with zeroed blocks possibly mapped past end).
+static bool build_index(FSContext &ctx, Inode &dir, int end, const std::string &name, int inum) {
+    std::vector<HashedEntry> all;
+    int found = scan_dir(ctx, dir, [&](uint32_t, BlockRef&, DirEntry* entries) {
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
+            if (entries[j].inum != 0) all.push_back(hashed(entries[j]));
+        }
+        return false;
+    });
+    if (found < 0) return false;
+    DirEntry added;
+    set_entry(added, name, inum);
+    all.push_back(hashed(added));
+    std::sort(all.begin(), all.end());
+
+    // Leaves of DIR_LEAF_FILL entries, or a few more to reach a hash boundary
+    std::vector<size_t> cuts{0};
+    for (size_t i = 1; i <= all.size(); ++i) {
+        size_t n = i - cuts.back();
+        if (i == all.size() || (n >= DIR_LEAF_FILL && all[i].hash != all[i - 1].hash)) {
+            cuts.push_back(i);
+        } else if (n == DIR_ENTRIES) {
+            return false; // more names of one hash than a leaf holds
         }
     }
+    int leaves = (int)cuts.size() - 1;
+    int interior = leaves > DIR_INDEX_ENTRIES ? (leaves + DIR_INDEX_FILL - 1) / DIR_INDEX_FILL : 0;
+    if (interior > DIR_INDEX_ENTRIES) return false;
+    int need = 1 + interior + leaves;
+    if (!zero_blocks(ctx, dir, end, need)) return false;
 
-    // Search for empty spot in indirect blocks
-    if (dir_inode.indirect == 0) {
-        dir_inode.indirect = block_alloc(ctx);
-        inode_write(ctx, dir_inum, dir_inode);
-        char zero[BLOCK_SIZE] = {0};
-        //if (!ctx.disk.disk_write(dir_inode.indirect, zero)) return false;
-        if (ctx.use_cache) {
-            ctx.cache_controller->writeBlock(dir_inode.indirect, zero);
-        } else {
-            if (!ctx.disk->disk_write(dir_inode.indirect, zero)) return false;
+    // Root in file block 0, then the index blocks below it, then the leaves
+    int first_leaf = 1 + interior;
+    for (int k = 0; k < leaves; ++k) {
+        if (!write_leaf(ctx, dir, first_leaf + k, &all[cuts[k]], all.data() + cuts[k + 1])) return false;
+    }
+    auto leaf_entry = [&](int k) { return DirIndexEntry{k == 0 ? 0 : all[cuts[k]].hash, (uint32_t)(first_leaf + k)}; };
+    IndexNode root{0, (uint16_t)(interior > 0), {}};
+    if (interior == 0) {
+        for (int k = 0; k < leaves; ++k) root.entries.push_back(leaf_entry(k));
+    }
+    for (int i = 0; i < interior; ++i) {
+        IndexNode node{1 + i, 0, {}};
+        for (int k = i * DIR_INDEX_FILL; k < std::min(leaves, (i + 1) * DIR_INDEX_FILL); ++k) {
+            node.entries.push_back(leaf_entry(k));
         }
+        if (!write_index(ctx, dir, node)) return false;
+        root.entries.push_back({node.entries[0].hash, (uint32_t)node.file_block});
     }
+    for (int fb = need; fb < end; ++fb) write_leaf(ctx, dir, fb, nullptr, nullptr);
+    if (!write_index(ctx, dir, root)) return false;
+    dir.mode |= INODE_DIR_INDEX;
+    dir.size = std::max(need, end) * BLOCK_SIZE;
+    return true;
+}
 
-    uint32_t indirect_block[NINDIRECT];
-    //if (!ctx.disk.disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-    if (ctx.use_cache) {
-        auto& data = ctx.cache_controller->getBlock(dir_inode.indirect);
-        std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-    } else {
-        if (!ctx.disk->disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
+// Adds `e` to the index block at `level` of the path, right after the entry followed there,
+// splitting blocks that overflow. A full root moves into two new blocks under a new root, which
+// is how the index gains its level; the caller checks there is room before the leaf splits.
+static bool index_insert(FSContext &ctx, Inode &dir, IndexPath &path, int level, DirIndexEntry e) {
+    IndexNode &node = path.node[level];
+    node.entries.insert(node.entries.begin() + path.slot[level] + 1, e);
+    if ((int)node.entries.size() <= DIR_INDEX_ENTRIES) return write_index(ctx, dir, node);
+
+    size_t half = node.entries.size() / 2;
+    int right_block = append_block(ctx, dir);
+    if (right_block < 0) return false;
+    IndexNode right{right_block, node.depth, {node.entries.begin() + half, node.entries.end()}};
+    node.entries.resize(half);
+    if (level > 0) {
+        return write_index(ctx, dir, right) && write_index(ctx, dir, node) &&
+               index_insert(ctx, dir, path, level - 1, {right.entries[0].hash, (uint32_t)right_block});
     }
-    for (int k = 0; k < NINDIRECT; ++k) {
-        if (indirect_block[k] == 0) {
-            indirect_block[k] = block_alloc(ctx);
-            char zero[BLOCK_SIZE] = {0};
-            //if (!ctx.disk.disk_write(indirect_block[k], zero)) return false;
-            //if (!ctx.disk.disk_write(dir_inode.indirect, (char*)indirect_block)) return false;
-        
-            if (ctx.use_cache) {
-                ctx.cache_controller->writeBlock(indirect_block[k], zero);
-                ctx.cache_controller->writeBlock(dir_inode.indirect, (char*)indirect_block);
-            } else {
-                if (!ctx.disk->disk_write(indirect_block[k], zero)) return false;
-                if (!ctx.disk->disk_write(dir_inode.indirect, (char*)indirect_block)) return false;
+    int left_block = append_block(ctx, dir);
+    if (left_block < 0) return false;
+    IndexNode left{left_block, node.depth, std::move(node.entries)};
+    IndexNode root{0, (uint16_t)(left.depth + 1), {{0, (uint32_t)left_block}, {right.entries[0].hash, (uint32_t)right_block}}};
+    return write_index(ctx, dir, left) && write_index(ctx, dir, right) && write_index(ctx, dir, root);
+}
+
+// Adds to the leaf the name hashes to, splitting it in two when full
+static bool indexed_add(FSContext &ctx, Inode &dir, const std::string &name, int inum) {
+    DirEntry added;
+    set_entry(added, name, inum);
+    uint32_t hash = name_hash(added.name);
+    IndexPath path;
+    if (!find_leaf(ctx, dir, hash, path)) return false;
+
+    std::vector<HashedEntry> all;
+    {
+        char scratch[BLOCK_SIZE];
+        uint32_t block;
+        BlockRef ref;
+        DirEntry* entries = (DirEntry*)load_dir_block(ctx, dir, path.leaf, block, ref, scratch);
+        if (!entries) return false;
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
+            if (entries[j].inum == 0) {
+                entries[j] = added;
+                return block_store(ctx, block, ref, (char*)entries);
             }
+            all.push_back(hashed(entries[j]));
         }
+    }
 
-        //if (!ctx.disk.disk_read(indirect_block[k], block)) return false;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(indirect_block[k]);
-            std::memcpy(block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(indirect_block[k], block)) return false;
+    bool index_full = path.depth == DIR_INDEX_MAX_DEPTH;
+    for (int level = 0; level <= path.depth; ++level) {
+        index_full = index_full && (int)path.node[level].entries.size() == DIR_INDEX_ENTRIES;
+    }
+    if (index_full) return false;
+    all.push_back({hash, added});
+    std::sort(all.begin(), all.end());
+    // Split at the hash boundary nearest the middle
+    int n = (int)all.size(), split = 0;
+    for (int d = 0; d < n && split == 0; ++d) {
+        for (int s : {n / 2 - d, n / 2 + d}) {
+            if (s > 0 && s < n && all[s].hash != all[s - 1].hash) {
+                split = s;
+                break;
+            }
         }
-        DirEntry* entries = (DirEntry*) block;
-        int num_entries = BLOCK_SIZE / sizeof(DirEntry);
+    }
+    if (split == 0) return false; // more names of one hash than a leaf holds
+    int right = append_block(ctx, dir);
+    if (right < 0) return false;
+    // The old leaf keeps every entry until the new one is in the index
+    return write_leaf(ctx, dir, right, &all[split], all.data() + n) &&
+           index_insert(ctx, dir, path, path.depth, {all[split].hash, (uint32_t)right}) &&
+           write_leaf(ctx, dir, path.leaf, all.data(), &all[split]);
+}
 
-        for (int j = 0; j < num_entries; ++j) {
-            if (entries[j].inum == 0) {
-                entries[j].inum = inum;
-                std::strncpy(entries[j].name, name.c_str(), sizeof(entries[j].name) - 1);
-                entries[j].name[sizeof(entries[j].name) - 1] = '\0';
-                if (ctx.use_cache) {
-                    ctx.cache_controller->writeBlock(indirect_block[k], block);    
-                    return true;
-                }
-                return ctx.disk->disk_write(indirect_block[k], block);
-            }
+// Calls fn on the leaves under an index block in hash order; false if one cannot be read
+static bool walk_leaves(FSContext &ctx, const Inode &dir, int file_block, const std::function<void(const DirEntry*)> &fn) {
+    IndexNode node;
+    if (!read_index(ctx, dir, file_block, node)) return false;
+    for (const DirIndexEntry &e : node.entries) {
+        if (node.depth > 0) {
+            if (!walk_leaves(ctx, dir, e.file_block, fn)) return false;
+            continue;
         }
+        char scratch[BLOCK_SIZE];
+        uint32_t block;
+        BlockRef ref;
+        const DirEntry* entries = (const DirEntry*)load_dir_block(ctx, dir, e.file_block, block, ref, scratch);
+        if (!entries) return false;
+        fn(entries);
     }
-    return false;
+    return true;
 }
 
-int dir_list(FSContext &ctx, int dir_inum, std::vector<std::string> &out) {
+// Calls fn(block, ref, entries) on the one leaf of an indexed directory that can hold `name`,
+// with scan_dir's result
+static int scan_leaf(FSContext &ctx, const Inode &dir, const std::string &name,
+                     const std::function<bool(uint32_t, BlockRef&, DirEntry*)> &fn) {
+    IndexPath path;
+    if (!find_leaf(ctx, dir, name_hash(name.c_str()), path)) return -1;
+    char scratch[BLOCK_SIZE];
+    uint32_t block;
+    BlockRef ref;
+    DirEntry* entries = (DirEntry*)load_dir_block(ctx, dir, path.leaf, block, ref, scratch);
+    if (!entries) return -1;
+    return fn(block, ref, entries) ? 1 : 0;
+}
+
+int dir_lookup(FSContext &ctx, int dir_inum, const std::string &name) {
+    int inum_out;
+    if (ctx.dcache.lookup(dir_inum, name, inum_out)) return inum_out;
+
     Inode dir_inode;
-    if (!inode_read(ctx, dir_inum, dir_inode)) return false;
+    if (!inode_read(ctx, dir_inum, dir_inode)) return -1;
 
-    char block[BLOCK_SIZE];
-
-    // Search in direct blocks
-    for (int i = 0; i < NDIRECT; ++i) {
-        if (dir_inode.direct[i] == 0) continue;
-        //if (!ctx.disk.disk_read(dir_inode.direct[i], block)) return false;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(dir_inode.direct[i]);
-            std::memcpy(block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.direct[i], block)) return false;
+    inum_out = -1;
+    auto match = [&](uint32_t, BlockRef&, DirEntry* entries) {
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
+            if (entries[j].inum != 0 && name == entries[j].name) {
+                inum_out = entries[j].inum;
+                return true;
+            }
         }
-        DirEntry* entries = (DirEntry*) block;
-        int num_entries = BLOCK_SIZE / sizeof(DirEntry);
+        return false;
+    };
+    int found = indexed(dir_inode) ? scan_leaf(ctx, dir_inode, name, match) : scan_dir(ctx, dir_inode, match);
+    // A scan that could not read every block proves nothing about a missing name
+    if (found >= 0) ctx.dcache.insert(dir_inum, name, found > 0 ? inum_out : DentryCache::kMissing);
+    return inum_out;
+}
+
+static int add_entry(FSContext &ctx, int dir_inum, const std::string &name, int inum) {
+    Inode dir_inode;
+    if (!inode_read(ctx, dir_inum, dir_inode)) return false;
+    if (indexed(dir_inode)) {
+        bool ok = indexed_add(ctx, dir_inode, name, inum);
+        inode_write(ctx, dir_inum, dir_inode); // blocks appended stay mapped even if the add failed
+        return ok;
+    }
 
-        for (int j = 0; j < num_entries; ++j) {
-            if (entries[j].inum != 0) {
-                std::string name_out = entries[j].name;
-                out.push_back(name_out);
+    // Search for an empty spot in the existing blocks
+    bool stored = false;
+    auto add = [&](uint32_t block, BlockRef& ref, DirEntry* entries) {
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
+            if (entries[j].inum == 0) {
+                set_entry(entries[j], name, inum);
+                stored = block_store(ctx, block, ref, (char*)entries);
                 return true;
             }
         }
+        return false;
+    };
+    int end = 0;
+    int found = scan_dir(ctx, dir_inode, add, &end);
+    if (found != 0) return found > 0 && stored;
+
+    // All full: a directory of DIR_INDEX_BLOCKS is indexed from here on; a smaller one, or one
+    // the index cannot take, grows by a block after its last one
+    if (end >= DIR_INDEX_BLOCKS && ctx.sb.version >= SFS_VERSION_DIR_INDEX) {
+        bool built = build_index(ctx, dir_inode, end, name, inum);
+        inode_write(ctx, dir_inum, dir_inode);
+        if (built) return true;
     }
+    if (!bmap_alloc(ctx, dir_inode, end, 1)) return false;
+    int block = bmap_lookup(ctx, dir_inode, end);
+    if (block <= 0) return false;
+    inode_write(ctx, dir_inum, dir_inode);
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    DirEntry* entries = (DirEntry*)block_load(ctx, block, ref, scratch, BlockKind::Dir, /*zero_fill=*/true);
+    if (!entries) return false;
+    return add(block, ref, entries) && stored;
+}
 
-    // Search in indirect blocks
-    if (dir_inode.indirect != 0) {
-        uint32_t indirect_block[NINDIRECT];
-        //if (!ctx.disk.disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(dir_inode.indirect);
-            std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        }
-        for (int k = 0; k < NINDIRECT; ++k) {
-            if (indirect_block[k] == 0) continue;
-            //if (!ctx.disk.disk_read(indirect_block[k], block)) return false;
-            if (ctx.use_cache) {
-                auto& data = ctx.cache_controller->getBlock(indirect_block[k]);
-                std::memcpy(block, data.data(), BLOCK_SIZE);
-            } else {
-                if (!ctx.disk->disk_read(indirect_block[k], block)) return false;
-            }
-            DirEntry* entries = (DirEntry*) block;
-            int num_entries = BLOCK_SIZE / sizeof(DirEntry);
-
-            for (int j = 0; j < num_entries; ++j) {
-                if (entries[j].inum != 0) {
-                    std::string name_out = entries[j].name;
-                    out.push_back(name_out);
-                    return true;
-                }
+int dir_add(FSContext &ctx, int dir_inum, const std::string &name, int inum) {
+    int ok = add_entry(ctx, dir_inum, name, inum);
+    if (ok) {
+        ctx.dcache.added(dir_inum, name, inum);
+    } else {
+        ctx.dcache.removed(dir_inum, name); // the entry may or may not have been written
+    }
+    return ok;
+}
+
+// A linear directory lists in slot order, an indexed one by (hash, name); either way entries
+// keep their relative order while others are added and removed.
+int dir_list(FSContext &ctx, int dir_inum, std::vector<std::string> &out) {
+    Inode dir_inode;
+    if (!inode_read(ctx, dir_inum, dir_inode)) return false;
+
+    if (indexed(dir_inode)) {
+        std::vector<HashedEntry> leaf;
+        return walk_leaves(ctx, dir_inode, 0, [&](const DirEntry* entries) {
+            leaf.clear();
+            for (int j = 0; j < DIR_ENTRIES; ++j) {
+                if (entries[j].inum != 0) leaf.push_back(hashed(entries[j]));
             }
-        }
+            std::sort(leaf.begin(), leaf.end());
+            for (const HashedEntry &e : leaf) out.push_back(e.entry.name);
+        });
     }
-    return false;
+    return scan_dir(ctx, dir_inode, [&](uint32_t, BlockRef&, DirEntry* entries) {
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
+            if (entries[j].inum != 0) out.push_back(entries[j].name);
+        }
+        return false;
+    }) == 0;
+}
+
+uint32_t dir_name_hash(const std::string &name) { return name_hash(name.c_str()); }
+
+int dir_index_depth(FSContext &ctx, int dir_inum) {
+    Inode dir_inode;
+    IndexNode root;
+    if (!inode_read(ctx, dir_inum, dir_inode) || !indexed(dir_inode)) return -1;
+    if (!read_index(ctx, dir_inode, 0, root)) return -1;
+    return root.depth;
 }
 
 int dir_remove(FSContext &ctx, int dir_inum, const std::string &name) {
     Inode dir_inode;
     if (!inode_read(ctx, dir_inum, dir_inode)) return false;
-    
-    // Traverse 12 direct pointers
-    char block[BLOCK_SIZE];
-    for (int i = 0;i < NDIRECT; ++i) {
-        if (dir_inode.direct[i] == 0) continue;
-        //if (!ctx.disk.disk_read(dir_inode.direct[i], block)) return -1;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(dir_inode.direct[i]);
-            std::memcpy(block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.direct[i], block)) return -1;
-        }
-        DirEntry* entries = (DirEntry*) block;
-        int num_entries = BLOCK_SIZE / sizeof(DirEntry);
 
-        for (int j = 0;j < num_entries; ++j) {
+    bool removed = false;
+    auto remove = [&](uint32_t block, BlockRef& ref, DirEntry* entries) {
+        for (int j = 0; j < DIR_ENTRIES; ++j) {
             if (entries[j].inum != 0 && name == entries[j].name) {
                 entries[j].inum = 0;
                 std::memset(entries[j].name, 0, sizeof(entries[j].name));
-                if (ctx.use_cache) {
-                    ctx.cache_controller->writeBlock(dir_inode.direct[i], block);
-                    return true;
-                }
-                return ctx.disk->disk_write(dir_inode.direct[i], block);
-            }
-        }
-    }
-
-    // Traverse indirect block if theres any
-    if (dir_inode.indirect != 0) {
-        uint32_t indirect_block[NINDIRECT];
-        //if (!ctx.disk.disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        if (ctx.use_cache) {
-           auto& data =  ctx.cache_controller->getBlock(dir_inode.indirect);
-            std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(dir_inode.indirect, (char*)indirect_block)) return false;
-        }
-        for (int k = 0;k < NINDIRECT; ++k) {
-            if (indirect_block[k] == 0) continue;
-            //if (!ctx.disk.disk_read(indirect_block[k], block)) return false;
-            if (ctx.use_cache) {
-                auto& data = ctx.cache_controller->getBlock(indirect_block[k]);
-                std::memcpy(block, data.data(), BLOCK_SIZE);
-            } else {
-                if (!ctx.disk->disk_read(indirect_block[k], block)) return false;
-            }
-            DirEntry* entries = (DirEntry*) block;
-            int num_entries = BLOCK_SIZE / sizeof(DirEntry);
-
-            for (int j = 0;j < num_entries; ++j) {
-                if (entries[j].inum != 0 && name == entries[j].name) {
-                    entries[j].inum = 0;
-                    std::memset(entries[j].name, 0, sizeof(entries[j].name));
-                    if (ctx.use_cache) {
-                        ctx.cache_controller->writeBlock(indirect_block[k], block);
-                        return true;
-                    }
-                    return ctx.disk->disk_write(indirect_block[k], block);
-                }
+                removed = block_store(ctx, block, ref, (char*)entries);
+                return true;
             }
         }
-    }
-    return false;
+        return false;
+    };
+    int found = indexed(dir_inode) ? scan_leaf(ctx, dir_inode, name, remove) : scan_dir(ctx, dir_inode, remove);
+    if (found != 0) ctx.dcache.removed(dir_inum, name);
+    if (found < 0) return -1;
+    return found > 0 && removed;
 }
-
@@ -11,3 +11,9 @@ int dir_lookup(FSContext &ctx, int dir_inum, const std::string &name);
 int dir_add(FSContext &ctx, int dir_inum, const std::string &name, int inum);
 int dir_list(FSContext &ctx, int dir_inum, std::vector<std::string> &out);
 int dir_remove(FSContext &ctx, int dir_inu, const std::string &name);
+
+// The hash an indexed directory files names under; it lists them in (hash, name) order
+uint32_t dir_name_hash(const std::string &name);
+// Index levels below an indexed directory's root (0: it points at the leaves), -1 for a linear
+// directory or one that cannot be read
+int dir_index_depth(FSContext &ctx, int dir_inum);
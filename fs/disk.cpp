@@ -1,15 +1,28 @@
 #include "disk.h"
-#include <fstream>
+#include "aligned_buffer.h"
 #include <vector>
 #include <iostream>
 #include <filesystem>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace fs = std::filesystem;
 Disk::~Disk() {
-    if (file_.is_open()) file_.close();
+    engine_.reset(); // drains in-flight requests before the fd goes away
+    if (map_) {
+        msync(map_, map_len_, MS_SYNC);
+        munmap(map_, map_len_);
+    }
+    if (fd_ >= 0) close(fd_);
 }
 
-bool Disk::disk_init(const std::string& path) {
+bool Disk::disk_init(const std::string& path, const DiskOptions& options) {
     // 1) Prepare the images/directory
     const fs::path img_dir = fs::current_path() / "images";
     std::error_code ec;
@@ -21,39 +34,282 @@ bool Disk::disk_init(const std::string& path) {
     }
     // 2) Build the full path: images/<name>
     fs::path full = img_dir / path;
-    auto full_str = full.string();
-    // 3) Try open existing image
-    file_.open(full_str, std::ios::in | std::ios::out | std::ios::binary);
-    if (!file_.is_open()) {
-        // Create file and zero-fill
-        std::ofstream create(full_str, std::ios::out | std::ios::binary);
-        if (!create.is_open()) {
-            std::cerr<<"[Disk] Failed to create "<<path<<"\n";
+    path_ = full.string();
+    // 3) Open existing image, or create a new one. Size is set with ftruncate, so the file is
+    //    sparse and reads of never-written blocks return zeros; creation is instant at any size.
+    fd_ = open(path_.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd_ < 0 && errno == ENOENT) {
+        fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            std::cerr<<"[Disk] Failed to create "<<path_<<": "<<strerror(errno)<<"\n";
+            return false;
+        }
+        off_t len = (off_t)(options.create_blocks * BLOCK_SIZE);
+        int err = 0;
+        if (options.preallocate) {
+            // Reserve real extents up front; fall back to sparse where fallocate is unsupported
+            err = posix_fallocate(fd_, 0, len);
+            if (err == EOPNOTSUPP || err == EINVAL) err = ftruncate(fd_, len) == 0 ? 0 : errno;
+        } else {
+            err = ftruncate(fd_, len) == 0 ? 0 : errno;
+        }
+        if (err != 0) {
+            std::cerr<<"[Disk] Failed to size "<<path_<<": "<<strerror(err)<<"\n";
+            close(fd_);
+            fd_ = -1;
+            unlink(path_.c_str());
             return false;
         }
-        std::vector<char> zeros((size_t)BLOCK_SIZE * NUM_BLOCKS, 0);
-        create.write(zeros.data(), zeros.size());
-        create.close();
-        file_.open(full_str, std::ios::in | std::ios::out | std::ios::binary);
     }
-    if (!file_.is_open()) {
-        std::cerr<<"[Disk] Failed to open "<<full_str<<"\n";
+    if (fd_ < 0) {
+        std::cerr<<"[Disk] Failed to open "<<path_<<": "<<strerror(errno)<<"\n";
         return false;
     }
-    std::cout<<"[Disk] Using disk image: "<<full_str<<"\n";
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        std::cerr<<"[Disk] Failed to stat "<<path_<<": "<<strerror(errno)<<"\n";
+        return false;
+    }
+    num_blocks_ = (uint64_t)st.st_size / BLOCK_SIZE;
+    DiskMode mode = options.mode;
+    if (mode == DiskMode::Mapped) {
+        size_t len = num_blocks_ * BLOCK_SIZE;
+        void* p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (p != MAP_FAILED) {
+            map_ = (char*)p;
+            map_len_ = len;
+            std::cout<<"[Disk] Using disk image: "<<path_<<" (mmap)\n";
+            return true;
+        }
+        std::cerr<<"[Disk] mmap of "<<path_<<" failed ("<<strerror(errno)<<"), using buffered I/O\n";
+    }
+    if (mode == DiskMode::Direct) {
+        // Linux lets O_DIRECT be toggled on an open fd; EINVAL means the filesystem can't do it
+        int flags = fcntl(fd_, F_GETFL);
+        if (flags >= 0 && fcntl(fd_, F_SETFL, flags | O_DIRECT) == 0) {
+            direct_ = true;
+        } else {
+            std::cerr<<"[Disk] O_DIRECT not supported for "<<path_<<" ("<<strerror(errno)<<"), using buffered I/O\n";
+        }
+    }
+    engine_ = IOEngine::create(options.engine, fd_, BLOCK_SIZE, IO_QUEUE_DEPTH);
+    std::cout<<"[Disk] Using disk image: "<<path_<<" ("<<engine_->name()<<" engine"<<(direct_ ? ", O_DIRECT" : "")<<")\n";
     return true;
 }
 
-bool Disk::disk_read(int block_num, char* buffer) {
-    if (block_num < 0 || block_num >= NUM_BLOCKS) return false;
-    file_.seekg(block_num * BLOCK_SIZE);
-    file_.read(buffer, BLOCK_SIZE);
-    return file_.good();
+// Runs preadv/pwritev until every iovec is done, resuming after short transfers.
+int Disk::transfer(std::vector<struct iovec>& iov, uint64_t first_block, size_t count, bool write) {
+    if (fd_ < 0) return -EBADF;
+    if (first_block > num_blocks_ || count > num_blocks_ - first_block) return -EINVAL;
+    if (map_) {
+        size_t pos = first_block * BLOCK_SIZE;
+        for (const struct iovec& v : iov) {
+            if (write) std::memcpy(map_ + pos, v.iov_base, v.iov_len);
+            else std::memcpy(v.iov_base, map_ + pos, v.iov_len);
+            pos += v.iov_len;
+        }
+        return 0;
+    }
+    if (direct_) {
+        for (const struct iovec& v : iov) {
+            if (!is_direct_aligned(v.iov_base, v.iov_len)) return transfer_bounced(iov, first_block, count, write);
+        }
+    }
+    off_t offset = (off_t)(first_block * BLOCK_SIZE);
+    size_t idx = 0;
+    while (idx < iov.size()) {
+        int cnt = (int)std::min<size_t>(iov.size() - idx, IOV_MAX);
+        ssize_t n = write ? pwritev(fd_, &iov[idx], cnt, offset) : preadv(fd_, &iov[idx], cnt, offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) return -EIO; // image shorter than its geometry
+        offset += n;
+        while (n > 0) {
+            if ((size_t)n >= iov[idx].iov_len) {
+                n -= iov[idx].iov_len;
+                ++idx;
+            } else {
+                iov[idx].iov_base = (char*)iov[idx].iov_base + n;
+                iov[idx].iov_len -= n;
+                n = 0;
+            }
+        }
+    }
+    return 0;
+}
+
+// O_DIRECT with a caller buffer that is not aligned: stage the whole transfer in one
+// aligned buffer and copy in/out around it.
+int Disk::transfer_bounced(const std::vector<struct iovec>& iov, uint64_t first_block, size_t count, bool write) {
+    size_t total = count * BLOCK_SIZE;
+    AlignedPtr bounce = make_aligned(total);
+    size_t pos = 0;
+    if (write) {
+        for (const struct iovec& v : iov) {
+            std::memcpy(bounce.get() + pos, v.iov_base, v.iov_len);
+            pos += v.iov_len;
+        }
+    }
+    std::vector<struct iovec> staged{{bounce.get(), total}};
+    int err = transfer(staged, first_block, count, write);
+    if (err == 0 && !write) {
+        for (const struct iovec& v : iov) {
+            std::memcpy(v.iov_base, bounce.get() + pos, v.iov_len);
+            pos += v.iov_len;
+        }
+    }
+    return err;
+}
+
+int Disk::disk_pread(uint64_t block_num, char* buffer) {
+    return read_blocks(block_num, 1, buffer);
+}
+
+int Disk::disk_pwrite(uint64_t block_num, const char* buffer) {
+    return write_blocks(block_num, 1, buffer);
+}
+
+int Disk::read_blocks(uint64_t first_block, size_t count, char* buffer) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<struct iovec> iov{{buffer, count * BLOCK_SIZE}};
+    int err = transfer(iov, first_block, count, false);
+    stats_.read.record(count, err, start);
+    return err;
+}
+
+int Disk::write_blocks(uint64_t first_block, size_t count, const char* buffer) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<struct iovec> iov{{const_cast<char*>(buffer), count * BLOCK_SIZE}};
+    int err = transfer(iov, first_block, count, true);
+    stats_.write.record(count, err, start);
+    return err;
+}
+
+int Disk::readv_blocks(uint64_t first_block, char* const* buffers, size_t count) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<struct iovec> iov(count);
+    for (size_t i = 0; i < count; ++i) iov[i] = {buffers[i], (size_t)BLOCK_SIZE};
+    int err = transfer(iov, first_block, count, false);
+    stats_.read.record(count, err, start);
+    return err;
+}
+
+int Disk::writev_blocks(uint64_t first_block, const char* const* buffers, size_t count) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<struct iovec> iov(count);
+    for (size_t i = 0; i < count; ++i) iov[i] = {const_cast<char*>(buffers[i]), (size_t)BLOCK_SIZE};
+    int err = transfer(iov, first_block, count, true);
+    stats_.write.record(count, err, start);
+    return err;
+}
+
+static bool in_range(const IORequest& req, uint64_t num_blocks) {
+    return req.first_block <= num_blocks && req.count <= num_blocks - req.first_block;
+}
+
+int Disk::submit_batch(std::vector<IORequest>& reqs) {
+    for (const IORequest& req : reqs) {
+        if (!in_range(req, num_blocks_)) return -EINVAL;
+    }
+    if (map_) {
+        // Nothing to overlap: each request is a memcpy
+        int first_err = 0;
+        for (IORequest& req : reqs) {
+            req.result = req.write ? write_blocks(req.first_block, req.count, req.buffer)
+                                   : read_blocks(req.first_block, req.count, req.buffer);
+            if (req.result != 0 && first_err == 0) first_err = req.result;
+        }
+        return first_err;
+    }
+    if (!engine_) return -EBADF;
+    auto start = std::chrono::steady_clock::now();
+    auto record = [&] {
+        for (const IORequest& req : reqs) (req.write ? stats_.write : stats_.read).record(req.count, req.result, start);
+    };
+    if (!direct_) {
+        int err = engine_->run_batch(reqs);
+        record();
+        return err;
+    }
+
+    // Misaligned requests are issued on aligned bounce buffers
+    std::vector<IORequest> issued = reqs;
+    std::vector<AlignedPtr> bounce(reqs.size());
+    for (size_t i = 0; i < reqs.size(); ++i) {
+        size_t len = reqs[i].count * BLOCK_SIZE;
+        if (is_direct_aligned(reqs[i].buffer, len)) continue;
+        bounce[i] = make_aligned(len);
+        if (reqs[i].write) std::memcpy(bounce[i].get(), reqs[i].buffer, len);
+        issued[i].buffer = bounce[i].get();
+    }
+    int err = engine_->run_batch(issued);
+    for (size_t i = 0; i < reqs.size(); ++i) {
+        reqs[i].result = issued[i].result;
+        if (bounce[i] && !reqs[i].write && issued[i].result == 0) {
+            std::memcpy(reqs[i].buffer, bounce[i].get(), reqs[i].count * BLOCK_SIZE);
+        }
+    }
+    record();
+    return err;
+}
+
+void Disk::submit_async(const IORequest& req, IOEngine::Callback done) {
+    if (!in_range(req, num_blocks_)) return done(-EINVAL);
+    if (map_) {
+        return done(req.write ? write_blocks(req.first_block, req.count, req.buffer)
+                              : read_blocks(req.first_block, req.count, req.buffer));
+    }
+    if (!engine_) return done(-EBADF);
+    IOOpStats& op = req.write ? stats_.write : stats_.read;
+    done = [&op, count = req.count, start = std::chrono::steady_clock::now(), done = std::move(done)](int result) {
+        op.record(count, result, start);
+        done(result);
+    };
+    size_t len = req.count * BLOCK_SIZE;
+    if (!direct_ || is_direct_aligned(req.buffer, len)) return engine_->submit(req, std::move(done));
+
+    std::shared_ptr<char> bounce(make_aligned(len).release(), FreeDeleter());
+    if (req.write) std::memcpy(bounce.get(), req.buffer, len);
+    IORequest issued = req;
+    issued.buffer = bounce.get();
+    engine_->submit(issued, [req, bounce, len, done = std::move(done)](int result) {
+        if (result == 0 && !req.write) std::memcpy(req.buffer, bounce.get(), len);
+        done(result);
+    });
+}
+
+const char* Disk::block_ptr(uint64_t block_num) const {
+    if (!map_ || block_num >= num_blocks_) return nullptr;
+    return map_ + block_num * BLOCK_SIZE;
+}
+
+char* Disk::mutable_block_ptr(uint64_t block_num) {
+    if (!map_ || block_num >= num_blocks_) return nullptr;
+    return map_ + block_num * BLOCK_SIZE;
+}
+
+void Disk::disk_advise(uint64_t first_block, size_t count, DiskAccess access) {
+    if (!map_ || first_block >= num_blocks_) return;
+    count = std::min<uint64_t>(count, num_blocks_ - first_block);
+    int advice = MADV_NORMAL;
+    switch (access) {
+        case DiskAccess::Normal: advice = MADV_NORMAL; break;
+        case DiskAccess::Sequential: advice = MADV_SEQUENTIAL; break;
+        case DiskAccess::Random: advice = MADV_RANDOM; break;
+        case DiskAccess::WillNeed: advice = MADV_WILLNEED; break;
+    }
+    // BLOCK_SIZE is a multiple of the page size, so block boundaries are page aligned
+    madvise(map_ + first_block * BLOCK_SIZE, count * BLOCK_SIZE, advice);
 }
 
-bool Disk::disk_write(int block_num, const char* buffer) {
-    if (block_num < 0 || block_num >= NUM_BLOCKS) return false;
-    file_.seekg(block_num * BLOCK_SIZE);
-    file_.write(buffer, BLOCK_SIZE);
-    return file_.good();
+int Disk::disk_sync() {
+    if (fd_ < 0) return -EBADF;
+    auto start = std::chrono::steady_clock::now();
+    int err = 0;
+    if (map_) err = msync(map_, map_len_, MS_SYNC) == 0 ? 0 : -errno;
+    else err = fdatasync(fd_) == 0 ? 0 : -errno;
+    stats_.sync.record(0, err, start);
+    return err;
 }
@@ -1,17 +1,99 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
+#include <vector>
+#include <sys/uio.h>
+#include <memory>
 #include "stat.h"
-#include <fstream>
+#include "io_engine.h"
+#include "io_stats.h"
 
+// How the image file is accessed:
+//  Buffered - pread/pwrite through the kernel page cache
+//  Direct   - O_DIRECT, the SFS block cache is the only cache
+//  Mapped   - the whole image is mmap'd; I/O is memcpy and block_ptr() hands out pointers
+//             into the mapping, so callers can skip the copy altogether
+enum class DiskMode { Buffered, Direct, Mapped };
+
+struct DiskOptions {
+    IOEngineKind engine = IOEngineKind::Auto;
+    DiskMode mode = DiskMode::Buffered;
+    uint64_t create_blocks = DEFAULT_NUM_BLOCKS; // size of a newly created image
+    bool preallocate = false; // fallocate new images instead of leaving them sparse
+};
+
+// Access-pattern hints for a mapped image, passed on to madvise
+enum class DiskAccess { Normal, Sequential, Random, WillNeed };
+
+// Every transfer that reaches the image, whichever path it took (single, vectored, batched or
+// async). A batch counts one operation per request, each timed from when the batch was issued.
+struct DiskStats {
+    IOOpStats read;
+    IOOpStats write;
+    IOOpStats sync;
+};
+
+// Block device backed by an image file. All I/O is positional (pread/pwrite on one fd),
+// so any number of threads may read and write different blocks at the same time.
 class Disk {
 private:
-    std::fstream file_;
+    int fd_ = -1;
+    std::string path_;
+    std::unique_ptr<IOEngine> engine_;
+    bool direct_ = false;
+    uint64_t num_blocks_ = 0; // from the image file's size
+    DiskStats stats_;
+    char* map_ = nullptr; // whole image when mapped
+    size_t map_len_ = 0;
+
+    int transfer(std::vector<struct iovec>& iov, uint64_t first_block, size_t count, bool write);
+    int transfer_bounced(const std::vector<struct iovec>& iov, uint64_t first_block, size_t count, bool write);
 public:
-    bool disk_init(const std::string& path);
-    bool disk_read(int block_num, char* buffer);
-    bool disk_write(int block_num, const char* buffer);
+    Disk() = default;
+    Disk(const Disk&) = delete;
+    Disk& operator=(const Disk&) = delete;
+
+    // Opens images/<path>, creating it with options.create_blocks blocks if missing; an
+    // existing image keeps its size. Direct: buffers that are not 4 KB aligned still work but
+    // go through an aligned bounce buffer, and filesystems without O_DIRECT (e.g. tmpfs) fall
+    // back to Buffered with a warning. Mapped: a failed mmap falls back to Buffered the same way.
+    bool disk_init(const std::string& path, const DiskOptions& options = DiskOptions());
+    bool is_direct() const { return direct_; }
+    bool is_mapped() const { return map_ != nullptr; }
+
+    // Pointer to the block inside the mapping, or nullptr when not mapped / out of range.
+    // Consecutive blocks are contiguous, so a run can be read or written in place.
+    const char* block_ptr(uint64_t block_num) const;
+    char* mutable_block_ptr(uint64_t block_num);
+    void disk_advise(uint64_t first_block, size_t count, DiskAccess access);
+
+    // Return 0 on success or a negative errno: -EINVAL for a block outside the image,
+    // -EIO for a transfer that hit end of file, otherwise whatever pread/pwrite reported.
+    int disk_pread(uint64_t block_num, char* buffer);
+    int disk_pwrite(uint64_t block_num, const char* buffer);
+    int disk_sync(); // fdatasync, or msync for a mapped image
+
+    // Multi-block I/O in a single syscall. The *_blocks forms move `count` consecutive blocks
+    // starting at first_block to/from one contiguous buffer; the *v_blocks forms scatter/gather
+    // block first_block + i to/from buffers[i] with preadv/pwritev. Same return codes as above.
+    int read_blocks(uint64_t first_block, size_t count, char* buffer);
+    int write_blocks(uint64_t first_block, size_t count, const char* buffer);
+    int readv_blocks(uint64_t first_block, char* const* buffers, size_t count);
+    int writev_blocks(uint64_t first_block, const char* const* buffers, size_t count);
+
+    // Queue-depth > 1 I/O through the async engine (io_uring or a thread pool).
+    // submit_batch keeps every request in flight at once and returns when all are done,
+    // with each request's result filled in and the first error returned. submit_async is
+    // for background work such as readahead and writeback; `done` runs on an engine thread.
+    int submit_batch(std::vector<IORequest>& reqs);
+    void submit_async(const IORequest& req, IOEngine::Callback done);
+    const char* io_engine_name() const { return map_ ? "mmap" : engine_ ? engine_->name() : "none"; }
+
+    bool disk_read(uint64_t block_num, char* buffer) { return disk_pread(block_num, buffer) == 0; }
+    bool disk_write(uint64_t block_num, const char* buffer) { return disk_pwrite(block_num, buffer) == 0; }
     int disk_get_block_size() const { return BLOCK_SIZE; }
-    int disk_get_num_blocks() const { return NUM_BLOCKS; }
+    uint64_t disk_get_num_blocks() const { return num_blocks_; }
+    const DiskStats& stats() const { return stats_; }
     ~Disk();
 };
@@ -0,0 +1,171 @@
+#include "extent.h"
+#include "inode.h"
+#include "block_manager.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// A node copied out of the inode or its tree block, for modification
+struct ExtentNode {
+    uint32_t block = 0; // 0: the root, in the inode
+    uint16_t depth = 0;
+    std::vector<Extent> entries;
+};
+
+static int capacity(uint32_t block) { return block ? EXTENTS_PER_BLOCK : EXTENTS_INLINE; }
+
+static const ExtentHeader* header(const char* node) { return (const ExtentHeader*)node; }
+static const Extent* entries(const char* node) { return (const Extent*)(node + sizeof(ExtentHeader)); }
+
+static bool valid(const char* node, uint32_t block) {
+    return header(node)->entries <= capacity(block) && header(node)->depth <= EXTENT_MAX_DEPTH;
+}
+
+// Index of the last entry starting at or before file_block, -1 if there is none
+static int find_entry(const Extent* e, int n, uint32_t file_block) {
+    auto after = std::upper_bound(e, e + n, file_block,
+                                  [](uint32_t fb, const Extent& x) { return fb < x.logical; });
+    return (int)(after - e) - 1;
+}
+
+int extent_lookup(FSContext &ctx, const Inode &ino, uint32_t file_block, uint32_t &run) {
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    const char* node = (const char*)ino.extents;
+    if (!valid(node, 0)) return -1;
+    uint32_t next = UINT32_MAX; // first mapped file block past file_block seen on the way down
+    for (;;) {
+        const ExtentHeader* h = header(node);
+        const Extent* e = entries(node);
+        int i = find_entry(e, h->entries, file_block);
+        if (i + 1 < h->entries) next = std::min(next, e[i + 1].logical);
+        if (h->depth == 0 && i >= 0 && file_block - e[i].logical < e[i].len) {
+            run = e[i].len - (file_block - e[i].logical);
+            return (int)(e[i].start + (file_block - e[i].logical));
+        }
+        if (h->depth == 0 || i < 0) {
+            run = next - file_block;
+            return 0;
+        }
+        uint16_t depth = h->depth;
+        BlockRef child_ref;
+        const char* child = block_load(ctx, e[i].start, child_ref, scratch, BlockKind::Indirect);
+        if (!child || !valid(child, e[i].start) || header(child)->depth + 1 != depth) return -1;
+        node = child;
+        ref = std::move(child_ref);
+    }
+}
+
+static bool read_node(FSContext& ctx, const Inode& ino, uint32_t block, ExtentNode& out) {
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    const char* data = block ? block_load(ctx, block, ref, scratch, BlockKind::Indirect) : (const char*)ino.extents;
+    if (!data || !valid(data, block)) return false;
+    out.block = block;
+    out.depth = header(data)->depth;
+    out.entries.assign(entries(data), entries(data) + header(data)->entries);
+    return true;
+}
+
+static bool write_node(FSContext& ctx, Inode& ino, const ExtentNode& n) {
+    ExtentHeader h{(uint16_t)n.entries.size(), n.depth};
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    char* data = (char*)ino.extents;
+    if (n.block) {
+        data = block_load(ctx, n.block, ref, scratch, BlockKind::Indirect, /*zero_fill=*/true);
+        if (!data) return false;
+    } else {
+        std::memset(data, 0, EXTENT_ROOT_BYTES);
+    }
+    std::memcpy(data, &h, sizeof(h));
+    std::memcpy(data + sizeof(h), n.entries.data(), n.entries.size() * sizeof(Extent));
+    return n.block == 0 || block_store(ctx, n.block, ref, data);
+}
+
+// Writes back the path after an entry went into its leaf. Nodes that overflowed are split from
+// the bottom up, each parent's entry keeps its child's first block, and a root that overflows
+// moves into a new block one level down.
+static bool settle(FSContext& ctx, Inode& ino, std::vector<ExtentNode>& path, const std::vector<int>& slot) {
+    for (size_t level = path.size() - 1; level > 0; --level) {
+        ExtentNode& n = path[level];
+        ExtentNode& parent = path[level - 1];
+        int at = slot[level - 1];
+        if ((int)n.entries.size() > capacity(n.block)) {
+            int sibling = block_alloc(ctx);
+            if (sibling < 0) return false;
+            ExtentNode right{(uint32_t)sibling, n.depth, {}};
+            size_t half = n.entries.size() / 2;
+            right.entries.assign(n.entries.begin() + half, n.entries.end());
+            n.entries.resize(half);
+            if (!write_node(ctx, ino, right)) return false;
+            parent.entries.insert(parent.entries.begin() + at + 1, Extent{right.entries[0].logical, right.block, 0});
+        }
+        parent.entries[at].logical = n.entries[0].logical;
+        if (!write_node(ctx, ino, n)) return false;
+    }
+    ExtentNode& root = path[0];
+    if ((int)root.entries.size() > EXTENTS_INLINE) {
+        if (root.depth == EXTENT_MAX_DEPTH) return false;
+        int child = block_alloc(ctx);
+        if (child < 0) return false;
+        ExtentNode moved{(uint32_t)child, root.depth, std::move(root.entries)};
+        if (!write_node(ctx, ino, moved)) return false;
+        root.entries = {Extent{moved.entries[0].logical, moved.block, 0}};
+        ++root.depth;
+    }
+    return write_node(ctx, ino, root);
+}
+
+bool extent_insert(FSContext &ctx, Inode &ino, const Extent &e) {
+    // Path from the root to the leaf whose range takes e, and the entry followed at each level
+    std::vector<ExtentNode> path(1);
+    std::vector<int> slot;
+    if (!read_node(ctx, ino, 0, path[0])) return false;
+    while (path.back().depth > 0) {
+        const ExtentNode& n = path.back();
+        if (n.entries.empty()) return false;
+        int i = std::max(0, find_entry(n.entries.data(), (int)n.entries.size(), e.logical));
+        slot.push_back(i);
+        ExtentNode child;
+        if (!read_node(ctx, ino, n.entries[i].start, child) || child.depth + 1 != n.depth) return false;
+        path.push_back(std::move(child));
+    }
+    ExtentNode& leaf = path.back();
+    int i = find_entry(leaf.entries.data(), (int)leaf.entries.size(), e.logical);
+    if (i >= 0) {
+        Extent& prev = leaf.entries[i];
+        if (prev.logical + prev.len == e.logical && prev.start + prev.len == e.start) {
+            prev.len += e.len;
+            return write_node(ctx, ino, leaf);
+        }
+    }
+    leaf.entries.insert(leaf.entries.begin() + (i + 1), e);
+    return settle(ctx, ino, path, slot);
+}
+
+static bool walk(FSContext& ctx, const char* node, uint32_t block, int depth,
+                 const std::function<bool(const Extent&)>& data,
+                 const std::function<void(uint32_t)>& tree, bool& more) {
+    if (!valid(node, block) || header(node)->depth != depth) return false;
+    const Extent* e = entries(node);
+    for (int i = 0; i < header(node)->entries && more; ++i) {
+        if (depth == 0) {
+            more = data(e[i]);
+            continue;
+        }
+        if (tree) tree(e[i].start);
+        char scratch[BLOCK_SIZE];
+        BlockRef ref;
+        const char* child = block_load(ctx, e[i].start, ref, scratch, BlockKind::Indirect);
+        if (!child || !walk(ctx, child, e[i].start, depth - 1, data, tree, more)) return false;
+    }
+    return true;
+}
+
+bool extent_walk(FSContext &ctx, const Inode &ino, const std::function<bool(const Extent&)> &data,
+                 const std::function<void(uint32_t)> &tree) {
+    const char* root = (const char*)ino.extents;
+    bool more = true;
+    return walk(ctx, root, 0, header(root)->depth, data, tree, more);
+}
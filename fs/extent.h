@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include "stat.h"
+
+struct FSContext;
+struct Inode;
+
+// Extent-mapped inodes (INODE_EXTENTS in the mode): file blocks [logical, logical + len) are
+// stored in blocks [start, start + len). Extents live in a B-tree ordered by logical block whose
+// root is the inode's block-pointer area. Interior nodes hold the same entries with `start`
+// naming a child tree block and `logical` the first file block under it. An all-zero root is
+// an empty tree, so a zeroed inode is a valid file with no blocks.
+struct Extent {
+    uint32_t logical;
+    uint32_t start;
+    uint32_t len;
+};
+
+struct ExtentHeader {
+    uint16_t entries;
+    uint16_t depth; // 0: the entries are extents; n: they point at nodes of depth n - 1
+};
+
+constexpr int EXTENT_ROOT_BYTES = sizeof(uint32_t) * (NDIRECT + 1);
+constexpr int EXTENTS_INLINE = (EXTENT_ROOT_BYTES - sizeof(ExtentHeader)) / sizeof(Extent);
+constexpr int EXTENTS_PER_BLOCK = (BLOCK_SIZE - sizeof(ExtentHeader)) / sizeof(Extent);
+constexpr int EXTENT_MAX_DEPTH = 4; // far past what MAX_EXTENT_FILE_BLOCKS can need
+
+// Data block holding file block `file_block`: 0 for a hole, -1 if the tree cannot be read.
+// `run` gets how many blocks from there on stay contiguous on disk (for a hole, how many
+// stay unmapped), so a reader needs one lookup per extent rather than per block.
+int extent_lookup(FSContext &ctx, const Inode &ino, uint32_t file_block, uint32_t &run);
+
+// Maps the unmapped file blocks [e.logical, e.logical + e.len) to [e.start, ...). Blocks that
+// continue the extent before them, in the file and on disk, just lengthen it. Full nodes are
+// split, and a full root moves into a new block with the tree growing a level. Changes to the
+// root are left in `ino` for the caller to write.
+bool extent_insert(FSContext &ctx, Inode &ino, const Extent &e);
+
+// Calls data(e) for every extent in file order until it returns false, and tree(block) for
+// every tree block. False if a tree block cannot be read.
+bool extent_walk(FSContext &ctx, const Inode &ino, const std::function<bool(const Extent&)> &data,
+                 const std::function<void(uint32_t)> &tree = nullptr);
@@ -31,6 +31,9 @@ static const char* FileSystem_method_names[] = {
   "/fs.FileSystem/Seek",
   "/fs.FileSystem/Listdir",
   "/fs.FileSystem/Remove",
+  "/fs.FileSystem/GetMountStats",
+  "/fs.FileSystem/Close",
+  "/fs.FileSystem/Fsync",
 };
 
 std::unique_ptr< FileSystem::Stub> FileSystem::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -49,6 +52,9 @@ FileSystem::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel
   , rpcmethod_Seek_(FileSystem_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Listdir_(FileSystem_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Remove_(FileSystem_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetMountStats_(FileSystem_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Close_(FileSystem_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Fsync_(FileSystem_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status FileSystem::Stub::Mount(::grpc::ClientContext* context, const ::fs::MountRequest& request, ::fs::MountResponse* response) {
@@ -258,6 +264,75 @@ void FileSystem::Stub::async::Remove(::grpc::ClientContext* context, const ::fs:
   return result;
 }
 
+::grpc::Status FileSystem::Stub::GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::fs::MountStatsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::fs::MountStatsRequest, ::fs::MountStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetMountStats_, context, request, response);
+}
+
+void FileSystem::Stub::async::GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::fs::MountStatsRequest, ::fs::MountStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMountStats_, context, request, response, std::move(f));
+}
+
+void FileSystem::Stub::async::GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMountStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>* FileSystem::Stub::PrepareAsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::fs::MountStatsResponse, ::fs::MountStatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetMountStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>* FileSystem::Stub::AsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetMountStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FileSystem::Stub::Close(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::CloseResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::fs::FdRequest, ::fs::CloseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Close_, context, request, response);
+}
+
+void FileSystem::Stub::async::Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::fs::FdRequest, ::fs::CloseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Close_, context, request, response, std::move(f));
+}
+
+void FileSystem::Stub::async::Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Close_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>* FileSystem::Stub::PrepareAsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::fs::CloseResponse, ::fs::FdRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Close_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>* FileSystem::Stub::AsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncCloseRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FileSystem::Stub::Fsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::FsyncResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::fs::FdRequest, ::fs::FsyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Fsync_, context, request, response);
+}
+
+void FileSystem::Stub::async::Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::fs::FdRequest, ::fs::FsyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Fsync_, context, request, response, std::move(f));
+}
+
+void FileSystem::Stub::async::Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Fsync_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>* FileSystem::Stub::PrepareAsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::fs::FsyncResponse, ::fs::FdRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Fsync_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>* FileSystem::Stub::AsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncFsyncRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 FileSystem::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FileSystem_method_names[0],
@@ -349,6 +424,36 @@ FileSystem::Service::Service() {
              ::fs::RemoveResponse* resp) {
                return service->Remove(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileSystem_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileSystem::Service, ::fs::MountStatsRequest, ::fs::MountStatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileSystem::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::MountStatsRequest* req,
+             ::fs::MountStatsResponse* resp) {
+               return service->GetMountStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileSystem_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileSystem::Service, ::fs::FdRequest, ::fs::CloseResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileSystem::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::FdRequest* req,
+             ::fs::CloseResponse* resp) {
+               return service->Close(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileSystem_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileSystem::Service, ::fs::FdRequest, ::fs::FsyncResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileSystem::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::FdRequest* req,
+             ::fs::FsyncResponse* resp) {
+               return service->Fsync(ctx, req, resp);
+             }, this)));
 }
 
 FileSystem::Service::~Service() {
@@ -417,6 +522,27 @@ FileSystem::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status FileSystem::Service::GetMountStats(::grpc::ServerContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileSystem::Service::Close(::grpc::ServerContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileSystem::Service::Fsync(::grpc::ServerContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace fs
 
@@ -98,6 +98,27 @@ class FileSystem final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::RemoveResponse>> PrepareAsyncRemove(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::RemoveResponse>>(PrepareAsyncRemoveRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::fs::MountStatsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>> AsyncGetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>>(AsyncGetMountStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>> PrepareAsyncGetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>>(PrepareAsyncGetMountStatsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status Close(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::CloseResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>> AsyncClose(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>>(AsyncCloseRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>> PrepareAsyncClose(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>>(PrepareAsyncCloseRaw(context, request, cq));
+    }
+    virtual ::grpc::Status Fsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::FsyncResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>> AsyncFsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>>(AsyncFsyncRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>> PrepareAsyncFsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>>(PrepareAsyncFsyncRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -119,6 +140,12 @@ class FileSystem final {
       virtual void Listdir(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::ListdirResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void Remove(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::RemoveResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void Remove(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::RemoveResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -142,6 +169,12 @@ class FileSystem final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::ListdirResponse>* PrepareAsyncListdirRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::RemoveResponse>* AsyncRemoveRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::RemoveResponse>* PrepareAsyncRemoveRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>* AsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::MountStatsResponse>* PrepareAsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>* AsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::CloseResponse>* PrepareAsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>* AsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::FsyncResponse>* PrepareAsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -209,6 +242,27 @@ class FileSystem final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::RemoveResponse>> PrepareAsyncRemove(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::RemoveResponse>>(PrepareAsyncRemoveRaw(context, request, cq));
     }
+    ::grpc::Status GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::fs::MountStatsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>> AsyncGetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>>(AsyncGetMountStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>> PrepareAsyncGetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>>(PrepareAsyncGetMountStatsRaw(context, request, cq));
+    }
+    ::grpc::Status Close(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::CloseResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>> AsyncClose(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>>(AsyncCloseRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>> PrepareAsyncClose(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>>(PrepareAsyncCloseRaw(context, request, cq));
+    }
+    ::grpc::Status Fsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::fs::FsyncResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>> AsyncFsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>>(AsyncFsyncRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>> PrepareAsyncFsync(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>>(PrepareAsyncFsyncRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -230,6 +284,12 @@ class FileSystem final {
       void Listdir(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::ListdirResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void Remove(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::RemoveResponse* response, std::function<void(::grpc::Status)>) override;
       void Remove(::grpc::ClientContext* context, const ::fs::FileRequest* request, ::fs::RemoveResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetMountStats(::grpc::ClientContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, std::function<void(::grpc::Status)>) override;
+      void Close(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, std::function<void(::grpc::Status)>) override;
+      void Fsync(::grpc::ClientContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -259,6 +319,12 @@ class FileSystem final {
     ::grpc::ClientAsyncResponseReader< ::fs::ListdirResponse>* PrepareAsyncListdirRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fs::RemoveResponse>* AsyncRemoveRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fs::RemoveResponse>* PrepareAsyncRemoveRaw(::grpc::ClientContext* context, const ::fs::FileRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>* AsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::MountStatsResponse>* PrepareAsyncGetMountStatsRaw(::grpc::ClientContext* context, const ::fs::MountStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>* AsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::CloseResponse>* PrepareAsyncCloseRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>* AsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::fs::FsyncResponse>* PrepareAsyncFsyncRaw(::grpc::ClientContext* context, const ::fs::FdRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Mount_;
     const ::grpc::internal::RpcMethod rpcmethod_Create_;
     const ::grpc::internal::RpcMethod rpcmethod_Mkdir_;
@@ -268,6 +334,9 @@ class FileSystem final {
     const ::grpc::internal::RpcMethod rpcmethod_Seek_;
     const ::grpc::internal::RpcMethod rpcmethod_Listdir_;
     const ::grpc::internal::RpcMethod rpcmethod_Remove_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMountStats_;
+    const ::grpc::internal::RpcMethod rpcmethod_Close_;
+    const ::grpc::internal::RpcMethod rpcmethod_Fsync_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -284,6 +353,9 @@ class FileSystem final {
     virtual ::grpc::Status Seek(::grpc::ServerContext* context, const ::fs::SeekRequestMulti* request, ::fs::SeekResponse* response);
     virtual ::grpc::Status Listdir(::grpc::ServerContext* context, const ::fs::FileRequest* request, ::fs::ListdirResponse* response);
     virtual ::grpc::Status Remove(::grpc::ServerContext* context, const ::fs::FileRequest* request, ::fs::RemoveResponse* response);
+    virtual ::grpc::Status GetMountStats(::grpc::ServerContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response);
+    virtual ::grpc::Status Close(::grpc::ServerContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response);
+    virtual ::grpc::Status Fsync(::grpc::ServerContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Mount : public BaseClass {
@@ -465,7 +537,67 @@ class FileSystem final {
       ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Mount<WithAsyncMethod_Create<WithAsyncMethod_Mkdir<WithAsyncMethod_Open<WithAsyncMethod_Read<WithAsyncMethod_Write<WithAsyncMethod_Seek<WithAsyncMethod_Listdir<WithAsyncMethod_Remove<Service > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMountStats(::grpc::ServerContext* context, ::fs::MountStatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::fs::MountStatsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Close() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestClose(::grpc::ServerContext* context, ::fs::FdRequest* request, ::grpc::ServerAsyncResponseWriter< ::fs::CloseResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Fsync() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFsync(::grpc::ServerContext* context, ::fs::FdRequest* request, ::grpc::ServerAsyncResponseWriter< ::fs::FsyncResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Mount<WithAsyncMethod_Create<WithAsyncMethod_Mkdir<WithAsyncMethod_Open<WithAsyncMethod_Read<WithAsyncMethod_Write<WithAsyncMethod_Seek<WithAsyncMethod_Listdir<WithAsyncMethod_Remove<WithAsyncMethod_GetMountStats<WithAsyncMethod_Close<WithAsyncMethod_Fsync<Service > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Mount : public BaseClass {
    private:
@@ -709,7 +841,88 @@ class FileSystem final {
     virtual ::grpc::ServerUnaryReactor* Remove(
       ::grpc::CallbackServerContext* /*context*/, const ::fs::FileRequest* /*request*/, ::fs::RemoveResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Mount<WithCallbackMethod_Create<WithCallbackMethod_Mkdir<WithCallbackMethod_Open<WithCallbackMethod_Read<WithCallbackMethod_Write<WithCallbackMethod_Seek<WithCallbackMethod_Listdir<WithCallbackMethod_Remove<Service > > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::fs::MountStatsRequest, ::fs::MountStatsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::MountStatsRequest* request, ::fs::MountStatsResponse* response) { return this->GetMountStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMountStats(
+        ::grpc::MessageAllocator< ::fs::MountStatsRequest, ::fs::MountStatsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::fs::MountStatsRequest, ::fs::MountStatsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMountStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Close() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::fs::FdRequest, ::fs::CloseResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::FdRequest* request, ::fs::CloseResponse* response) { return this->Close(context, request, response); }));}
+    void SetMessageAllocatorFor_Close(
+        ::grpc::MessageAllocator< ::fs::FdRequest, ::fs::CloseResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::fs::FdRequest, ::fs::CloseResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Close(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Fsync() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::fs::FdRequest, ::fs::FsyncResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::FdRequest* request, ::fs::FsyncResponse* response) { return this->Fsync(context, request, response); }));}
+    void SetMessageAllocatorFor_Fsync(
+        ::grpc::MessageAllocator< ::fs::FdRequest, ::fs::FsyncResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::fs::FdRequest, ::fs::FsyncResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Fsync(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Mount<WithCallbackMethod_Create<WithCallbackMethod_Mkdir<WithCallbackMethod_Open<WithCallbackMethod_Read<WithCallbackMethod_Write<WithCallbackMethod_Seek<WithCallbackMethod_Listdir<WithCallbackMethod_Remove<WithCallbackMethod_GetMountStats<WithCallbackMethod_Close<WithCallbackMethod_Fsync<Service > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Mount : public BaseClass {
@@ -865,6 +1078,57 @@ class FileSystem final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Close() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Fsync() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Mount : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1045,6 +1309,66 @@ class FileSystem final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMountStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Close() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestClose(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Fsync() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFsync(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Mount : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1243,6 +1567,72 @@ class FileSystem final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMountStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMountStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Close() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Close(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Close(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Fsync() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Fsync(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Fsync(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Mount : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1485,9 +1875,90 @@ class FileSystem final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedRemove(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fs::FileRequest,::fs::RemoveResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Mount<WithStreamedUnaryMethod_Create<WithStreamedUnaryMethod_Mkdir<WithStreamedUnaryMethod_Open<WithStreamedUnaryMethod_Read<WithStreamedUnaryMethod_Write<WithStreamedUnaryMethod_Seek<WithStreamedUnaryMethod_Listdir<WithStreamedUnaryMethod_Remove<Service > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMountStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMountStats() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::fs::MountStatsRequest, ::fs::MountStatsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::fs::MountStatsRequest, ::fs::MountStatsResponse>* streamer) {
+                       return this->StreamedGetMountStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMountStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMountStats(::grpc::ServerContext* /*context*/, const ::fs::MountStatsRequest* /*request*/, ::fs::MountStatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMountStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fs::MountStatsRequest,::fs::MountStatsResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Close : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Close() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::fs::FdRequest, ::fs::CloseResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::fs::FdRequest, ::fs::CloseResponse>* streamer) {
+                       return this->StreamedClose(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Close() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Close(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::CloseResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedClose(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fs::FdRequest,::fs::CloseResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Fsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Fsync() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::fs::FdRequest, ::fs::FsyncResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::fs::FdRequest, ::fs::FsyncResponse>* streamer) {
+                       return this->StreamedFsync(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Fsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Fsync(::grpc::ServerContext* /*context*/, const ::fs::FdRequest* /*request*/, ::fs::FsyncResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedFsync(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fs::FdRequest,::fs::FsyncResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Mount<WithStreamedUnaryMethod_Create<WithStreamedUnaryMethod_Mkdir<WithStreamedUnaryMethod_Open<WithStreamedUnaryMethod_Read<WithStreamedUnaryMethod_Write<WithStreamedUnaryMethod_Seek<WithStreamedUnaryMethod_Listdir<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_GetMountStats<WithStreamedUnaryMethod_Close<WithStreamedUnaryMethod_Fsync<Service > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Mount<WithStreamedUnaryMethod_Create<WithStreamedUnaryMethod_Mkdir<WithStreamedUnaryMethod_Open<WithStreamedUnaryMethod_Read<WithStreamedUnaryMethod_Write<WithStreamedUnaryMethod_Seek<WithStreamedUnaryMethod_Listdir<WithStreamedUnaryMethod_Remove<Service > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_Mount<WithStreamedUnaryMethod_Create<WithStreamedUnaryMethod_Mkdir<WithStreamedUnaryMethod_Open<WithStreamedUnaryMethod_Read<WithStreamedUnaryMethod_Write<WithStreamedUnaryMethod_Seek<WithStreamedUnaryMethod_Listdir<WithStreamedUnaryMethod_Remove<WithStreamedUnaryMethod_GetMountStats<WithStreamedUnaryMethod_Close<WithStreamedUnaryMethod_Fsync<Service > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace fs
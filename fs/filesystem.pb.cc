@@ -24,8 +24,16 @@ namespace fs {
 PROTOBUF_CONSTEXPR MountRequest::MountRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.disk_image_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.enable_cache_)*/false
+  , /*decltype(_impl_.io_engine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.cache_blocks_)*/0
+  , /*decltype(_impl_.enable_cache_)*/false
+  , /*decltype(_impl_.direct_io_)*/false
+  , /*decltype(_impl_.mmap_io_)*/false
+  , /*decltype(_impl_.preallocate_)*/false
+  , /*decltype(_impl_.num_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_inodes_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_reserved_blocks_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct MountRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR MountRequestDefaultTypeInternal()
@@ -222,8 +230,152 @@ struct RemoveResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemoveResponseDefaultTypeInternal _RemoveResponse_default_instance_;
+PROTOBUF_CONSTEXPR FdRequest::FdRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mount_id_)*/0
+  , /*decltype(_impl_.fd_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FdRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FdRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FdRequestDefaultTypeInternal() {}
+  union {
+    FdRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FdRequestDefaultTypeInternal _FdRequest_default_instance_;
+PROTOBUF_CONSTEXPR CloseResponse::CloseResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CloseResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CloseResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CloseResponseDefaultTypeInternal() {}
+  union {
+    CloseResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CloseResponseDefaultTypeInternal _CloseResponse_default_instance_;
+PROTOBUF_CONSTEXPR FsyncResponse::FsyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FsyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FsyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FsyncResponseDefaultTypeInternal() {}
+  union {
+    FsyncResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FsyncResponseDefaultTypeInternal _FsyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR MountStatsRequest::MountStatsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mount_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MountStatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MountStatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MountStatsRequestDefaultTypeInternal() {}
+  union {
+    MountStatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MountStatsRequestDefaultTypeInternal _MountStatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR BlockClassStats::BlockClassStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_class_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.misses_)*/uint64_t{0u}
+  , /*decltype(_impl_.evictions_)*/uint64_t{0u}
+  , /*decltype(_impl_.writebacks_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockClassStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockClassStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockClassStatsDefaultTypeInternal() {}
+  union {
+    BlockClassStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockClassStatsDefaultTypeInternal _BlockClassStats_default_instance_;
+PROTOBUF_CONSTEXPR LatencyStats::LatencyStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.errors_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_us_)*/0
+  , /*decltype(_impl_.p50_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyStatsDefaultTypeInternal() {}
+  union {
+    LatencyStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyStatsDefaultTypeInternal _LatencyStats_default_instance_;
+PROTOBUF_CONSTEXPR HitRatePoint::HitRatePoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cache_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.hit_rate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HitRatePointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HitRatePointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HitRatePointDefaultTypeInternal() {}
+  union {
+    HitRatePoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HitRatePointDefaultTypeInternal _HitRatePoint_default_instance_;
+PROTOBUF_CONSTEXPR MountStatsResponse::MountStatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_classes_)*/{}
+  , /*decltype(_impl_.hit_rate_curve_)*/{}
+  , /*decltype(_impl_.disk_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.io_engine_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cache_miss_)*/nullptr
+  , /*decltype(_impl_.cache_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.cached_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.metadata_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.dirty_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.prefetched_)*/uint64_t{0u}
+  , /*decltype(_impl_.prefetch_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_quota_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_reserved_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_total_blocks_)*/uint64_t{0u}
+  , /*decltype(_impl_.icache_inodes_)*/uint64_t{0u}
+  , /*decltype(_impl_.icache_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.icache_misses_)*/uint64_t{0u}
+  , /*decltype(_impl_.icache_writebacks_)*/uint64_t{0u}
+  , /*decltype(_impl_.dentries_)*/uint64_t{0u}
+  , /*decltype(_impl_.dentry_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.dentry_misses_)*/uint64_t{0u}
+  , /*decltype(_impl_.path_hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.cache_enabled_)*/false
+  , /*decltype(_impl_.cache_shared_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MountStatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MountStatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MountStatsResponseDefaultTypeInternal() {}
+  union {
+    MountStatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MountStatsResponseDefaultTypeInternal _MountStatsResponse_default_instance_;
 }  // namespace fs
-static ::_pb::Metadata file_level_metadata_filesystem_2eproto[14];
+static ::_pb::Metadata file_level_metadata_filesystem_2eproto[22];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_filesystem_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_filesystem_2eproto = nullptr;
 
@@ -237,6 +389,14 @@ const uint32_t TableStruct_filesystem_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.disk_image_),
   PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.enable_cache_),
   PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.cache_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.io_engine_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.direct_io_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.mmap_io_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.num_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.num_inodes_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.preallocate_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.cache_policy_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountRequest, _impl_.cache_reserved_blocks_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::fs::MountResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -345,22 +505,126 @@ const uint32_t TableStruct_filesystem_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::fs::RemoveResponse, _impl_.success_),
   PROTOBUF_FIELD_OFFSET(::fs::RemoveResponse, _impl_.error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::FdRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::FdRequest, _impl_.mount_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::FdRequest, _impl_.fd_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CloseResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CloseResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::fs::CloseResponse, _impl_.error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::FsyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::FsyncResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::fs::FsyncResponse, _impl_.error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsRequest, _impl_.mount_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _impl_.block_class_),
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _impl_.hits_),
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _impl_.misses_),
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _impl_.evictions_),
+  PROTOBUF_FIELD_OFFSET(::fs::BlockClassStats, _impl_.writebacks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.errors_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.mean_us_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.p50_us_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.p99_us_),
+  PROTOBUF_FIELD_OFFSET(::fs::LatencyStats, _impl_.max_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::HitRatePoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::HitRatePoint, _impl_.cache_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::HitRatePoint, _impl_.hit_rate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_enabled_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_policy_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_capacity_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cached_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.metadata_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.dirty_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.block_classes_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.prefetched_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.prefetch_hits_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_miss_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.hit_rate_curve_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.disk_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.io_engine_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_shared_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_quota_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_reserved_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.cache_total_blocks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.icache_inodes_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.icache_hits_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.icache_misses_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.icache_writebacks_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.dentries_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.dentry_hits_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.dentry_misses_),
+  PROTOBUF_FIELD_OFFSET(::fs::MountStatsResponse, _impl_.path_hits_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::fs::MountRequest)},
-  { 9, -1, -1, sizeof(::fs::MountResponse)},
-  { 17, -1, -1, sizeof(::fs::FileRequest)},
-  { 25, -1, -1, sizeof(::fs::CreateResponse)},
-  { 33, -1, -1, sizeof(::fs::MkdirResponse)},
-  { 41, -1, -1, sizeof(::fs::OpenResponse)},
-  { 49, -1, -1, sizeof(::fs::ReadRequestMulti)},
-  { 58, -1, -1, sizeof(::fs::ReadResponse)},
-  { 66, -1, -1, sizeof(::fs::WriteRequestMulti)},
-  { 75, -1, -1, sizeof(::fs::WriteResponse)},
-  { 83, -1, -1, sizeof(::fs::SeekRequestMulti)},
-  { 93, -1, -1, sizeof(::fs::SeekResponse)},
-  { 101, -1, -1, sizeof(::fs::ListdirResponse)},
-  { 109, -1, -1, sizeof(::fs::RemoveResponse)},
+  { 17, -1, -1, sizeof(::fs::MountResponse)},
+  { 25, -1, -1, sizeof(::fs::FileRequest)},
+  { 33, -1, -1, sizeof(::fs::CreateResponse)},
+  { 41, -1, -1, sizeof(::fs::MkdirResponse)},
+  { 49, -1, -1, sizeof(::fs::OpenResponse)},
+  { 57, -1, -1, sizeof(::fs::ReadRequestMulti)},
+  { 66, -1, -1, sizeof(::fs::ReadResponse)},
+  { 74, -1, -1, sizeof(::fs::WriteRequestMulti)},
+  { 83, -1, -1, sizeof(::fs::WriteResponse)},
+  { 91, -1, -1, sizeof(::fs::SeekRequestMulti)},
+  { 101, -1, -1, sizeof(::fs::SeekResponse)},
+  { 109, -1, -1, sizeof(::fs::ListdirResponse)},
+  { 117, -1, -1, sizeof(::fs::RemoveResponse)},
+  { 125, -1, -1, sizeof(::fs::FdRequest)},
+  { 133, -1, -1, sizeof(::fs::CloseResponse)},
+  { 141, -1, -1, sizeof(::fs::FsyncResponse)},
+  { 149, -1, -1, sizeof(::fs::MountStatsRequest)},
+  { 156, -1, -1, sizeof(::fs::BlockClassStats)},
+  { 167, -1, -1, sizeof(::fs::LatencyStats)},
+  { 181, -1, -1, sizeof(::fs::HitRatePoint)},
+  { 189, -1, -1, sizeof(::fs::MountStatsResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -378,47 +642,92 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::fs::_SeekResponse_default_instance_._instance,
   &::fs::_ListdirResponse_default_instance_._instance,
   &::fs::_RemoveResponse_default_instance_._instance,
+  &::fs::_FdRequest_default_instance_._instance,
+  &::fs::_CloseResponse_default_instance_._instance,
+  &::fs::_FsyncResponse_default_instance_._instance,
+  &::fs::_MountStatsRequest_default_instance_._instance,
+  &::fs::_BlockClassStats_default_instance_._instance,
+  &::fs::_LatencyStats_default_instance_._instance,
+  &::fs::_HitRatePoint_default_instance_._instance,
+  &::fs::_MountStatsResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_filesystem_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\020filesystem.proto\022\002fs\"N\n\014MountRequest\022\022"
-  "\n\ndisk_image\030\001 \001(\t\022\024\n\014enable_cache\030\002 \001(\010"
-  "\022\024\n\014cache_blocks\030\003 \001(\005\"0\n\rMountResponse\022"
-  "\020\n\010mount_id\030\001 \001(\005\022\r\n\005error\030\002 \001(\t\"-\n\013File"
-  "Request\022\020\n\010mount_id\030\001 \001(\005\022\014\n\004path\030\002 \001(\t\""
-  "-\n\016CreateResponse\022\014\n\004inum\030\001 \001(\005\022\r\n\005error"
-  "\030\002 \001(\t\",\n\rMkdirResponse\022\014\n\004inum\030\001 \001(\005\022\r\n"
-  "\005error\030\002 \001(\t\")\n\014OpenResponse\022\n\n\002fd\030\001 \001(\005"
-  "\022\r\n\005error\030\002 \001(\t\"C\n\020ReadRequestMulti\022\020\n\010m"
-  "ount_id\030\001 \001(\005\022\n\n\002fd\030\002 \001(\005\022\021\n\tnum_bytes\030\003"
-  " \001(\005\"+\n\014ReadResponse\022\014\n\004data\030\001 \001(\014\022\r\n\005er"
-  "ror\030\002 \001(\t\"\?\n\021WriteRequestMulti\022\020\n\010mount_"
-  "id\030\001 \001(\005\022\n\n\002fd\030\002 \001(\005\022\014\n\004data\030\003 \001(\014\"/\n\rWr"
-  "iteResponse\022\017\n\007success\030\001 \001(\010\022\r\n\005error\030\002 "
-  "\001(\t\"P\n\020SeekRequestMulti\022\020\n\010mount_id\030\001 \001("
-  "\005\022\n\n\002fd\030\002 \001(\005\022\016\n\006offset\030\003 \001(\005\022\016\n\006whence\030"
-  "\004 \001(\005\".\n\014SeekResponse\022\017\n\007success\030\001 \001(\010\022\r"
-  "\n\005error\030\002 \001(\t\"1\n\017ListdirResponse\022\017\n\007entr"
-  "ies\030\001 \003(\t\022\r\n\005error\030\002 \001(\t\"0\n\016RemoveRespon"
-  "se\022\017\n\007success\030\001 \001(\010\022\r\n\005error\030\002 \001(\t2\264\003\n\nF"
-  "ileSystem\022,\n\005Mount\022\020.fs.MountRequest\032\021.f"
-  "s.MountResponse\022-\n\006Create\022\017.fs.FileReque"
-  "st\032\022.fs.CreateResponse\022+\n\005Mkdir\022\017.fs.Fil"
-  "eRequest\032\021.fs.MkdirResponse\022)\n\004Open\022\017.fs"
-  ".FileRequest\032\020.fs.OpenResponse\022.\n\004Read\022\024"
-  ".fs.ReadRequestMulti\032\020.fs.ReadResponse\0221"
-  "\n\005Write\022\025.fs.WriteRequestMulti\032\021.fs.Writ"
-  "eResponse\022.\n\004Seek\022\024.fs.SeekRequestMulti\032"
-  "\020.fs.SeekResponse\022/\n\007Listdir\022\017.fs.FileRe"
-  "quest\032\023.fs.ListdirResponse\022-\n\006Remove\022\017.f"
-  "s.FileRequest\032\022.fs.RemoveResponseb\006proto"
-  "3"
+  "\n\020filesystem.proto\022\002fs\"\367\001\n\014MountRequest\022"
+  "\022\n\ndisk_image\030\001 \001(\t\022\024\n\014enable_cache\030\002 \001("
+  "\010\022\024\n\014cache_blocks\030\003 \001(\005\022\021\n\tio_engine\030\004 \001"
+  "(\t\022\021\n\tdirect_io\030\005 \001(\010\022\017\n\007mmap_io\030\006 \001(\010\022\022"
+  "\n\nnum_blocks\030\007 \001(\004\022\022\n\nnum_inodes\030\010 \001(\004\022\023"
+  "\n\013preallocate\030\t \001(\010\022\024\n\014cache_policy\030\n \001("
+  "\t\022\035\n\025cache_reserved_blocks\030\013 \001(\004\"0\n\rMoun"
+  "tResponse\022\020\n\010mount_id\030\001 \001(\005\022\r\n\005error\030\002 \001"
+  "(\t\"-\n\013FileRequest\022\020\n\010mount_id\030\001 \001(\005\022\014\n\004p"
+  "ath\030\002 \001(\t\"-\n\016CreateResponse\022\014\n\004inum\030\001 \001("
+  "\005\022\r\n\005error\030\002 \001(\t\",\n\rMkdirResponse\022\014\n\004inu"
+  "m\030\001 \001(\005\022\r\n\005error\030\002 \001(\t\")\n\014OpenResponse\022\n"
+  "\n\002fd\030\001 \001(\005\022\r\n\005error\030\002 \001(\t\"C\n\020ReadRequest"
+  "Multi\022\020\n\010mount_id\030\001 \001(\005\022\n\n\002fd\030\002 \001(\005\022\021\n\tn"
+  "um_bytes\030\003 \001(\005\"+\n\014ReadResponse\022\014\n\004data\030\001"
+  " \001(\014\022\r\n\005error\030\002 \001(\t\"\?\n\021WriteRequestMulti"
+  "\022\020\n\010mount_id\030\001 \001(\005\022\n\n\002fd\030\002 \001(\005\022\014\n\004data\030\003"
+  " \001(\014\"/\n\rWriteResponse\022\017\n\007success\030\001 \001(\010\022\r"
+  "\n\005error\030\002 \001(\t\"P\n\020SeekRequestMulti\022\020\n\010mou"
+  "nt_id\030\001 \001(\005\022\n\n\002fd\030\002 \001(\005\022\016\n\006offset\030\003 \001(\005\022"
+  "\016\n\006whence\030\004 \001(\005\".\n\014SeekResponse\022\017\n\007succe"
+  "ss\030\001 \001(\010\022\r\n\005error\030\002 \001(\t\"1\n\017ListdirRespon"
+  "se\022\017\n\007entries\030\001 \003(\t\022\r\n\005error\030\002 \001(\t\"0\n\016Re"
+  "moveResponse\022\017\n\007success\030\001 \001(\010\022\r\n\005error\030\002"
+  " \001(\t\")\n\tFdRequest\022\020\n\010mount_id\030\001 \001(\005\022\n\n\002f"
+  "d\030\002 \001(\005\"/\n\rCloseResponse\022\017\n\007success\030\001 \001("
+  "\010\022\r\n\005error\030\002 \001(\t\"/\n\rFsyncResponse\022\017\n\007suc"
+  "cess\030\001 \001(\010\022\r\n\005error\030\002 \001(\t\"%\n\021MountStatsR"
+  "equest\022\020\n\010mount_id\030\001 \001(\005\"k\n\017BlockClassSt"
+  "ats\022\023\n\013block_class\030\001 \001(\t\022\014\n\004hits\030\002 \001(\004\022\016"
+  "\n\006misses\030\003 \001(\004\022\021\n\tevictions\030\004 \001(\004\022\022\n\nwri"
+  "tebacks\030\005 \001(\004\"\212\001\n\014LatencyStats\022\n\n\002op\030\001 \001"
+  "(\t\022\r\n\005count\030\002 \001(\004\022\016\n\006blocks\030\003 \001(\004\022\016\n\006err"
+  "ors\030\004 \001(\004\022\017\n\007mean_us\030\005 \001(\001\022\016\n\006p50_us\030\006 \001"
+  "(\004\022\016\n\006p99_us\030\007 \001(\004\022\016\n\006max_us\030\010 \001(\004\"6\n\014Hi"
+  "tRatePoint\022\024\n\014cache_blocks\030\001 \001(\004\022\020\n\010hit_"
+  "rate\030\002 \001(\001\"\244\005\n\022MountStatsResponse\022\r\n\005err"
+  "or\030\001 \001(\t\022\025\n\rcache_enabled\030\002 \001(\010\022\024\n\014cache"
+  "_policy\030\003 \001(\t\022\026\n\016cache_capacity\030\004 \001(\004\022\025\n"
+  "\rcached_blocks\030\005 \001(\004\022\027\n\017metadata_blocks\030"
+  "\006 \001(\004\022\024\n\014dirty_blocks\030\007 \001(\004\022*\n\rblock_cla"
+  "sses\030\010 \003(\0132\023.fs.BlockClassStats\022\022\n\nprefe"
+  "tched\030\t \001(\004\022\025\n\rprefetch_hits\030\n \001(\004\022$\n\nca"
+  "che_miss\030\013 \001(\0132\020.fs.LatencyStats\022(\n\016hit_"
+  "rate_curve\030\014 \003(\0132\020.fs.HitRatePoint\022\036\n\004di"
+  "sk\030\r \003(\0132\020.fs.LatencyStats\022\021\n\tio_engine\030"
+  "\016 \001(\t\022\024\n\014cache_shared\030\017 \001(\010\022\032\n\022cache_quo"
+  "ta_blocks\030\020 \001(\004\022\035\n\025cache_reserved_blocks"
+  "\030\021 \001(\004\022\032\n\022cache_total_blocks\030\022 \001(\004\022\025\n\ric"
+  "ache_inodes\030\023 \001(\004\022\023\n\013icache_hits\030\024 \001(\004\022\025"
+  "\n\ricache_misses\030\025 \001(\004\022\031\n\021icache_writebac"
+  "ks\030\026 \001(\004\022\020\n\010dentries\030\027 \001(\004\022\023\n\013dentry_hit"
+  "s\030\030 \001(\004\022\025\n\rdentry_misses\030\031 \001(\004\022\021\n\tpath_h"
+  "its\030\032 \001(\0042\312\004\n\nFileSystem\022,\n\005Mount\022\020.fs.M"
+  "ountRequest\032\021.fs.MountResponse\022-\n\006Create"
+  "\022\017.fs.FileRequest\032\022.fs.CreateResponse\022+\n"
+  "\005Mkdir\022\017.fs.FileRequest\032\021.fs.MkdirRespon"
+  "se\022)\n\004Open\022\017.fs.FileRequest\032\020.fs.OpenRes"
+  "ponse\022.\n\004Read\022\024.fs.ReadRequestMulti\032\020.fs"
+  ".ReadResponse\0221\n\005Write\022\025.fs.WriteRequest"
+  "Multi\032\021.fs.WriteResponse\022.\n\004Seek\022\024.fs.Se"
+  "ekRequestMulti\032\020.fs.SeekResponse\022/\n\007List"
+  "dir\022\017.fs.FileRequest\032\023.fs.ListdirRespons"
+  "e\022-\n\006Remove\022\017.fs.FileRequest\032\022.fs.Remove"
+  "Response\022>\n\rGetMountStats\022\025.fs.MountStat"
+  "sRequest\032\026.fs.MountStatsResponse\022)\n\005Clos"
+  "e\022\r.fs.FdRequest\032\021.fs.CloseResponse\022)\n\005F"
+  "sync\022\r.fs.FdRequest\032\021.fs.FsyncResponseb\006"
+  "proto3"
   ;
 static ::_pbi::once_flag descriptor_table_filesystem_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_filesystem_2eproto = {
-    false, false, 1241, descriptor_table_protodef_filesystem_2eproto,
+    false, false, 2726, descriptor_table_protodef_filesystem_2eproto,
     "filesystem.proto",
-    &descriptor_table_filesystem_2eproto_once, nullptr, 0, 14,
+    &descriptor_table_filesystem_2eproto_once, nullptr, 0, 22,
     schemas, file_default_instances, TableStruct_filesystem_2eproto::offsets,
     file_level_metadata_filesystem_2eproto, file_level_enum_descriptors_filesystem_2eproto,
     file_level_service_descriptors_filesystem_2eproto,
@@ -448,8 +757,16 @@ MountRequest::MountRequest(const MountRequest& from)
   MountRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.disk_image_){}
-    , decltype(_impl_.enable_cache_){}
+    , decltype(_impl_.io_engine_){}
+    , decltype(_impl_.cache_policy_){}
     , decltype(_impl_.cache_blocks_){}
+    , decltype(_impl_.enable_cache_){}
+    , decltype(_impl_.direct_io_){}
+    , decltype(_impl_.mmap_io_){}
+    , decltype(_impl_.preallocate_){}
+    , decltype(_impl_.num_blocks_){}
+    , decltype(_impl_.num_inodes_){}
+    , decltype(_impl_.cache_reserved_blocks_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -461,9 +778,25 @@ MountRequest::MountRequest(const MountRequest& from)
     _this->_impl_.disk_image_.Set(from._internal_disk_image(), 
       _this->GetArenaForAllocation());
   }
-  ::memcpy(&_impl_.enable_cache_, &from._impl_.enable_cache_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_blocks_) -
-    reinterpret_cast<char*>(&_impl_.enable_cache_)) + sizeof(_impl_.cache_blocks_));
+  _impl_.io_engine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_io_engine().empty()) {
+    _this->_impl_.io_engine_.Set(from._internal_io_engine(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cache_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_policy().empty()) {
+    _this->_impl_.cache_policy_.Set(from._internal_cache_policy(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cache_blocks_, &from._impl_.cache_blocks_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_reserved_blocks_) -
+    reinterpret_cast<char*>(&_impl_.cache_blocks_)) + sizeof(_impl_.cache_reserved_blocks_));
   // @@protoc_insertion_point(copy_constructor:fs.MountRequest)
 }
 
@@ -473,14 +806,30 @@ inline void MountRequest::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.disk_image_){}
-    , decltype(_impl_.enable_cache_){false}
+    , decltype(_impl_.io_engine_){}
+    , decltype(_impl_.cache_policy_){}
     , decltype(_impl_.cache_blocks_){0}
+    , decltype(_impl_.enable_cache_){false}
+    , decltype(_impl_.direct_io_){false}
+    , decltype(_impl_.mmap_io_){false}
+    , decltype(_impl_.preallocate_){false}
+    , decltype(_impl_.num_blocks_){uint64_t{0u}}
+    , decltype(_impl_.num_inodes_){uint64_t{0u}}
+    , decltype(_impl_.cache_reserved_blocks_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.disk_image_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.disk_image_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.io_engine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cache_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MountRequest::~MountRequest() {
@@ -495,6 +844,8 @@ MountRequest::~MountRequest() {
 inline void MountRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.disk_image_.Destroy();
+  _impl_.io_engine_.Destroy();
+  _impl_.cache_policy_.Destroy();
 }
 
 void MountRequest::SetCachedSize(int size) const {
@@ -508,9 +859,11 @@ void MountRequest::Clear() {
   (void) cached_has_bits;
 
   _impl_.disk_image_.ClearToEmpty();
-  ::memset(&_impl_.enable_cache_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.cache_blocks_) -
-      reinterpret_cast<char*>(&_impl_.enable_cache_)) + sizeof(_impl_.cache_blocks_));
+  _impl_.io_engine_.ClearToEmpty();
+  _impl_.cache_policy_.ClearToEmpty();
+  ::memset(&_impl_.cache_blocks_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cache_reserved_blocks_) -
+      reinterpret_cast<char*>(&_impl_.cache_blocks_)) + sizeof(_impl_.cache_reserved_blocks_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -546,6 +899,74 @@ const char* MountRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // string io_engine = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_io_engine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.MountRequest.io_engine"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool direct_io = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.direct_io_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool mmap_io = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.mmap_io_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_blocks = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.num_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_inodes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.num_inodes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool preallocate = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.preallocate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cache_policy = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_cache_policy();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.MountRequest.cache_policy"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_reserved_blocks = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.cache_reserved_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -597,6 +1018,62 @@ uint8_t* MountRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_cache_blocks(), target);
   }
 
+  // string io_engine = 4;
+  if (!this->_internal_io_engine().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_io_engine().data(), static_cast<int>(this->_internal_io_engine().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.MountRequest.io_engine");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_io_engine(), target);
+  }
+
+  // bool direct_io = 5;
+  if (this->_internal_direct_io() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_direct_io(), target);
+  }
+
+  // bool mmap_io = 6;
+  if (this->_internal_mmap_io() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_mmap_io(), target);
+  }
+
+  // uint64 num_blocks = 7;
+  if (this->_internal_num_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_num_blocks(), target);
+  }
+
+  // uint64 num_inodes = 8;
+  if (this->_internal_num_inodes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_num_inodes(), target);
+  }
+
+  // bool preallocate = 9;
+  if (this->_internal_preallocate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_preallocate(), target);
+  }
+
+  // string cache_policy = 10;
+  if (!this->_internal_cache_policy().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cache_policy().data(), static_cast<int>(this->_internal_cache_policy().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.MountRequest.cache_policy");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_cache_policy(), target);
+  }
+
+  // uint64 cache_reserved_blocks = 11;
+  if (this->_internal_cache_reserved_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_cache_reserved_blocks(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -620,9 +1097,18 @@ size_t MountRequest::ByteSizeLong() const {
         this->_internal_disk_image());
   }
 
-  // bool enable_cache = 2;
-  if (this->_internal_enable_cache() != 0) {
-    total_size += 1 + 1;
+  // string io_engine = 4;
+  if (!this->_internal_io_engine().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_io_engine());
+  }
+
+  // string cache_policy = 10;
+  if (!this->_internal_cache_policy().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cache_policy());
   }
 
   // int32 cache_blocks = 3;
@@ -630,6 +1116,41 @@ size_t MountRequest::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cache_blocks());
   }
 
+  // bool enable_cache = 2;
+  if (this->_internal_enable_cache() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool direct_io = 5;
+  if (this->_internal_direct_io() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool mmap_io = 6;
+  if (this->_internal_mmap_io() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool preallocate = 9;
+  if (this->_internal_preallocate() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 num_blocks = 7;
+  if (this->_internal_num_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_blocks());
+  }
+
+  // uint64 num_inodes = 8;
+  if (this->_internal_num_inodes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_inodes());
+  }
+
+  // uint64 cache_reserved_blocks = 11;
+  if (this->_internal_cache_reserved_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_reserved_blocks());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -651,12 +1172,36 @@ void MountRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (!from._internal_disk_image().empty()) {
     _this->_internal_set_disk_image(from._internal_disk_image());
   }
-  if (from._internal_enable_cache() != 0) {
-    _this->_internal_set_enable_cache(from._internal_enable_cache());
+  if (!from._internal_io_engine().empty()) {
+    _this->_internal_set_io_engine(from._internal_io_engine());
+  }
+  if (!from._internal_cache_policy().empty()) {
+    _this->_internal_set_cache_policy(from._internal_cache_policy());
   }
   if (from._internal_cache_blocks() != 0) {
     _this->_internal_set_cache_blocks(from._internal_cache_blocks());
   }
+  if (from._internal_enable_cache() != 0) {
+    _this->_internal_set_enable_cache(from._internal_enable_cache());
+  }
+  if (from._internal_direct_io() != 0) {
+    _this->_internal_set_direct_io(from._internal_direct_io());
+  }
+  if (from._internal_mmap_io() != 0) {
+    _this->_internal_set_mmap_io(from._internal_mmap_io());
+  }
+  if (from._internal_preallocate() != 0) {
+    _this->_internal_set_preallocate(from._internal_preallocate());
+  }
+  if (from._internal_num_blocks() != 0) {
+    _this->_internal_set_num_blocks(from._internal_num_blocks());
+  }
+  if (from._internal_num_inodes() != 0) {
+    _this->_internal_set_num_inodes(from._internal_num_inodes());
+  }
+  if (from._internal_cache_reserved_blocks() != 0) {
+    _this->_internal_set_cache_reserved_blocks(from._internal_cache_reserved_blocks());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -680,12 +1225,20 @@ void MountRequest::InternalSwap(MountRequest* other) {
       &_impl_.disk_image_, lhs_arena,
       &other->_impl_.disk_image_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.io_engine_, lhs_arena,
+      &other->_impl_.io_engine_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_policy_, lhs_arena,
+      &other->_impl_.cache_policy_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(MountRequest, _impl_.cache_blocks_)
-      + sizeof(MountRequest::_impl_.cache_blocks_)
-      - PROTOBUF_FIELD_OFFSET(MountRequest, _impl_.enable_cache_)>(
-          reinterpret_cast<char*>(&_impl_.enable_cache_),
-          reinterpret_cast<char*>(&other->_impl_.enable_cache_));
+      PROTOBUF_FIELD_OFFSET(MountRequest, _impl_.cache_reserved_blocks_)
+      + sizeof(MountRequest::_impl_.cache_reserved_blocks_)
+      - PROTOBUF_FIELD_OFFSET(MountRequest, _impl_.cache_blocks_)>(
+          reinterpret_cast<char*>(&_impl_.cache_blocks_),
+          reinterpret_cast<char*>(&other->_impl_.cache_blocks_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata MountRequest::GetMetadata() const {
@@ -3776,24 +4329,2738 @@ void RemoveResponse::InternalSwap(RemoveResponse* other) {
       file_level_metadata_filesystem_2eproto[13]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace fs
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::fs::MountRequest*
-Arena::CreateMaybeMessage< ::fs::MountRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::fs::MountRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::fs::MountResponse*
-Arena::CreateMaybeMessage< ::fs::MountResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::fs::MountResponse >(arena);
+// ===================================================================
+
+class FdRequest::_Internal {
+ public:
+};
+
+FdRequest::FdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.FdRequest)
 }
-template<> PROTOBUF_NOINLINE ::fs::FileRequest*
-Arena::CreateMaybeMessage< ::fs::FileRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::fs::FileRequest >(arena);
+FdRequest::FdRequest(const FdRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FdRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mount_id_){}
+    , decltype(_impl_.fd_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.mount_id_, &from._impl_.mount_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fd_) -
+    reinterpret_cast<char*>(&_impl_.mount_id_)) + sizeof(_impl_.fd_));
+  // @@protoc_insertion_point(copy_constructor:fs.FdRequest)
 }
-template<> PROTOBUF_NOINLINE ::fs::CreateResponse*
-Arena::CreateMaybeMessage< ::fs::CreateResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::fs::CreateResponse >(arena);
+
+inline void FdRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mount_id_){0}
+    , decltype(_impl_.fd_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FdRequest::~FdRequest() {
+  // @@protoc_insertion_point(destructor:fs.FdRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FdRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FdRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.FdRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.mount_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.fd_) -
+      reinterpret_cast<char*>(&_impl_.mount_id_)) + sizeof(_impl_.fd_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FdRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 mount_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.mount_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 fd = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FdRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.FdRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 mount_id = 1;
+  if (this->_internal_mount_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_mount_id(), target);
+  }
+
+  // int32 fd = 2;
+  if (this->_internal_fd() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_fd(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.FdRequest)
+  return target;
+}
+
+size_t FdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.FdRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 mount_id = 1;
+  if (this->_internal_mount_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mount_id());
+  }
+
+  // int32 fd = 2;
+  if (this->_internal_fd() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fd());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FdRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FdRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FdRequest::GetClassData() const { return &_class_data_; }
+
+
+void FdRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FdRequest*>(&to_msg);
+  auto& from = static_cast<const FdRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.FdRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_mount_id() != 0) {
+    _this->_internal_set_mount_id(from._internal_mount_id());
+  }
+  if (from._internal_fd() != 0) {
+    _this->_internal_set_fd(from._internal_fd());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FdRequest::CopyFrom(const FdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.FdRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FdRequest::IsInitialized() const {
+  return true;
+}
+
+void FdRequest::InternalSwap(FdRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FdRequest, _impl_.fd_)
+      + sizeof(FdRequest::_impl_.fd_)
+      - PROTOBUF_FIELD_OFFSET(FdRequest, _impl_.mount_id_)>(
+          reinterpret_cast<char*>(&_impl_.mount_id_),
+          reinterpret_cast<char*>(&other->_impl_.mount_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FdRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[14]);
+}
+
+// ===================================================================
+
+class CloseResponse::_Internal {
+ public:
+};
+
+CloseResponse::CloseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.CloseResponse)
+}
+CloseResponse::CloseResponse(const CloseResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CloseResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error().empty()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
+  // @@protoc_insertion_point(copy_constructor:fs.CloseResponse)
+}
+
+inline void CloseResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CloseResponse::~CloseResponse() {
+  // @@protoc_insertion_point(destructor:fs.CloseResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CloseResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void CloseResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CloseResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CloseResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CloseResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CloseResponse.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CloseResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CloseResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // string error = 2;
+  if (!this->_internal_error().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CloseResponse.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CloseResponse)
+  return target;
+}
+
+size_t CloseResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CloseResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error = 2;
+  if (!this->_internal_error().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CloseResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CloseResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CloseResponse::GetClassData() const { return &_class_data_; }
+
+
+void CloseResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CloseResponse*>(&to_msg);
+  auto& from = static_cast<const CloseResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CloseResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error().empty()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CloseResponse::CopyFrom(const CloseResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CloseResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CloseResponse::IsInitialized() const {
+  return true;
+}
+
+void CloseResponse::InternalSwap(CloseResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CloseResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[15]);
+}
+
+// ===================================================================
+
+class FsyncResponse::_Internal {
+ public:
+};
+
+FsyncResponse::FsyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.FsyncResponse)
+}
+FsyncResponse::FsyncResponse(const FsyncResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FsyncResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error().empty()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.success_ = from._impl_.success_;
+  // @@protoc_insertion_point(copy_constructor:fs.FsyncResponse)
+}
+
+inline void FsyncResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FsyncResponse::~FsyncResponse() {
+  // @@protoc_insertion_point(destructor:fs.FsyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FsyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void FsyncResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FsyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.FsyncResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_.ClearToEmpty();
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FsyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.FsyncResponse.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FsyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.FsyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // string error = 2;
+  if (!this->_internal_error().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.FsyncResponse.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.FsyncResponse)
+  return target;
+}
+
+size_t FsyncResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.FsyncResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error = 2;
+  if (!this->_internal_error().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FsyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FsyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FsyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void FsyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FsyncResponse*>(&to_msg);
+  auto& from = static_cast<const FsyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.FsyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error().empty()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FsyncResponse::CopyFrom(const FsyncResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.FsyncResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FsyncResponse::IsInitialized() const {
+  return true;
+}
+
+void FsyncResponse::InternalSwap(FsyncResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.success_, other->_impl_.success_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FsyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[16]);
+}
+
+// ===================================================================
+
+class MountStatsRequest::_Internal {
+ public:
+};
+
+MountStatsRequest::MountStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.MountStatsRequest)
+}
+MountStatsRequest::MountStatsRequest(const MountStatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MountStatsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mount_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.mount_id_ = from._impl_.mount_id_;
+  // @@protoc_insertion_point(copy_constructor:fs.MountStatsRequest)
+}
+
+inline void MountStatsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mount_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MountStatsRequest::~MountStatsRequest() {
+  // @@protoc_insertion_point(destructor:fs.MountStatsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MountStatsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MountStatsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MountStatsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.MountStatsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.mount_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MountStatsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 mount_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.mount_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MountStatsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.MountStatsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 mount_id = 1;
+  if (this->_internal_mount_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_mount_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.MountStatsRequest)
+  return target;
+}
+
+size_t MountStatsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.MountStatsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 mount_id = 1;
+  if (this->_internal_mount_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mount_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MountStatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MountStatsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MountStatsRequest::GetClassData() const { return &_class_data_; }
+
+
+void MountStatsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MountStatsRequest*>(&to_msg);
+  auto& from = static_cast<const MountStatsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.MountStatsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_mount_id() != 0) {
+    _this->_internal_set_mount_id(from._internal_mount_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MountStatsRequest::CopyFrom(const MountStatsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.MountStatsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MountStatsRequest::IsInitialized() const {
+  return true;
+}
+
+void MountStatsRequest::InternalSwap(MountStatsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.mount_id_, other->_impl_.mount_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MountStatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[17]);
+}
+
+// ===================================================================
+
+class BlockClassStats::_Internal {
+ public:
+};
+
+BlockClassStats::BlockClassStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.BlockClassStats)
+}
+BlockClassStats::BlockClassStats(const BlockClassStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockClassStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_class_){}
+    , decltype(_impl_.hits_){}
+    , decltype(_impl_.misses_){}
+    , decltype(_impl_.evictions_){}
+    , decltype(_impl_.writebacks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.block_class_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.block_class_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_block_class().empty()) {
+    _this->_impl_.block_class_.Set(from._internal_block_class(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.hits_, &from._impl_.hits_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.writebacks_) -
+    reinterpret_cast<char*>(&_impl_.hits_)) + sizeof(_impl_.writebacks_));
+  // @@protoc_insertion_point(copy_constructor:fs.BlockClassStats)
+}
+
+inline void BlockClassStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_class_){}
+    , decltype(_impl_.hits_){uint64_t{0u}}
+    , decltype(_impl_.misses_){uint64_t{0u}}
+    , decltype(_impl_.evictions_){uint64_t{0u}}
+    , decltype(_impl_.writebacks_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.block_class_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.block_class_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlockClassStats::~BlockClassStats() {
+  // @@protoc_insertion_point(destructor:fs.BlockClassStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlockClassStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.block_class_.Destroy();
+}
+
+void BlockClassStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlockClassStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BlockClassStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.block_class_.ClearToEmpty();
+  ::memset(&_impl_.hits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.writebacks_) -
+      reinterpret_cast<char*>(&_impl_.hits_)) + sizeof(_impl_.writebacks_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlockClassStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string block_class = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_block_class();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BlockClassStats.block_class"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 hits = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 misses = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.misses_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 evictions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.evictions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 writebacks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.writebacks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlockClassStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BlockClassStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string block_class = 1;
+  if (!this->_internal_block_class().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_block_class().data(), static_cast<int>(this->_internal_block_class().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BlockClassStats.block_class");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_block_class(), target);
+  }
+
+  // uint64 hits = 2;
+  if (this->_internal_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_hits(), target);
+  }
+
+  // uint64 misses = 3;
+  if (this->_internal_misses() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_misses(), target);
+  }
+
+  // uint64 evictions = 4;
+  if (this->_internal_evictions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_evictions(), target);
+  }
+
+  // uint64 writebacks = 5;
+  if (this->_internal_writebacks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_writebacks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BlockClassStats)
+  return target;
+}
+
+size_t BlockClassStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BlockClassStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string block_class = 1;
+  if (!this->_internal_block_class().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_block_class());
+  }
+
+  // uint64 hits = 2;
+  if (this->_internal_hits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hits());
+  }
+
+  // uint64 misses = 3;
+  if (this->_internal_misses() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_misses());
+  }
+
+  // uint64 evictions = 4;
+  if (this->_internal_evictions() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_evictions());
+  }
+
+  // uint64 writebacks = 5;
+  if (this->_internal_writebacks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_writebacks());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockClassStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockClassStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockClassStats::GetClassData() const { return &_class_data_; }
+
+
+void BlockClassStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockClassStats*>(&to_msg);
+  auto& from = static_cast<const BlockClassStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BlockClassStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_block_class().empty()) {
+    _this->_internal_set_block_class(from._internal_block_class());
+  }
+  if (from._internal_hits() != 0) {
+    _this->_internal_set_hits(from._internal_hits());
+  }
+  if (from._internal_misses() != 0) {
+    _this->_internal_set_misses(from._internal_misses());
+  }
+  if (from._internal_evictions() != 0) {
+    _this->_internal_set_evictions(from._internal_evictions());
+  }
+  if (from._internal_writebacks() != 0) {
+    _this->_internal_set_writebacks(from._internal_writebacks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlockClassStats::CopyFrom(const BlockClassStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BlockClassStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockClassStats::IsInitialized() const {
+  return true;
+}
+
+void BlockClassStats::InternalSwap(BlockClassStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.block_class_, lhs_arena,
+      &other->_impl_.block_class_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BlockClassStats, _impl_.writebacks_)
+      + sizeof(BlockClassStats::_impl_.writebacks_)
+      - PROTOBUF_FIELD_OFFSET(BlockClassStats, _impl_.hits_)>(
+          reinterpret_cast<char*>(&_impl_.hits_),
+          reinterpret_cast<char*>(&other->_impl_.hits_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlockClassStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[18]);
+}
+
+// ===================================================================
+
+class LatencyStats::_Internal {
+ public:
+};
+
+LatencyStats::LatencyStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.LatencyStats)
+}
+LatencyStats::LatencyStats(const LatencyStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.blocks_){}
+    , decltype(_impl_.errors_){}
+    , decltype(_impl_.mean_us_){}
+    , decltype(_impl_.p50_us_){}
+    , decltype(_impl_.p99_us_){}
+    , decltype(_impl_.max_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_op().empty()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_us_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_us_));
+  // @@protoc_insertion_point(copy_constructor:fs.LatencyStats)
+}
+
+inline void LatencyStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.blocks_){uint64_t{0u}}
+    , decltype(_impl_.errors_){uint64_t{0u}}
+    , decltype(_impl_.mean_us_){0}
+    , decltype(_impl_.p50_us_){uint64_t{0u}}
+    , decltype(_impl_.p99_us_){uint64_t{0u}}
+    , decltype(_impl_.max_us_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LatencyStats::~LatencyStats() {
+  // @@protoc_insertion_point(destructor:fs.LatencyStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+}
+
+void LatencyStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.LatencyStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.op_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_us_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_us_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.LatencyStats.op"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 blocks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 errors = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.errors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double mean_us = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.mean_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p50_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p99_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.LatencyStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (!this->_internal_op().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_op().data(), static_cast<int>(this->_internal_op().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.LatencyStats.op");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_op(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint64 blocks = 3;
+  if (this->_internal_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_blocks(), target);
+  }
+
+  // uint64 errors = 4;
+  if (this->_internal_errors() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_errors(), target);
+  }
+
+  // double mean_us = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_us = this->_internal_mean_us();
+  uint64_t raw_mean_us;
+  memcpy(&raw_mean_us, &tmp_mean_us, sizeof(tmp_mean_us));
+  if (raw_mean_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_mean_us(), target);
+  }
+
+  // uint64 p50_us = 6;
+  if (this->_internal_p50_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p50_us(), target);
+  }
+
+  // uint64 p99_us = 7;
+  if (this->_internal_p99_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p99_us(), target);
+  }
+
+  // uint64 max_us = 8;
+  if (this->_internal_max_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_max_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.LatencyStats)
+  return target;
+}
+
+size_t LatencyStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.LatencyStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (!this->_internal_op().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_op());
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 blocks = 3;
+  if (this->_internal_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_blocks());
+  }
+
+  // uint64 errors = 4;
+  if (this->_internal_errors() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_errors());
+  }
+
+  // double mean_us = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_us = this->_internal_mean_us();
+  uint64_t raw_mean_us;
+  memcpy(&raw_mean_us, &tmp_mean_us, sizeof(tmp_mean_us));
+  if (raw_mean_us != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 p50_us = 6;
+  if (this->_internal_p50_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50_us());
+  }
+
+  // uint64 p99_us = 7;
+  if (this->_internal_p99_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99_us());
+  }
+
+  // uint64 max_us = 8;
+  if (this->_internal_max_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyStats::GetClassData() const { return &_class_data_; }
+
+
+void LatencyStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyStats*>(&to_msg);
+  auto& from = static_cast<const LatencyStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.LatencyStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_blocks() != 0) {
+    _this->_internal_set_blocks(from._internal_blocks());
+  }
+  if (from._internal_errors() != 0) {
+    _this->_internal_set_errors(from._internal_errors());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean_us = from._internal_mean_us();
+  uint64_t raw_mean_us;
+  memcpy(&raw_mean_us, &tmp_mean_us, sizeof(tmp_mean_us));
+  if (raw_mean_us != 0) {
+    _this->_internal_set_mean_us(from._internal_mean_us());
+  }
+  if (from._internal_p50_us() != 0) {
+    _this->_internal_set_p50_us(from._internal_p50_us());
+  }
+  if (from._internal_p99_us() != 0) {
+    _this->_internal_set_p99_us(from._internal_p99_us());
+  }
+  if (from._internal_max_us() != 0) {
+    _this->_internal_set_max_us(from._internal_max_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyStats::CopyFrom(const LatencyStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.LatencyStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyStats::IsInitialized() const {
+  return true;
+}
+
+void LatencyStats::InternalSwap(LatencyStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyStats, _impl_.max_us_)
+      + sizeof(LatencyStats::_impl_.max_us_)
+      - PROTOBUF_FIELD_OFFSET(LatencyStats, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[19]);
+}
+
+// ===================================================================
+
+class HitRatePoint::_Internal {
+ public:
+};
+
+HitRatePoint::HitRatePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.HitRatePoint)
+}
+HitRatePoint::HitRatePoint(const HitRatePoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HitRatePoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_blocks_){}
+    , decltype(_impl_.hit_rate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.cache_blocks_, &from._impl_.cache_blocks_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hit_rate_) -
+    reinterpret_cast<char*>(&_impl_.cache_blocks_)) + sizeof(_impl_.hit_rate_));
+  // @@protoc_insertion_point(copy_constructor:fs.HitRatePoint)
+}
+
+inline void HitRatePoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cache_blocks_){uint64_t{0u}}
+    , decltype(_impl_.hit_rate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HitRatePoint::~HitRatePoint() {
+  // @@protoc_insertion_point(destructor:fs.HitRatePoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HitRatePoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void HitRatePoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HitRatePoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HitRatePoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.cache_blocks_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.hit_rate_) -
+      reinterpret_cast<char*>(&_impl_.cache_blocks_)) + sizeof(_impl_.hit_rate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HitRatePoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 cache_blocks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cache_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double hit_rate = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.hit_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HitRatePoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HitRatePoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 cache_blocks = 1;
+  if (this->_internal_cache_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_cache_blocks(), target);
+  }
+
+  // double hit_rate = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_hit_rate = this->_internal_hit_rate();
+  uint64_t raw_hit_rate;
+  memcpy(&raw_hit_rate, &tmp_hit_rate, sizeof(tmp_hit_rate));
+  if (raw_hit_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_hit_rate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HitRatePoint)
+  return target;
+}
+
+size_t HitRatePoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HitRatePoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 cache_blocks = 1;
+  if (this->_internal_cache_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_blocks());
+  }
+
+  // double hit_rate = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_hit_rate = this->_internal_hit_rate();
+  uint64_t raw_hit_rate;
+  memcpy(&raw_hit_rate, &tmp_hit_rate, sizeof(tmp_hit_rate));
+  if (raw_hit_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HitRatePoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HitRatePoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HitRatePoint::GetClassData() const { return &_class_data_; }
+
+
+void HitRatePoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HitRatePoint*>(&to_msg);
+  auto& from = static_cast<const HitRatePoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HitRatePoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_cache_blocks() != 0) {
+    _this->_internal_set_cache_blocks(from._internal_cache_blocks());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_hit_rate = from._internal_hit_rate();
+  uint64_t raw_hit_rate;
+  memcpy(&raw_hit_rate, &tmp_hit_rate, sizeof(tmp_hit_rate));
+  if (raw_hit_rate != 0) {
+    _this->_internal_set_hit_rate(from._internal_hit_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HitRatePoint::CopyFrom(const HitRatePoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HitRatePoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HitRatePoint::IsInitialized() const {
+  return true;
+}
+
+void HitRatePoint::InternalSwap(HitRatePoint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HitRatePoint, _impl_.hit_rate_)
+      + sizeof(HitRatePoint::_impl_.hit_rate_)
+      - PROTOBUF_FIELD_OFFSET(HitRatePoint, _impl_.cache_blocks_)>(
+          reinterpret_cast<char*>(&_impl_.cache_blocks_),
+          reinterpret_cast<char*>(&other->_impl_.cache_blocks_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HitRatePoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[20]);
+}
+
+// ===================================================================
+
+class MountStatsResponse::_Internal {
+ public:
+  static const ::fs::LatencyStats& cache_miss(const MountStatsResponse* msg);
+};
+
+const ::fs::LatencyStats&
+MountStatsResponse::_Internal::cache_miss(const MountStatsResponse* msg) {
+  return *msg->_impl_.cache_miss_;
+}
+MountStatsResponse::MountStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.MountStatsResponse)
+}
+MountStatsResponse::MountStatsResponse(const MountStatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MountStatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_classes_){from._impl_.block_classes_}
+    , decltype(_impl_.hit_rate_curve_){from._impl_.hit_rate_curve_}
+    , decltype(_impl_.disk_){from._impl_.disk_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.cache_policy_){}
+    , decltype(_impl_.io_engine_){}
+    , decltype(_impl_.cache_miss_){nullptr}
+    , decltype(_impl_.cache_capacity_){}
+    , decltype(_impl_.cached_blocks_){}
+    , decltype(_impl_.metadata_blocks_){}
+    , decltype(_impl_.dirty_blocks_){}
+    , decltype(_impl_.prefetched_){}
+    , decltype(_impl_.prefetch_hits_){}
+    , decltype(_impl_.cache_quota_blocks_){}
+    , decltype(_impl_.cache_reserved_blocks_){}
+    , decltype(_impl_.cache_total_blocks_){}
+    , decltype(_impl_.icache_inodes_){}
+    , decltype(_impl_.icache_hits_){}
+    , decltype(_impl_.icache_misses_){}
+    , decltype(_impl_.icache_writebacks_){}
+    , decltype(_impl_.dentries_){}
+    , decltype(_impl_.dentry_hits_){}
+    , decltype(_impl_.dentry_misses_){}
+    , decltype(_impl_.path_hits_){}
+    , decltype(_impl_.cache_enabled_){}
+    , decltype(_impl_.cache_shared_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error().empty()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cache_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cache_policy().empty()) {
+    _this->_impl_.cache_policy_.Set(from._internal_cache_policy(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.io_engine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_io_engine().empty()) {
+    _this->_impl_.io_engine_.Set(from._internal_io_engine(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_cache_miss()) {
+    _this->_impl_.cache_miss_ = new ::fs::LatencyStats(*from._impl_.cache_miss_);
+  }
+  ::memcpy(&_impl_.cache_capacity_, &from._impl_.cache_capacity_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cache_shared_) -
+    reinterpret_cast<char*>(&_impl_.cache_capacity_)) + sizeof(_impl_.cache_shared_));
+  // @@protoc_insertion_point(copy_constructor:fs.MountStatsResponse)
+}
+
+inline void MountStatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_classes_){arena}
+    , decltype(_impl_.hit_rate_curve_){arena}
+    , decltype(_impl_.disk_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.cache_policy_){}
+    , decltype(_impl_.io_engine_){}
+    , decltype(_impl_.cache_miss_){nullptr}
+    , decltype(_impl_.cache_capacity_){uint64_t{0u}}
+    , decltype(_impl_.cached_blocks_){uint64_t{0u}}
+    , decltype(_impl_.metadata_blocks_){uint64_t{0u}}
+    , decltype(_impl_.dirty_blocks_){uint64_t{0u}}
+    , decltype(_impl_.prefetched_){uint64_t{0u}}
+    , decltype(_impl_.prefetch_hits_){uint64_t{0u}}
+    , decltype(_impl_.cache_quota_blocks_){uint64_t{0u}}
+    , decltype(_impl_.cache_reserved_blocks_){uint64_t{0u}}
+    , decltype(_impl_.cache_total_blocks_){uint64_t{0u}}
+    , decltype(_impl_.icache_inodes_){uint64_t{0u}}
+    , decltype(_impl_.icache_hits_){uint64_t{0u}}
+    , decltype(_impl_.icache_misses_){uint64_t{0u}}
+    , decltype(_impl_.icache_writebacks_){uint64_t{0u}}
+    , decltype(_impl_.dentries_){uint64_t{0u}}
+    , decltype(_impl_.dentry_hits_){uint64_t{0u}}
+    , decltype(_impl_.dentry_misses_){uint64_t{0u}}
+    , decltype(_impl_.path_hits_){uint64_t{0u}}
+    , decltype(_impl_.cache_enabled_){false}
+    , decltype(_impl_.cache_shared_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cache_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.io_engine_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MountStatsResponse::~MountStatsResponse() {
+  // @@protoc_insertion_point(destructor:fs.MountStatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MountStatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.block_classes_.~RepeatedPtrField();
+  _impl_.hit_rate_curve_.~RepeatedPtrField();
+  _impl_.disk_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+  _impl_.cache_policy_.Destroy();
+  _impl_.io_engine_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.cache_miss_;
+}
+
+void MountStatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MountStatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.MountStatsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.block_classes_.Clear();
+  _impl_.hit_rate_curve_.Clear();
+  _impl_.disk_.Clear();
+  _impl_.error_.ClearToEmpty();
+  _impl_.cache_policy_.ClearToEmpty();
+  _impl_.io_engine_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.cache_miss_ != nullptr) {
+    delete _impl_.cache_miss_;
+  }
+  _impl_.cache_miss_ = nullptr;
+  ::memset(&_impl_.cache_capacity_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cache_shared_) -
+      reinterpret_cast<char*>(&_impl_.cache_capacity_)) + sizeof(_impl_.cache_shared_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MountStatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.MountStatsResponse.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cache_enabled = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cache_enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cache_policy = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_cache_policy();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.MountStatsResponse.cache_policy"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_capacity = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.cache_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cached_blocks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.cached_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 metadata_blocks = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.metadata_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dirty_blocks = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.dirty_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .fs.BlockClassStats block_classes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_block_classes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 prefetched = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.prefetched_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 prefetch_hits = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.prefetch_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.LatencyStats cache_miss = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cache_miss(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .fs.HitRatePoint hit_rate_curve = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_hit_rate_curve(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .fs.LatencyStats disk = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_disk(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string io_engine = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_io_engine();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.MountStatsResponse.io_engine"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cache_shared = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.cache_shared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_quota_blocks = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.cache_quota_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_reserved_blocks = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _impl_.cache_reserved_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cache_total_blocks = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _impl_.cache_total_blocks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 icache_inodes = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _impl_.icache_inodes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 icache_hits = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.icache_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 icache_misses = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _impl_.icache_misses_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 icache_writebacks = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _impl_.icache_writebacks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dentries = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _impl_.dentries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dentry_hits = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 192)) {
+          _impl_.dentry_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dentry_misses = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          _impl_.dentry_misses_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 path_hits = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 208)) {
+          _impl_.path_hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MountStatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.MountStatsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string error = 1;
+  if (!this->_internal_error().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.MountStatsResponse.error");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_error(), target);
+  }
+
+  // bool cache_enabled = 2;
+  if (this->_internal_cache_enabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_cache_enabled(), target);
+  }
+
+  // string cache_policy = 3;
+  if (!this->_internal_cache_policy().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cache_policy().data(), static_cast<int>(this->_internal_cache_policy().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.MountStatsResponse.cache_policy");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_cache_policy(), target);
+  }
+
+  // uint64 cache_capacity = 4;
+  if (this->_internal_cache_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_cache_capacity(), target);
+  }
+
+  // uint64 cached_blocks = 5;
+  if (this->_internal_cached_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_cached_blocks(), target);
+  }
+
+  // uint64 metadata_blocks = 6;
+  if (this->_internal_metadata_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_metadata_blocks(), target);
+  }
+
+  // uint64 dirty_blocks = 7;
+  if (this->_internal_dirty_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_dirty_blocks(), target);
+  }
+
+  // repeated .fs.BlockClassStats block_classes = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_block_classes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_block_classes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 prefetched = 9;
+  if (this->_internal_prefetched() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_prefetched(), target);
+  }
+
+  // uint64 prefetch_hits = 10;
+  if (this->_internal_prefetch_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_prefetch_hits(), target);
+  }
+
+  // .fs.LatencyStats cache_miss = 11;
+  if (this->_internal_has_cache_miss()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::cache_miss(this),
+        _Internal::cache_miss(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .fs.HitRatePoint hit_rate_curve = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_hit_rate_curve_size()); i < n; i++) {
+    const auto& repfield = this->_internal_hit_rate_curve(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .fs.LatencyStats disk = 13;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_disk_size()); i < n; i++) {
+    const auto& repfield = this->_internal_disk(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(13, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string io_engine = 14;
+  if (!this->_internal_io_engine().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_io_engine().data(), static_cast<int>(this->_internal_io_engine().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.MountStatsResponse.io_engine");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_io_engine(), target);
+  }
+
+  // bool cache_shared = 15;
+  if (this->_internal_cache_shared() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_cache_shared(), target);
+  }
+
+  // uint64 cache_quota_blocks = 16;
+  if (this->_internal_cache_quota_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(16, this->_internal_cache_quota_blocks(), target);
+  }
+
+  // uint64 cache_reserved_blocks = 17;
+  if (this->_internal_cache_reserved_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(17, this->_internal_cache_reserved_blocks(), target);
+  }
+
+  // uint64 cache_total_blocks = 18;
+  if (this->_internal_cache_total_blocks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(18, this->_internal_cache_total_blocks(), target);
+  }
+
+  // uint64 icache_inodes = 19;
+  if (this->_internal_icache_inodes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(19, this->_internal_icache_inodes(), target);
+  }
+
+  // uint64 icache_hits = 20;
+  if (this->_internal_icache_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(20, this->_internal_icache_hits(), target);
+  }
+
+  // uint64 icache_misses = 21;
+  if (this->_internal_icache_misses() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(21, this->_internal_icache_misses(), target);
+  }
+
+  // uint64 icache_writebacks = 22;
+  if (this->_internal_icache_writebacks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(22, this->_internal_icache_writebacks(), target);
+  }
+
+  // uint64 dentries = 23;
+  if (this->_internal_dentries() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(23, this->_internal_dentries(), target);
+  }
+
+  // uint64 dentry_hits = 24;
+  if (this->_internal_dentry_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(24, this->_internal_dentry_hits(), target);
+  }
+
+  // uint64 dentry_misses = 25;
+  if (this->_internal_dentry_misses() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(25, this->_internal_dentry_misses(), target);
+  }
+
+  // uint64 path_hits = 26;
+  if (this->_internal_path_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(26, this->_internal_path_hits(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.MountStatsResponse)
+  return target;
+}
+
+size_t MountStatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.MountStatsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .fs.BlockClassStats block_classes = 8;
+  total_size += 1UL * this->_internal_block_classes_size();
+  for (const auto& msg : this->_impl_.block_classes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .fs.HitRatePoint hit_rate_curve = 12;
+  total_size += 1UL * this->_internal_hit_rate_curve_size();
+  for (const auto& msg : this->_impl_.hit_rate_curve_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .fs.LatencyStats disk = 13;
+  total_size += 1UL * this->_internal_disk_size();
+  for (const auto& msg : this->_impl_.disk_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string error = 1;
+  if (!this->_internal_error().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // string cache_policy = 3;
+  if (!this->_internal_cache_policy().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cache_policy());
+  }
+
+  // string io_engine = 14;
+  if (!this->_internal_io_engine().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_io_engine());
+  }
+
+  // .fs.LatencyStats cache_miss = 11;
+  if (this->_internal_has_cache_miss()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.cache_miss_);
+  }
+
+  // uint64 cache_capacity = 4;
+  if (this->_internal_cache_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cache_capacity());
+  }
+
+  // uint64 cached_blocks = 5;
+  if (this->_internal_cached_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cached_blocks());
+  }
+
+  // uint64 metadata_blocks = 6;
+  if (this->_internal_metadata_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_metadata_blocks());
+  }
+
+  // uint64 dirty_blocks = 7;
+  if (this->_internal_dirty_blocks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dirty_blocks());
+  }
+
+  // uint64 prefetched = 9;
+  if (this->_internal_prefetched() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prefetched());
+  }
+
+  // uint64 prefetch_hits = 10;
+  if (this->_internal_prefetch_hits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prefetch_hits());
+  }
+
+  // uint64 cache_quota_blocks = 16;
+  if (this->_internal_cache_quota_blocks() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_cache_quota_blocks());
+  }
+
+  // uint64 cache_reserved_blocks = 17;
+  if (this->_internal_cache_reserved_blocks() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_cache_reserved_blocks());
+  }
+
+  // uint64 cache_total_blocks = 18;
+  if (this->_internal_cache_total_blocks() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_cache_total_blocks());
+  }
+
+  // uint64 icache_inodes = 19;
+  if (this->_internal_icache_inodes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_icache_inodes());
+  }
+
+  // uint64 icache_hits = 20;
+  if (this->_internal_icache_hits() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_icache_hits());
+  }
+
+  // uint64 icache_misses = 21;
+  if (this->_internal_icache_misses() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_icache_misses());
+  }
+
+  // uint64 icache_writebacks = 22;
+  if (this->_internal_icache_writebacks() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_icache_writebacks());
+  }
+
+  // uint64 dentries = 23;
+  if (this->_internal_dentries() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_dentries());
+  }
+
+  // uint64 dentry_hits = 24;
+  if (this->_internal_dentry_hits() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_dentry_hits());
+  }
+
+  // uint64 dentry_misses = 25;
+  if (this->_internal_dentry_misses() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_dentry_misses());
+  }
+
+  // uint64 path_hits = 26;
+  if (this->_internal_path_hits() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_path_hits());
+  }
+
+  // bool cache_enabled = 2;
+  if (this->_internal_cache_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool cache_shared = 15;
+  if (this->_internal_cache_shared() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MountStatsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MountStatsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MountStatsResponse::GetClassData() const { return &_class_data_; }
+
+
+void MountStatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MountStatsResponse*>(&to_msg);
+  auto& from = static_cast<const MountStatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.MountStatsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.block_classes_.MergeFrom(from._impl_.block_classes_);
+  _this->_impl_.hit_rate_curve_.MergeFrom(from._impl_.hit_rate_curve_);
+  _this->_impl_.disk_.MergeFrom(from._impl_.disk_);
+  if (!from._internal_error().empty()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (!from._internal_cache_policy().empty()) {
+    _this->_internal_set_cache_policy(from._internal_cache_policy());
+  }
+  if (!from._internal_io_engine().empty()) {
+    _this->_internal_set_io_engine(from._internal_io_engine());
+  }
+  if (from._internal_has_cache_miss()) {
+    _this->_internal_mutable_cache_miss()->::fs::LatencyStats::MergeFrom(
+        from._internal_cache_miss());
+  }
+  if (from._internal_cache_capacity() != 0) {
+    _this->_internal_set_cache_capacity(from._internal_cache_capacity());
+  }
+  if (from._internal_cached_blocks() != 0) {
+    _this->_internal_set_cached_blocks(from._internal_cached_blocks());
+  }
+  if (from._internal_metadata_blocks() != 0) {
+    _this->_internal_set_metadata_blocks(from._internal_metadata_blocks());
+  }
+  if (from._internal_dirty_blocks() != 0) {
+    _this->_internal_set_dirty_blocks(from._internal_dirty_blocks());
+  }
+  if (from._internal_prefetched() != 0) {
+    _this->_internal_set_prefetched(from._internal_prefetched());
+  }
+  if (from._internal_prefetch_hits() != 0) {
+    _this->_internal_set_prefetch_hits(from._internal_prefetch_hits());
+  }
+  if (from._internal_cache_quota_blocks() != 0) {
+    _this->_internal_set_cache_quota_blocks(from._internal_cache_quota_blocks());
+  }
+  if (from._internal_cache_reserved_blocks() != 0) {
+    _this->_internal_set_cache_reserved_blocks(from._internal_cache_reserved_blocks());
+  }
+  if (from._internal_cache_total_blocks() != 0) {
+    _this->_internal_set_cache_total_blocks(from._internal_cache_total_blocks());
+  }
+  if (from._internal_icache_inodes() != 0) {
+    _this->_internal_set_icache_inodes(from._internal_icache_inodes());
+  }
+  if (from._internal_icache_hits() != 0) {
+    _this->_internal_set_icache_hits(from._internal_icache_hits());
+  }
+  if (from._internal_icache_misses() != 0) {
+    _this->_internal_set_icache_misses(from._internal_icache_misses());
+  }
+  if (from._internal_icache_writebacks() != 0) {
+    _this->_internal_set_icache_writebacks(from._internal_icache_writebacks());
+  }
+  if (from._internal_dentries() != 0) {
+    _this->_internal_set_dentries(from._internal_dentries());
+  }
+  if (from._internal_dentry_hits() != 0) {
+    _this->_internal_set_dentry_hits(from._internal_dentry_hits());
+  }
+  if (from._internal_dentry_misses() != 0) {
+    _this->_internal_set_dentry_misses(from._internal_dentry_misses());
+  }
+  if (from._internal_path_hits() != 0) {
+    _this->_internal_set_path_hits(from._internal_path_hits());
+  }
+  if (from._internal_cache_enabled() != 0) {
+    _this->_internal_set_cache_enabled(from._internal_cache_enabled());
+  }
+  if (from._internal_cache_shared() != 0) {
+    _this->_internal_set_cache_shared(from._internal_cache_shared());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MountStatsResponse::CopyFrom(const MountStatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.MountStatsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MountStatsResponse::IsInitialized() const {
+  return true;
+}
+
+void MountStatsResponse::InternalSwap(MountStatsResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.block_classes_.InternalSwap(&other->_impl_.block_classes_);
+  _impl_.hit_rate_curve_.InternalSwap(&other->_impl_.hit_rate_curve_);
+  _impl_.disk_.InternalSwap(&other->_impl_.disk_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cache_policy_, lhs_arena,
+      &other->_impl_.cache_policy_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.io_engine_, lhs_arena,
+      &other->_impl_.io_engine_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MountStatsResponse, _impl_.cache_shared_)
+      + sizeof(MountStatsResponse::_impl_.cache_shared_)
+      - PROTOBUF_FIELD_OFFSET(MountStatsResponse, _impl_.cache_miss_)>(
+          reinterpret_cast<char*>(&_impl_.cache_miss_),
+          reinterpret_cast<char*>(&other->_impl_.cache_miss_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MountStatsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_filesystem_2eproto_getter, &descriptor_table_filesystem_2eproto_once,
+      file_level_metadata_filesystem_2eproto[21]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace fs
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::fs::MountRequest*
+Arena::CreateMaybeMessage< ::fs::MountRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::MountRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::MountResponse*
+Arena::CreateMaybeMessage< ::fs::MountResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::MountResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::FileRequest*
+Arena::CreateMaybeMessage< ::fs::FileRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::FileRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CreateResponse*
+Arena::CreateMaybeMessage< ::fs::CreateResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CreateResponse >(arena);
 }
 template<> PROTOBUF_NOINLINE ::fs::MkdirResponse*
 Arena::CreateMaybeMessage< ::fs::MkdirResponse >(Arena* arena) {
@@ -3835,6 +7102,38 @@ template<> PROTOBUF_NOINLINE ::fs::RemoveResponse*
 Arena::CreateMaybeMessage< ::fs::RemoveResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fs::RemoveResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::fs::FdRequest*
+Arena::CreateMaybeMessage< ::fs::FdRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::FdRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CloseResponse*
+Arena::CreateMaybeMessage< ::fs::CloseResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CloseResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::FsyncResponse*
+Arena::CreateMaybeMessage< ::fs::FsyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::FsyncResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::MountStatsRequest*
+Arena::CreateMaybeMessage< ::fs::MountStatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::MountStatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::BlockClassStats*
+Arena::CreateMaybeMessage< ::fs::BlockClassStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::BlockClassStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::LatencyStats*
+Arena::CreateMaybeMessage< ::fs::LatencyStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::LatencyStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::HitRatePoint*
+Arena::CreateMaybeMessage< ::fs::HitRatePoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::HitRatePoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::MountStatsResponse*
+Arena::CreateMaybeMessage< ::fs::MountStatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::MountStatsResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -45,12 +45,30 @@ struct TableStruct_filesystem_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_filesystem_2eproto;
 namespace fs {
+class BlockClassStats;
+struct BlockClassStatsDefaultTypeInternal;
+extern BlockClassStatsDefaultTypeInternal _BlockClassStats_default_instance_;
+class CloseResponse;
+struct CloseResponseDefaultTypeInternal;
+extern CloseResponseDefaultTypeInternal _CloseResponse_default_instance_;
 class CreateResponse;
 struct CreateResponseDefaultTypeInternal;
 extern CreateResponseDefaultTypeInternal _CreateResponse_default_instance_;
+class FdRequest;
+struct FdRequestDefaultTypeInternal;
+extern FdRequestDefaultTypeInternal _FdRequest_default_instance_;
 class FileRequest;
 struct FileRequestDefaultTypeInternal;
 extern FileRequestDefaultTypeInternal _FileRequest_default_instance_;
+class FsyncResponse;
+struct FsyncResponseDefaultTypeInternal;
+extern FsyncResponseDefaultTypeInternal _FsyncResponse_default_instance_;
+class HitRatePoint;
+struct HitRatePointDefaultTypeInternal;
+extern HitRatePointDefaultTypeInternal _HitRatePoint_default_instance_;
+class LatencyStats;
+struct LatencyStatsDefaultTypeInternal;
+extern LatencyStatsDefaultTypeInternal _LatencyStats_default_instance_;
 class ListdirResponse;
 struct ListdirResponseDefaultTypeInternal;
 extern ListdirResponseDefaultTypeInternal _ListdirResponse_default_instance_;
@@ -63,6 +81,12 @@ extern MountRequestDefaultTypeInternal _MountRequest_default_instance_;
 class MountResponse;
 struct MountResponseDefaultTypeInternal;
 extern MountResponseDefaultTypeInternal _MountResponse_default_instance_;
+class MountStatsRequest;
+struct MountStatsRequestDefaultTypeInternal;
+extern MountStatsRequestDefaultTypeInternal _MountStatsRequest_default_instance_;
+class MountStatsResponse;
+struct MountStatsResponseDefaultTypeInternal;
+extern MountStatsResponseDefaultTypeInternal _MountStatsResponse_default_instance_;
 class OpenResponse;
 struct OpenResponseDefaultTypeInternal;
 extern OpenResponseDefaultTypeInternal _OpenResponse_default_instance_;
@@ -89,12 +113,20 @@ struct WriteResponseDefaultTypeInternal;
 extern WriteResponseDefaultTypeInternal _WriteResponse_default_instance_;
 }  // namespace fs
 PROTOBUF_NAMESPACE_OPEN
+template<> ::fs::BlockClassStats* Arena::CreateMaybeMessage<::fs::BlockClassStats>(Arena*);
+template<> ::fs::CloseResponse* Arena::CreateMaybeMessage<::fs::CloseResponse>(Arena*);
 template<> ::fs::CreateResponse* Arena::CreateMaybeMessage<::fs::CreateResponse>(Arena*);
+template<> ::fs::FdRequest* Arena::CreateMaybeMessage<::fs::FdRequest>(Arena*);
 template<> ::fs::FileRequest* Arena::CreateMaybeMessage<::fs::FileRequest>(Arena*);
+template<> ::fs::FsyncResponse* Arena::CreateMaybeMessage<::fs::FsyncResponse>(Arena*);
+template<> ::fs::HitRatePoint* Arena::CreateMaybeMessage<::fs::HitRatePoint>(Arena*);
+template<> ::fs::LatencyStats* Arena::CreateMaybeMessage<::fs::LatencyStats>(Arena*);
 template<> ::fs::ListdirResponse* Arena::CreateMaybeMessage<::fs::ListdirResponse>(Arena*);
 template<> ::fs::MkdirResponse* Arena::CreateMaybeMessage<::fs::MkdirResponse>(Arena*);
 template<> ::fs::MountRequest* Arena::CreateMaybeMessage<::fs::MountRequest>(Arena*);
 template<> ::fs::MountResponse* Arena::CreateMaybeMessage<::fs::MountResponse>(Arena*);
+template<> ::fs::MountStatsRequest* Arena::CreateMaybeMessage<::fs::MountStatsRequest>(Arena*);
+template<> ::fs::MountStatsResponse* Arena::CreateMaybeMessage<::fs::MountStatsResponse>(Arena*);
 template<> ::fs::OpenResponse* Arena::CreateMaybeMessage<::fs::OpenResponse>(Arena*);
 template<> ::fs::ReadRequestMulti* Arena::CreateMaybeMessage<::fs::ReadRequestMulti>(Arena*);
 template<> ::fs::ReadResponse* Arena::CreateMaybeMessage<::fs::ReadResponse>(Arena*);
@@ -230,8 +262,16 @@ class MountRequest final :
 
   enum : int {
     kDiskImageFieldNumber = 1,
-    kEnableCacheFieldNumber = 2,
+    kIoEngineFieldNumber = 4,
+    kCachePolicyFieldNumber = 10,
     kCacheBlocksFieldNumber = 3,
+    kEnableCacheFieldNumber = 2,
+    kDirectIoFieldNumber = 5,
+    kMmapIoFieldNumber = 6,
+    kPreallocateFieldNumber = 9,
+    kNumBlocksFieldNumber = 7,
+    kNumInodesFieldNumber = 8,
+    kCacheReservedBlocksFieldNumber = 11,
   };
   // string disk_image = 1;
   void clear_disk_image();
@@ -247,13 +287,32 @@ class MountRequest final :
   std::string* _internal_mutable_disk_image();
   public:
 
-  // bool enable_cache = 2;
-  void clear_enable_cache();
-  bool enable_cache() const;
-  void set_enable_cache(bool value);
+  // string io_engine = 4;
+  void clear_io_engine();
+  const std::string& io_engine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_io_engine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_io_engine();
+  PROTOBUF_NODISCARD std::string* release_io_engine();
+  void set_allocated_io_engine(std::string* io_engine);
   private:
-  bool _internal_enable_cache() const;
-  void _internal_set_enable_cache(bool value);
+  const std::string& _internal_io_engine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_io_engine(const std::string& value);
+  std::string* _internal_mutable_io_engine();
+  public:
+
+  // string cache_policy = 10;
+  void clear_cache_policy();
+  const std::string& cache_policy() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_policy(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_policy();
+  PROTOBUF_NODISCARD std::string* release_cache_policy();
+  void set_allocated_cache_policy(std::string* cache_policy);
+  private:
+  const std::string& _internal_cache_policy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_policy(const std::string& value);
+  std::string* _internal_mutable_cache_policy();
   public:
 
   // int32 cache_blocks = 3;
@@ -265,6 +324,69 @@ class MountRequest final :
   void _internal_set_cache_blocks(int32_t value);
   public:
 
+  // bool enable_cache = 2;
+  void clear_enable_cache();
+  bool enable_cache() const;
+  void set_enable_cache(bool value);
+  private:
+  bool _internal_enable_cache() const;
+  void _internal_set_enable_cache(bool value);
+  public:
+
+  // bool direct_io = 5;
+  void clear_direct_io();
+  bool direct_io() const;
+  void set_direct_io(bool value);
+  private:
+  bool _internal_direct_io() const;
+  void _internal_set_direct_io(bool value);
+  public:
+
+  // bool mmap_io = 6;
+  void clear_mmap_io();
+  bool mmap_io() const;
+  void set_mmap_io(bool value);
+  private:
+  bool _internal_mmap_io() const;
+  void _internal_set_mmap_io(bool value);
+  public:
+
+  // bool preallocate = 9;
+  void clear_preallocate();
+  bool preallocate() const;
+  void set_preallocate(bool value);
+  private:
+  bool _internal_preallocate() const;
+  void _internal_set_preallocate(bool value);
+  public:
+
+  // uint64 num_blocks = 7;
+  void clear_num_blocks();
+  uint64_t num_blocks() const;
+  void set_num_blocks(uint64_t value);
+  private:
+  uint64_t _internal_num_blocks() const;
+  void _internal_set_num_blocks(uint64_t value);
+  public:
+
+  // uint64 num_inodes = 8;
+  void clear_num_inodes();
+  uint64_t num_inodes() const;
+  void set_num_inodes(uint64_t value);
+  private:
+  uint64_t _internal_num_inodes() const;
+  void _internal_set_num_inodes(uint64_t value);
+  public:
+
+  // uint64 cache_reserved_blocks = 11;
+  void clear_cache_reserved_blocks();
+  uint64_t cache_reserved_blocks() const;
+  void set_cache_reserved_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cache_reserved_blocks() const;
+  void _internal_set_cache_reserved_blocks(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:fs.MountRequest)
  private:
   class _Internal;
@@ -274,8 +396,16 @@ class MountRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr disk_image_;
-    bool enable_cache_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr io_engine_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_policy_;
     int32_t cache_blocks_;
+    bool enable_cache_;
+    bool direct_io_;
+    bool mmap_io_;
+    bool preallocate_;
+    uint64_t num_blocks_;
+    uint64_t num_inodes_;
+    uint64_t cache_reserved_blocks_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2467,167 +2597,2872 @@ class RemoveResponse final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_filesystem_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class FdRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.FdRequest) */ {
+ public:
+  inline FdRequest() : FdRequest(nullptr) {}
+  ~FdRequest() override;
+  explicit PROTOBUF_CONSTEXPR FdRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  FdRequest(const FdRequest& from);
+  FdRequest(FdRequest&& from) noexcept
+    : FdRequest() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// MountRequest
+  inline FdRequest& operator=(const FdRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FdRequest& operator=(FdRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string disk_image = 1;
-inline void MountRequest::clear_disk_image() {
-  _impl_.disk_image_.ClearToEmpty();
-}
-inline const std::string& MountRequest::disk_image() const {
-  // @@protoc_insertion_point(field_get:fs.MountRequest.disk_image)
-  return _internal_disk_image();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void MountRequest::set_disk_image(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.disk_image_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.MountRequest.disk_image)
-}
-inline std::string* MountRequest::mutable_disk_image() {
-  std::string* _s = _internal_mutable_disk_image();
-  // @@protoc_insertion_point(field_mutable:fs.MountRequest.disk_image)
-  return _s;
-}
-inline const std::string& MountRequest::_internal_disk_image() const {
-  return _impl_.disk_image_.Get();
-}
-inline void MountRequest::_internal_set_disk_image(const std::string& value) {
-  
-  _impl_.disk_image_.Set(value, GetArenaForAllocation());
-}
-inline std::string* MountRequest::_internal_mutable_disk_image() {
-  
-  return _impl_.disk_image_.Mutable(GetArenaForAllocation());
-}
-inline std::string* MountRequest::release_disk_image() {
-  // @@protoc_insertion_point(field_release:fs.MountRequest.disk_image)
-  return _impl_.disk_image_.Release();
-}
-inline void MountRequest::set_allocated_disk_image(std::string* disk_image) {
-  if (disk_image != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.disk_image_.SetAllocated(disk_image, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.disk_image_.IsDefault()) {
-    _impl_.disk_image_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.MountRequest.disk_image)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FdRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FdRequest* internal_default_instance() {
+    return reinterpret_cast<const FdRequest*>(
+               &_FdRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-// bool enable_cache = 2;
-inline void MountRequest::clear_enable_cache() {
-  _impl_.enable_cache_ = false;
-}
-inline bool MountRequest::_internal_enable_cache() const {
-  return _impl_.enable_cache_;
-}
-inline bool MountRequest::enable_cache() const {
-  // @@protoc_insertion_point(field_get:fs.MountRequest.enable_cache)
-  return _internal_enable_cache();
-}
-inline void MountRequest::_internal_set_enable_cache(bool value) {
-  
-  _impl_.enable_cache_ = value;
-}
-inline void MountRequest::set_enable_cache(bool value) {
-  _internal_set_enable_cache(value);
-  // @@protoc_insertion_point(field_set:fs.MountRequest.enable_cache)
-}
+  friend void swap(FdRequest& a, FdRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FdRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FdRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// int32 cache_blocks = 3;
-inline void MountRequest::clear_cache_blocks() {
-  _impl_.cache_blocks_ = 0;
-}
-inline int32_t MountRequest::_internal_cache_blocks() const {
-  return _impl_.cache_blocks_;
-}
-inline int32_t MountRequest::cache_blocks() const {
-  // @@protoc_insertion_point(field_get:fs.MountRequest.cache_blocks)
-  return _internal_cache_blocks();
-}
-inline void MountRequest::_internal_set_cache_blocks(int32_t value) {
-  
-  _impl_.cache_blocks_ = value;
-}
-inline void MountRequest::set_cache_blocks(int32_t value) {
-  _internal_set_cache_blocks(value);
-  // @@protoc_insertion_point(field_set:fs.MountRequest.cache_blocks)
-}
+  // implements Message ----------------------------------------------
 
-// -------------------------------------------------------------------
+  FdRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FdRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FdRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FdRequest& from) {
+    FdRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// MountResponse
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// int32 mount_id = 1;
-inline void MountResponse::clear_mount_id() {
-  _impl_.mount_id_ = 0;
-}
-inline int32_t MountResponse::_internal_mount_id() const {
-  return _impl_.mount_id_;
-}
-inline int32_t MountResponse::mount_id() const {
-  // @@protoc_insertion_point(field_get:fs.MountResponse.mount_id)
-  return _internal_mount_id();
-}
-inline void MountResponse::_internal_set_mount_id(int32_t value) {
-  
-  _impl_.mount_id_ = value;
-}
-inline void MountResponse::set_mount_id(int32_t value) {
-  _internal_set_mount_id(value);
-  // @@protoc_insertion_point(field_set:fs.MountResponse.mount_id)
-}
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FdRequest* other);
 
-// string error = 2;
-inline void MountResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
-}
-inline const std::string& MountResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.MountResponse.error)
-  return _internal_error();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void MountResponse::set_error(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.MountResponse.error)
-}
-inline std::string* MountResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.MountResponse.error)
-  return _s;
-}
-inline const std::string& MountResponse::_internal_error() const {
-  return _impl_.error_.Get();
-}
-inline void MountResponse::_internal_set_error(const std::string& value) {
-  
-  _impl_.error_.Set(value, GetArenaForAllocation());
-}
-inline std::string* MountResponse::_internal_mutable_error() {
-  
-  return _impl_.error_.Mutable(GetArenaForAllocation());
-}
-inline std::string* MountResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.MountResponse.error)
-  return _impl_.error_.Release();
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.FdRequest";
+  }
+  protected:
+  explicit FdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMountIdFieldNumber = 1,
+    kFdFieldNumber = 2,
+  };
+  // int32 mount_id = 1;
+  void clear_mount_id();
+  int32_t mount_id() const;
+  void set_mount_id(int32_t value);
+  private:
+  int32_t _internal_mount_id() const;
+  void _internal_set_mount_id(int32_t value);
+  public:
+
+  // int32 fd = 2;
+  void clear_fd();
+  int32_t fd() const;
+  void set_fd(int32_t value);
+  private:
+  int32_t _internal_fd() const;
+  void _internal_set_fd(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.FdRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t mount_id_;
+    int32_t fd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CloseResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CloseResponse) */ {
+ public:
+  inline CloseResponse() : CloseResponse(nullptr) {}
+  ~CloseResponse() override;
+  explicit PROTOBUF_CONSTEXPR CloseResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CloseResponse(const CloseResponse& from);
+  CloseResponse(CloseResponse&& from) noexcept
+    : CloseResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CloseResponse& operator=(const CloseResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CloseResponse& operator=(CloseResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CloseResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CloseResponse* internal_default_instance() {
+    return reinterpret_cast<const CloseResponse*>(
+               &_CloseResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CloseResponse& a, CloseResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CloseResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CloseResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CloseResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CloseResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CloseResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CloseResponse& from) {
+    CloseResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CloseResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.CloseResponse";
+  }
+  protected:
+  explicit CloseResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string error = 2;
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CloseResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FsyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.FsyncResponse) */ {
+ public:
+  inline FsyncResponse() : FsyncResponse(nullptr) {}
+  ~FsyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR FsyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FsyncResponse(const FsyncResponse& from);
+  FsyncResponse(FsyncResponse&& from) noexcept
+    : FsyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FsyncResponse& operator=(const FsyncResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FsyncResponse& operator=(FsyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FsyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FsyncResponse* internal_default_instance() {
+    return reinterpret_cast<const FsyncResponse*>(
+               &_FsyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(FsyncResponse& a, FsyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FsyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FsyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FsyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FsyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FsyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FsyncResponse& from) {
+    FsyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FsyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.FsyncResponse";
+  }
+  protected:
+  explicit FsyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string error = 2;
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.FsyncResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MountStatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.MountStatsRequest) */ {
+ public:
+  inline MountStatsRequest() : MountStatsRequest(nullptr) {}
+  ~MountStatsRequest() override;
+  explicit PROTOBUF_CONSTEXPR MountStatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MountStatsRequest(const MountStatsRequest& from);
+  MountStatsRequest(MountStatsRequest&& from) noexcept
+    : MountStatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MountStatsRequest& operator=(const MountStatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MountStatsRequest& operator=(MountStatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MountStatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MountStatsRequest* internal_default_instance() {
+    return reinterpret_cast<const MountStatsRequest*>(
+               &_MountStatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(MountStatsRequest& a, MountStatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MountStatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MountStatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MountStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MountStatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MountStatsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MountStatsRequest& from) {
+    MountStatsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MountStatsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.MountStatsRequest";
+  }
+  protected:
+  explicit MountStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMountIdFieldNumber = 1,
+  };
+  // int32 mount_id = 1;
+  void clear_mount_id();
+  int32_t mount_id() const;
+  void set_mount_id(int32_t value);
+  private:
+  int32_t _internal_mount_id() const;
+  void _internal_set_mount_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.MountStatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t mount_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BlockClassStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BlockClassStats) */ {
+ public:
+  inline BlockClassStats() : BlockClassStats(nullptr) {}
+  ~BlockClassStats() override;
+  explicit PROTOBUF_CONSTEXPR BlockClassStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BlockClassStats(const BlockClassStats& from);
+  BlockClassStats(BlockClassStats&& from) noexcept
+    : BlockClassStats() {
+    *this = ::std::move(from);
+  }
+
+  inline BlockClassStats& operator=(const BlockClassStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BlockClassStats& operator=(BlockClassStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BlockClassStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockClassStats* internal_default_instance() {
+    return reinterpret_cast<const BlockClassStats*>(
+               &_BlockClassStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(BlockClassStats& a, BlockClassStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BlockClassStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockClassStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BlockClassStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockClassStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockClassStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockClassStats& from) {
+    BlockClassStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BlockClassStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.BlockClassStats";
+  }
+  protected:
+  explicit BlockClassStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlockClassFieldNumber = 1,
+    kHitsFieldNumber = 2,
+    kMissesFieldNumber = 3,
+    kEvictionsFieldNumber = 4,
+    kWritebacksFieldNumber = 5,
+  };
+  // string block_class = 1;
+  void clear_block_class();
+  const std::string& block_class() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_block_class(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_block_class();
+  PROTOBUF_NODISCARD std::string* release_block_class();
+  void set_allocated_block_class(std::string* block_class);
+  private:
+  const std::string& _internal_block_class() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_block_class(const std::string& value);
+  std::string* _internal_mutable_block_class();
+  public:
+
+  // uint64 hits = 2;
+  void clear_hits();
+  uint64_t hits() const;
+  void set_hits(uint64_t value);
+  private:
+  uint64_t _internal_hits() const;
+  void _internal_set_hits(uint64_t value);
+  public:
+
+  // uint64 misses = 3;
+  void clear_misses();
+  uint64_t misses() const;
+  void set_misses(uint64_t value);
+  private:
+  uint64_t _internal_misses() const;
+  void _internal_set_misses(uint64_t value);
+  public:
+
+  // uint64 evictions = 4;
+  void clear_evictions();
+  uint64_t evictions() const;
+  void set_evictions(uint64_t value);
+  private:
+  uint64_t _internal_evictions() const;
+  void _internal_set_evictions(uint64_t value);
+  public:
+
+  // uint64 writebacks = 5;
+  void clear_writebacks();
+  uint64_t writebacks() const;
+  void set_writebacks(uint64_t value);
+  private:
+  uint64_t _internal_writebacks() const;
+  void _internal_set_writebacks(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.BlockClassStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr block_class_;
+    uint64_t hits_;
+    uint64_t misses_;
+    uint64_t evictions_;
+    uint64_t writebacks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.LatencyStats) */ {
+ public:
+  inline LatencyStats() : LatencyStats(nullptr) {}
+  ~LatencyStats() override;
+  explicit PROTOBUF_CONSTEXPR LatencyStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyStats(const LatencyStats& from);
+  LatencyStats(LatencyStats&& from) noexcept
+    : LatencyStats() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyStats& operator=(const LatencyStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyStats& operator=(LatencyStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyStats* internal_default_instance() {
+    return reinterpret_cast<const LatencyStats*>(
+               &_LatencyStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(LatencyStats& a, LatencyStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyStats& from) {
+    LatencyStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.LatencyStats";
+  }
+  protected:
+  explicit LatencyStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kBlocksFieldNumber = 3,
+    kErrorsFieldNumber = 4,
+    kMeanUsFieldNumber = 5,
+    kP50UsFieldNumber = 6,
+    kP99UsFieldNumber = 7,
+    kMaxUsFieldNumber = 8,
+  };
+  // string op = 1;
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 blocks = 3;
+  void clear_blocks();
+  uint64_t blocks() const;
+  void set_blocks(uint64_t value);
+  private:
+  uint64_t _internal_blocks() const;
+  void _internal_set_blocks(uint64_t value);
+  public:
+
+  // uint64 errors = 4;
+  void clear_errors();
+  uint64_t errors() const;
+  void set_errors(uint64_t value);
+  private:
+  uint64_t _internal_errors() const;
+  void _internal_set_errors(uint64_t value);
+  public:
+
+  // double mean_us = 5;
+  void clear_mean_us();
+  double mean_us() const;
+  void set_mean_us(double value);
+  private:
+  double _internal_mean_us() const;
+  void _internal_set_mean_us(double value);
+  public:
+
+  // uint64 p50_us = 6;
+  void clear_p50_us();
+  uint64_t p50_us() const;
+  void set_p50_us(uint64_t value);
+  private:
+  uint64_t _internal_p50_us() const;
+  void _internal_set_p50_us(uint64_t value);
+  public:
+
+  // uint64 p99_us = 7;
+  void clear_p99_us();
+  uint64_t p99_us() const;
+  void set_p99_us(uint64_t value);
+  private:
+  uint64_t _internal_p99_us() const;
+  void _internal_set_p99_us(uint64_t value);
+  public:
+
+  // uint64 max_us = 8;
+  void clear_max_us();
+  uint64_t max_us() const;
+  void set_max_us(uint64_t value);
+  private:
+  uint64_t _internal_max_us() const;
+  void _internal_set_max_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.LatencyStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    uint64_t count_;
+    uint64_t blocks_;
+    uint64_t errors_;
+    double mean_us_;
+    uint64_t p50_us_;
+    uint64_t p99_us_;
+    uint64_t max_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HitRatePoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HitRatePoint) */ {
+ public:
+  inline HitRatePoint() : HitRatePoint(nullptr) {}
+  ~HitRatePoint() override;
+  explicit PROTOBUF_CONSTEXPR HitRatePoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HitRatePoint(const HitRatePoint& from);
+  HitRatePoint(HitRatePoint&& from) noexcept
+    : HitRatePoint() {
+    *this = ::std::move(from);
+  }
+
+  inline HitRatePoint& operator=(const HitRatePoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HitRatePoint& operator=(HitRatePoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HitRatePoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HitRatePoint* internal_default_instance() {
+    return reinterpret_cast<const HitRatePoint*>(
+               &_HitRatePoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(HitRatePoint& a, HitRatePoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HitRatePoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HitRatePoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HitRatePoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HitRatePoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HitRatePoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HitRatePoint& from) {
+    HitRatePoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HitRatePoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.HitRatePoint";
+  }
+  protected:
+  explicit HitRatePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCacheBlocksFieldNumber = 1,
+    kHitRateFieldNumber = 2,
+  };
+  // uint64 cache_blocks = 1;
+  void clear_cache_blocks();
+  uint64_t cache_blocks() const;
+  void set_cache_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cache_blocks() const;
+  void _internal_set_cache_blocks(uint64_t value);
+  public:
+
+  // double hit_rate = 2;
+  void clear_hit_rate();
+  double hit_rate() const;
+  void set_hit_rate(double value);
+  private:
+  double _internal_hit_rate() const;
+  void _internal_set_hit_rate(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.HitRatePoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t cache_blocks_;
+    double hit_rate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MountStatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.MountStatsResponse) */ {
+ public:
+  inline MountStatsResponse() : MountStatsResponse(nullptr) {}
+  ~MountStatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR MountStatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MountStatsResponse(const MountStatsResponse& from);
+  MountStatsResponse(MountStatsResponse&& from) noexcept
+    : MountStatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MountStatsResponse& operator=(const MountStatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MountStatsResponse& operator=(MountStatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MountStatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MountStatsResponse* internal_default_instance() {
+    return reinterpret_cast<const MountStatsResponse*>(
+               &_MountStatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(MountStatsResponse& a, MountStatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MountStatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MountStatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MountStatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MountStatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MountStatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MountStatsResponse& from) {
+    MountStatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MountStatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.MountStatsResponse";
+  }
+  protected:
+  explicit MountStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlockClassesFieldNumber = 8,
+    kHitRateCurveFieldNumber = 12,
+    kDiskFieldNumber = 13,
+    kErrorFieldNumber = 1,
+    kCachePolicyFieldNumber = 3,
+    kIoEngineFieldNumber = 14,
+    kCacheMissFieldNumber = 11,
+    kCacheCapacityFieldNumber = 4,
+    kCachedBlocksFieldNumber = 5,
+    kMetadataBlocksFieldNumber = 6,
+    kDirtyBlocksFieldNumber = 7,
+    kPrefetchedFieldNumber = 9,
+    kPrefetchHitsFieldNumber = 10,
+    kCacheQuotaBlocksFieldNumber = 16,
+    kCacheReservedBlocksFieldNumber = 17,
+    kCacheTotalBlocksFieldNumber = 18,
+    kIcacheInodesFieldNumber = 19,
+    kIcacheHitsFieldNumber = 20,
+    kIcacheMissesFieldNumber = 21,
+    kIcacheWritebacksFieldNumber = 22,
+    kDentriesFieldNumber = 23,
+    kDentryHitsFieldNumber = 24,
+    kDentryMissesFieldNumber = 25,
+    kPathHitsFieldNumber = 26,
+    kCacheEnabledFieldNumber = 2,
+    kCacheSharedFieldNumber = 15,
+  };
+  // repeated .fs.BlockClassStats block_classes = 8;
+  int block_classes_size() const;
+  private:
+  int _internal_block_classes_size() const;
+  public:
+  void clear_block_classes();
+  ::fs::BlockClassStats* mutable_block_classes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::BlockClassStats >*
+      mutable_block_classes();
+  private:
+  const ::fs::BlockClassStats& _internal_block_classes(int index) const;
+  ::fs::BlockClassStats* _internal_add_block_classes();
+  public:
+  const ::fs::BlockClassStats& block_classes(int index) const;
+  ::fs::BlockClassStats* add_block_classes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::BlockClassStats >&
+      block_classes() const;
+
+  // repeated .fs.HitRatePoint hit_rate_curve = 12;
+  int hit_rate_curve_size() const;
+  private:
+  int _internal_hit_rate_curve_size() const;
+  public:
+  void clear_hit_rate_curve();
+  ::fs::HitRatePoint* mutable_hit_rate_curve(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::HitRatePoint >*
+      mutable_hit_rate_curve();
+  private:
+  const ::fs::HitRatePoint& _internal_hit_rate_curve(int index) const;
+  ::fs::HitRatePoint* _internal_add_hit_rate_curve();
+  public:
+  const ::fs::HitRatePoint& hit_rate_curve(int index) const;
+  ::fs::HitRatePoint* add_hit_rate_curve();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::HitRatePoint >&
+      hit_rate_curve() const;
+
+  // repeated .fs.LatencyStats disk = 13;
+  int disk_size() const;
+  private:
+  int _internal_disk_size() const;
+  public:
+  void clear_disk();
+  ::fs::LatencyStats* mutable_disk(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::LatencyStats >*
+      mutable_disk();
+  private:
+  const ::fs::LatencyStats& _internal_disk(int index) const;
+  ::fs::LatencyStats* _internal_add_disk();
+  public:
+  const ::fs::LatencyStats& disk(int index) const;
+  ::fs::LatencyStats* add_disk();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::LatencyStats >&
+      disk() const;
+
+  // string error = 1;
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // string cache_policy = 3;
+  void clear_cache_policy();
+  const std::string& cache_policy() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cache_policy(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cache_policy();
+  PROTOBUF_NODISCARD std::string* release_cache_policy();
+  void set_allocated_cache_policy(std::string* cache_policy);
+  private:
+  const std::string& _internal_cache_policy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cache_policy(const std::string& value);
+  std::string* _internal_mutable_cache_policy();
+  public:
+
+  // string io_engine = 14;
+  void clear_io_engine();
+  const std::string& io_engine() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_io_engine(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_io_engine();
+  PROTOBUF_NODISCARD std::string* release_io_engine();
+  void set_allocated_io_engine(std::string* io_engine);
+  private:
+  const std::string& _internal_io_engine() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_io_engine(const std::string& value);
+  std::string* _internal_mutable_io_engine();
+  public:
+
+  // .fs.LatencyStats cache_miss = 11;
+  bool has_cache_miss() const;
+  private:
+  bool _internal_has_cache_miss() const;
+  public:
+  void clear_cache_miss();
+  const ::fs::LatencyStats& cache_miss() const;
+  PROTOBUF_NODISCARD ::fs::LatencyStats* release_cache_miss();
+  ::fs::LatencyStats* mutable_cache_miss();
+  void set_allocated_cache_miss(::fs::LatencyStats* cache_miss);
+  private:
+  const ::fs::LatencyStats& _internal_cache_miss() const;
+  ::fs::LatencyStats* _internal_mutable_cache_miss();
+  public:
+  void unsafe_arena_set_allocated_cache_miss(
+      ::fs::LatencyStats* cache_miss);
+  ::fs::LatencyStats* unsafe_arena_release_cache_miss();
+
+  // uint64 cache_capacity = 4;
+  void clear_cache_capacity();
+  uint64_t cache_capacity() const;
+  void set_cache_capacity(uint64_t value);
+  private:
+  uint64_t _internal_cache_capacity() const;
+  void _internal_set_cache_capacity(uint64_t value);
+  public:
+
+  // uint64 cached_blocks = 5;
+  void clear_cached_blocks();
+  uint64_t cached_blocks() const;
+  void set_cached_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cached_blocks() const;
+  void _internal_set_cached_blocks(uint64_t value);
+  public:
+
+  // uint64 metadata_blocks = 6;
+  void clear_metadata_blocks();
+  uint64_t metadata_blocks() const;
+  void set_metadata_blocks(uint64_t value);
+  private:
+  uint64_t _internal_metadata_blocks() const;
+  void _internal_set_metadata_blocks(uint64_t value);
+  public:
+
+  // uint64 dirty_blocks = 7;
+  void clear_dirty_blocks();
+  uint64_t dirty_blocks() const;
+  void set_dirty_blocks(uint64_t value);
+  private:
+  uint64_t _internal_dirty_blocks() const;
+  void _internal_set_dirty_blocks(uint64_t value);
+  public:
+
+  // uint64 prefetched = 9;
+  void clear_prefetched();
+  uint64_t prefetched() const;
+  void set_prefetched(uint64_t value);
+  private:
+  uint64_t _internal_prefetched() const;
+  void _internal_set_prefetched(uint64_t value);
+  public:
+
+  // uint64 prefetch_hits = 10;
+  void clear_prefetch_hits();
+  uint64_t prefetch_hits() const;
+  void set_prefetch_hits(uint64_t value);
+  private:
+  uint64_t _internal_prefetch_hits() const;
+  void _internal_set_prefetch_hits(uint64_t value);
+  public:
+
+  // uint64 cache_quota_blocks = 16;
+  void clear_cache_quota_blocks();
+  uint64_t cache_quota_blocks() const;
+  void set_cache_quota_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cache_quota_blocks() const;
+  void _internal_set_cache_quota_blocks(uint64_t value);
+  public:
+
+  // uint64 cache_reserved_blocks = 17;
+  void clear_cache_reserved_blocks();
+  uint64_t cache_reserved_blocks() const;
+  void set_cache_reserved_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cache_reserved_blocks() const;
+  void _internal_set_cache_reserved_blocks(uint64_t value);
+  public:
+
+  // uint64 cache_total_blocks = 18;
+  void clear_cache_total_blocks();
+  uint64_t cache_total_blocks() const;
+  void set_cache_total_blocks(uint64_t value);
+  private:
+  uint64_t _internal_cache_total_blocks() const;
+  void _internal_set_cache_total_blocks(uint64_t value);
+  public:
+
+  // uint64 icache_inodes = 19;
+  void clear_icache_inodes();
+  uint64_t icache_inodes() const;
+  void set_icache_inodes(uint64_t value);
+  private:
+  uint64_t _internal_icache_inodes() const;
+  void _internal_set_icache_inodes(uint64_t value);
+  public:
+
+  // uint64 icache_hits = 20;
+  void clear_icache_hits();
+  uint64_t icache_hits() const;
+  void set_icache_hits(uint64_t value);
+  private:
+  uint64_t _internal_icache_hits() const;
+  void _internal_set_icache_hits(uint64_t value);
+  public:
+
+  // uint64 icache_misses = 21;
+  void clear_icache_misses();
+  uint64_t icache_misses() const;
+  void set_icache_misses(uint64_t value);
+  private:
+  uint64_t _internal_icache_misses() const;
+  void _internal_set_icache_misses(uint64_t value);
+  public:
+
+  // uint64 icache_writebacks = 22;
+  void clear_icache_writebacks();
+  uint64_t icache_writebacks() const;
+  void set_icache_writebacks(uint64_t value);
+  private:
+  uint64_t _internal_icache_writebacks() const;
+  void _internal_set_icache_writebacks(uint64_t value);
+  public:
+
+  // uint64 dentries = 23;
+  void clear_dentries();
+  uint64_t dentries() const;
+  void set_dentries(uint64_t value);
+  private:
+  uint64_t _internal_dentries() const;
+  void _internal_set_dentries(uint64_t value);
+  public:
+
+  // uint64 dentry_hits = 24;
+  void clear_dentry_hits();
+  uint64_t dentry_hits() const;
+  void set_dentry_hits(uint64_t value);
+  private:
+  uint64_t _internal_dentry_hits() const;
+  void _internal_set_dentry_hits(uint64_t value);
+  public:
+
+  // uint64 dentry_misses = 25;
+  void clear_dentry_misses();
+  uint64_t dentry_misses() const;
+  void set_dentry_misses(uint64_t value);
+  private:
+  uint64_t _internal_dentry_misses() const;
+  void _internal_set_dentry_misses(uint64_t value);
+  public:
+
+  // uint64 path_hits = 26;
+  void clear_path_hits();
+  uint64_t path_hits() const;
+  void set_path_hits(uint64_t value);
+  private:
+  uint64_t _internal_path_hits() const;
+  void _internal_set_path_hits(uint64_t value);
+  public:
+
+  // bool cache_enabled = 2;
+  void clear_cache_enabled();
+  bool cache_enabled() const;
+  void set_cache_enabled(bool value);
+  private:
+  bool _internal_cache_enabled() const;
+  void _internal_set_cache_enabled(bool value);
+  public:
+
+  // bool cache_shared = 15;
+  void clear_cache_shared();
+  bool cache_shared() const;
+  void set_cache_shared(bool value);
+  private:
+  bool _internal_cache_shared() const;
+  void _internal_set_cache_shared(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.MountStatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::BlockClassStats > block_classes_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::HitRatePoint > hit_rate_curve_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::LatencyStats > disk_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cache_policy_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr io_engine_;
+    ::fs::LatencyStats* cache_miss_;
+    uint64_t cache_capacity_;
+    uint64_t cached_blocks_;
+    uint64_t metadata_blocks_;
+    uint64_t dirty_blocks_;
+    uint64_t prefetched_;
+    uint64_t prefetch_hits_;
+    uint64_t cache_quota_blocks_;
+    uint64_t cache_reserved_blocks_;
+    uint64_t cache_total_blocks_;
+    uint64_t icache_inodes_;
+    uint64_t icache_hits_;
+    uint64_t icache_misses_;
+    uint64_t icache_writebacks_;
+    uint64_t dentries_;
+    uint64_t dentry_hits_;
+    uint64_t dentry_misses_;
+    uint64_t path_hits_;
+    bool cache_enabled_;
+    bool cache_shared_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_filesystem_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// MountRequest
+
+// string disk_image = 1;
+inline void MountRequest::clear_disk_image() {
+  _impl_.disk_image_.ClearToEmpty();
+}
+inline const std::string& MountRequest::disk_image() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.disk_image)
+  return _internal_disk_image();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MountRequest::set_disk_image(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.disk_image_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountRequest.disk_image)
+}
+inline std::string* MountRequest::mutable_disk_image() {
+  std::string* _s = _internal_mutable_disk_image();
+  // @@protoc_insertion_point(field_mutable:fs.MountRequest.disk_image)
+  return _s;
+}
+inline const std::string& MountRequest::_internal_disk_image() const {
+  return _impl_.disk_image_.Get();
+}
+inline void MountRequest::_internal_set_disk_image(const std::string& value) {
+  
+  _impl_.disk_image_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MountRequest::_internal_mutable_disk_image() {
+  
+  return _impl_.disk_image_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MountRequest::release_disk_image() {
+  // @@protoc_insertion_point(field_release:fs.MountRequest.disk_image)
+  return _impl_.disk_image_.Release();
+}
+inline void MountRequest::set_allocated_disk_image(std::string* disk_image) {
+  if (disk_image != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.disk_image_.SetAllocated(disk_image, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.disk_image_.IsDefault()) {
+    _impl_.disk_image_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.MountRequest.disk_image)
+}
+
+// bool enable_cache = 2;
+inline void MountRequest::clear_enable_cache() {
+  _impl_.enable_cache_ = false;
+}
+inline bool MountRequest::_internal_enable_cache() const {
+  return _impl_.enable_cache_;
+}
+inline bool MountRequest::enable_cache() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.enable_cache)
+  return _internal_enable_cache();
+}
+inline void MountRequest::_internal_set_enable_cache(bool value) {
+  
+  _impl_.enable_cache_ = value;
+}
+inline void MountRequest::set_enable_cache(bool value) {
+  _internal_set_enable_cache(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.enable_cache)
+}
+
+// int32 cache_blocks = 3;
+inline void MountRequest::clear_cache_blocks() {
+  _impl_.cache_blocks_ = 0;
+}
+inline int32_t MountRequest::_internal_cache_blocks() const {
+  return _impl_.cache_blocks_;
+}
+inline int32_t MountRequest::cache_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.cache_blocks)
+  return _internal_cache_blocks();
+}
+inline void MountRequest::_internal_set_cache_blocks(int32_t value) {
+  
+  _impl_.cache_blocks_ = value;
+}
+inline void MountRequest::set_cache_blocks(int32_t value) {
+  _internal_set_cache_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.cache_blocks)
+}
+
+// string io_engine = 4;
+inline void MountRequest::clear_io_engine() {
+  _impl_.io_engine_.ClearToEmpty();
+}
+inline const std::string& MountRequest::io_engine() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.io_engine)
+  return _internal_io_engine();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MountRequest::set_io_engine(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.io_engine_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountRequest.io_engine)
+}
+inline std::string* MountRequest::mutable_io_engine() {
+  std::string* _s = _internal_mutable_io_engine();
+  // @@protoc_insertion_point(field_mutable:fs.MountRequest.io_engine)
+  return _s;
+}
+inline const std::string& MountRequest::_internal_io_engine() const {
+  return _impl_.io_engine_.Get();
+}
+inline void MountRequest::_internal_set_io_engine(const std::string& value) {
+  
+  _impl_.io_engine_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MountRequest::_internal_mutable_io_engine() {
+  
+  return _impl_.io_engine_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MountRequest::release_io_engine() {
+  // @@protoc_insertion_point(field_release:fs.MountRequest.io_engine)
+  return _impl_.io_engine_.Release();
+}
+inline void MountRequest::set_allocated_io_engine(std::string* io_engine) {
+  if (io_engine != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.io_engine_.SetAllocated(io_engine, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.io_engine_.IsDefault()) {
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.MountRequest.io_engine)
+}
+
+// bool direct_io = 5;
+inline void MountRequest::clear_direct_io() {
+  _impl_.direct_io_ = false;
+}
+inline bool MountRequest::_internal_direct_io() const {
+  return _impl_.direct_io_;
+}
+inline bool MountRequest::direct_io() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.direct_io)
+  return _internal_direct_io();
+}
+inline void MountRequest::_internal_set_direct_io(bool value) {
+  
+  _impl_.direct_io_ = value;
+}
+inline void MountRequest::set_direct_io(bool value) {
+  _internal_set_direct_io(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.direct_io)
+}
+
+// bool mmap_io = 6;
+inline void MountRequest::clear_mmap_io() {
+  _impl_.mmap_io_ = false;
+}
+inline bool MountRequest::_internal_mmap_io() const {
+  return _impl_.mmap_io_;
+}
+inline bool MountRequest::mmap_io() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.mmap_io)
+  return _internal_mmap_io();
+}
+inline void MountRequest::_internal_set_mmap_io(bool value) {
+  
+  _impl_.mmap_io_ = value;
+}
+inline void MountRequest::set_mmap_io(bool value) {
+  _internal_set_mmap_io(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.mmap_io)
+}
+
+// uint64 num_blocks = 7;
+inline void MountRequest::clear_num_blocks() {
+  _impl_.num_blocks_ = uint64_t{0u};
+}
+inline uint64_t MountRequest::_internal_num_blocks() const {
+  return _impl_.num_blocks_;
+}
+inline uint64_t MountRequest::num_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.num_blocks)
+  return _internal_num_blocks();
+}
+inline void MountRequest::_internal_set_num_blocks(uint64_t value) {
+  
+  _impl_.num_blocks_ = value;
+}
+inline void MountRequest::set_num_blocks(uint64_t value) {
+  _internal_set_num_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.num_blocks)
+}
+
+// uint64 num_inodes = 8;
+inline void MountRequest::clear_num_inodes() {
+  _impl_.num_inodes_ = uint64_t{0u};
+}
+inline uint64_t MountRequest::_internal_num_inodes() const {
+  return _impl_.num_inodes_;
+}
+inline uint64_t MountRequest::num_inodes() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.num_inodes)
+  return _internal_num_inodes();
+}
+inline void MountRequest::_internal_set_num_inodes(uint64_t value) {
+  
+  _impl_.num_inodes_ = value;
+}
+inline void MountRequest::set_num_inodes(uint64_t value) {
+  _internal_set_num_inodes(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.num_inodes)
+}
+
+// bool preallocate = 9;
+inline void MountRequest::clear_preallocate() {
+  _impl_.preallocate_ = false;
+}
+inline bool MountRequest::_internal_preallocate() const {
+  return _impl_.preallocate_;
+}
+inline bool MountRequest::preallocate() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.preallocate)
+  return _internal_preallocate();
+}
+inline void MountRequest::_internal_set_preallocate(bool value) {
+  
+  _impl_.preallocate_ = value;
+}
+inline void MountRequest::set_preallocate(bool value) {
+  _internal_set_preallocate(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.preallocate)
+}
+
+// string cache_policy = 10;
+inline void MountRequest::clear_cache_policy() {
+  _impl_.cache_policy_.ClearToEmpty();
+}
+inline const std::string& MountRequest::cache_policy() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.cache_policy)
+  return _internal_cache_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MountRequest::set_cache_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cache_policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountRequest.cache_policy)
+}
+inline std::string* MountRequest::mutable_cache_policy() {
+  std::string* _s = _internal_mutable_cache_policy();
+  // @@protoc_insertion_point(field_mutable:fs.MountRequest.cache_policy)
+  return _s;
+}
+inline const std::string& MountRequest::_internal_cache_policy() const {
+  return _impl_.cache_policy_.Get();
+}
+inline void MountRequest::_internal_set_cache_policy(const std::string& value) {
+  
+  _impl_.cache_policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MountRequest::_internal_mutable_cache_policy() {
+  
+  return _impl_.cache_policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MountRequest::release_cache_policy() {
+  // @@protoc_insertion_point(field_release:fs.MountRequest.cache_policy)
+  return _impl_.cache_policy_.Release();
+}
+inline void MountRequest::set_allocated_cache_policy(std::string* cache_policy) {
+  if (cache_policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cache_policy_.SetAllocated(cache_policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cache_policy_.IsDefault()) {
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.MountRequest.cache_policy)
+}
+
+// uint64 cache_reserved_blocks = 11;
+inline void MountRequest::clear_cache_reserved_blocks() {
+  _impl_.cache_reserved_blocks_ = uint64_t{0u};
+}
+inline uint64_t MountRequest::_internal_cache_reserved_blocks() const {
+  return _impl_.cache_reserved_blocks_;
+}
+inline uint64_t MountRequest::cache_reserved_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountRequest.cache_reserved_blocks)
+  return _internal_cache_reserved_blocks();
+}
+inline void MountRequest::_internal_set_cache_reserved_blocks(uint64_t value) {
+  
+  _impl_.cache_reserved_blocks_ = value;
+}
+inline void MountRequest::set_cache_reserved_blocks(uint64_t value) {
+  _internal_set_cache_reserved_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountRequest.cache_reserved_blocks)
+}
+
+// -------------------------------------------------------------------
+
+// MountResponse
+
+// int32 mount_id = 1;
+inline void MountResponse::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t MountResponse::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t MountResponse::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.MountResponse.mount_id)
+  return _internal_mount_id();
+}
+inline void MountResponse::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void MountResponse::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.MountResponse.mount_id)
+}
+
+// string error = 2;
+inline void MountResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& MountResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.MountResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MountResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountResponse.error)
+}
+inline std::string* MountResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.MountResponse.error)
+  return _s;
+}
+inline const std::string& MountResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void MountResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MountResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MountResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.MountResponse.error)
+  return _impl_.error_.Release();
+}
+inline void MountResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.MountResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// FileRequest
+
+// int32 mount_id = 1;
+inline void FileRequest::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t FileRequest::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t FileRequest::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.FileRequest.mount_id)
+  return _internal_mount_id();
+}
+inline void FileRequest::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void FileRequest::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.FileRequest.mount_id)
+}
+
+// string path = 2;
+inline void FileRequest::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& FileRequest::path() const {
+  // @@protoc_insertion_point(field_get:fs.FileRequest.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileRequest::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.FileRequest.path)
+}
+inline std::string* FileRequest::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:fs.FileRequest.path)
+  return _s;
+}
+inline const std::string& FileRequest::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void FileRequest::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileRequest::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileRequest::release_path() {
+  // @@protoc_insertion_point(field_release:fs.FileRequest.path)
+  return _impl_.path_.Release();
+}
+inline void FileRequest::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.FileRequest.path)
+}
+
+// -------------------------------------------------------------------
+
+// CreateResponse
+
+// int32 inum = 1;
+inline void CreateResponse::clear_inum() {
+  _impl_.inum_ = 0;
+}
+inline int32_t CreateResponse::_internal_inum() const {
+  return _impl_.inum_;
+}
+inline int32_t CreateResponse::inum() const {
+  // @@protoc_insertion_point(field_get:fs.CreateResponse.inum)
+  return _internal_inum();
+}
+inline void CreateResponse::_internal_set_inum(int32_t value) {
+  
+  _impl_.inum_ = value;
+}
+inline void CreateResponse::set_inum(int32_t value) {
+  _internal_set_inum(value);
+  // @@protoc_insertion_point(field_set:fs.CreateResponse.inum)
+}
+
+// string error = 2;
+inline void CreateResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& CreateResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.CreateResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CreateResponse.error)
+}
+inline std::string* CreateResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.CreateResponse.error)
+  return _s;
+}
+inline const std::string& CreateResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void CreateResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.CreateResponse.error)
+  return _impl_.error_.Release();
+}
+inline void CreateResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CreateResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// MkdirResponse
+
+// int32 inum = 1;
+inline void MkdirResponse::clear_inum() {
+  _impl_.inum_ = 0;
+}
+inline int32_t MkdirResponse::_internal_inum() const {
+  return _impl_.inum_;
+}
+inline int32_t MkdirResponse::inum() const {
+  // @@protoc_insertion_point(field_get:fs.MkdirResponse.inum)
+  return _internal_inum();
+}
+inline void MkdirResponse::_internal_set_inum(int32_t value) {
+  
+  _impl_.inum_ = value;
+}
+inline void MkdirResponse::set_inum(int32_t value) {
+  _internal_set_inum(value);
+  // @@protoc_insertion_point(field_set:fs.MkdirResponse.inum)
+}
+
+// string error = 2;
+inline void MkdirResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& MkdirResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.MkdirResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MkdirResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MkdirResponse.error)
+}
+inline std::string* MkdirResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.MkdirResponse.error)
+  return _s;
+}
+inline const std::string& MkdirResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void MkdirResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MkdirResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MkdirResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.MkdirResponse.error)
+  return _impl_.error_.Release();
+}
+inline void MkdirResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.MkdirResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// OpenResponse
+
+// int32 fd = 1;
+inline void OpenResponse::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t OpenResponse::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t OpenResponse::fd() const {
+  // @@protoc_insertion_point(field_get:fs.OpenResponse.fd)
+  return _internal_fd();
+}
+inline void OpenResponse::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void OpenResponse::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:fs.OpenResponse.fd)
+}
+
+// string error = 2;
+inline void OpenResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& OpenResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.OpenResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.OpenResponse.error)
+}
+inline std::string* OpenResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.OpenResponse.error)
+  return _s;
+}
+inline const std::string& OpenResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void OpenResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.OpenResponse.error)
+  return _impl_.error_.Release();
+}
+inline void OpenResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.OpenResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// ReadRequestMulti
+
+// int32 mount_id = 1;
+inline void ReadRequestMulti::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t ReadRequestMulti::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t ReadRequestMulti::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.mount_id)
+  return _internal_mount_id();
+}
+inline void ReadRequestMulti::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void ReadRequestMulti::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.mount_id)
+}
+
+// int32 fd = 2;
+inline void ReadRequestMulti::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t ReadRequestMulti::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t ReadRequestMulti::fd() const {
+  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.fd)
+  return _internal_fd();
+}
+inline void ReadRequestMulti::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void ReadRequestMulti::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.fd)
+}
+
+// int32 num_bytes = 3;
+inline void ReadRequestMulti::clear_num_bytes() {
+  _impl_.num_bytes_ = 0;
+}
+inline int32_t ReadRequestMulti::_internal_num_bytes() const {
+  return _impl_.num_bytes_;
+}
+inline int32_t ReadRequestMulti::num_bytes() const {
+  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.num_bytes)
+  return _internal_num_bytes();
+}
+inline void ReadRequestMulti::_internal_set_num_bytes(int32_t value) {
+  
+  _impl_.num_bytes_ = value;
+}
+inline void ReadRequestMulti::set_num_bytes(int32_t value) {
+  _internal_set_num_bytes(value);
+  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.num_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// ReadResponse
+
+// bytes data = 1;
+inline void ReadResponse::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ReadResponse::data() const {
+  // @@protoc_insertion_point(field_get:fs.ReadResponse.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadResponse::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.ReadResponse.data)
+}
+inline std::string* ReadResponse::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:fs.ReadResponse.data)
+  return _s;
+}
+inline const std::string& ReadResponse::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ReadResponse::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadResponse::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadResponse::release_data() {
+  // @@protoc_insertion_point(field_release:fs.ReadResponse.data)
+  return _impl_.data_.Release();
+}
+inline void ReadResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.ReadResponse.data)
+}
+
+// string error = 2;
+inline void ReadResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& ReadResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.ReadResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.ReadResponse.error)
+}
+inline std::string* ReadResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.ReadResponse.error)
+  return _s;
+}
+inline const std::string& ReadResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ReadResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.ReadResponse.error)
+  return _impl_.error_.Release();
+}
+inline void ReadResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.ReadResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// WriteRequestMulti
+
+// int32 mount_id = 1;
+inline void WriteRequestMulti::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t WriteRequestMulti::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t WriteRequestMulti::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.mount_id)
+  return _internal_mount_id();
+}
+inline void WriteRequestMulti::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void WriteRequestMulti::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.mount_id)
+}
+
+// int32 fd = 2;
+inline void WriteRequestMulti::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t WriteRequestMulti::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t WriteRequestMulti::fd() const {
+  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.fd)
+  return _internal_fd();
+}
+inline void WriteRequestMulti::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void WriteRequestMulti::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.fd)
+}
+
+// bytes data = 3;
+inline void WriteRequestMulti::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& WriteRequestMulti::data() const {
+  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteRequestMulti::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.data)
+}
+inline std::string* WriteRequestMulti::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:fs.WriteRequestMulti.data)
+  return _s;
+}
+inline const std::string& WriteRequestMulti::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void WriteRequestMulti::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteRequestMulti::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteRequestMulti::release_data() {
+  // @@protoc_insertion_point(field_release:fs.WriteRequestMulti.data)
+  return _impl_.data_.Release();
+}
+inline void WriteRequestMulti::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.WriteRequestMulti.data)
+}
+
+// -------------------------------------------------------------------
+
+// WriteResponse
+
+// bool success = 1;
+inline void WriteResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool WriteResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool WriteResponse::success() const {
+  // @@protoc_insertion_point(field_get:fs.WriteResponse.success)
+  return _internal_success();
+}
+inline void WriteResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void WriteResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:fs.WriteResponse.success)
+}
+
+// string error = 2;
+inline void WriteResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& WriteResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.WriteResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.WriteResponse.error)
+}
+inline std::string* WriteResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.WriteResponse.error)
+  return _s;
+}
+inline const std::string& WriteResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void WriteResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.WriteResponse.error)
+  return _impl_.error_.Release();
+}
+inline void WriteResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.WriteResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// SeekRequestMulti
+
+// int32 mount_id = 1;
+inline void SeekRequestMulti::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t SeekRequestMulti::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t SeekRequestMulti::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.mount_id)
+  return _internal_mount_id();
+}
+inline void SeekRequestMulti::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void SeekRequestMulti::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.mount_id)
+}
+
+// int32 fd = 2;
+inline void SeekRequestMulti::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t SeekRequestMulti::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t SeekRequestMulti::fd() const {
+  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.fd)
+  return _internal_fd();
+}
+inline void SeekRequestMulti::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void SeekRequestMulti::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.fd)
+}
+
+// int32 offset = 3;
+inline void SeekRequestMulti::clear_offset() {
+  _impl_.offset_ = 0;
+}
+inline int32_t SeekRequestMulti::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t SeekRequestMulti::offset() const {
+  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.offset)
+  return _internal_offset();
+}
+inline void SeekRequestMulti::_internal_set_offset(int32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void SeekRequestMulti::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.offset)
+}
+
+// int32 whence = 4;
+inline void SeekRequestMulti::clear_whence() {
+  _impl_.whence_ = 0;
+}
+inline int32_t SeekRequestMulti::_internal_whence() const {
+  return _impl_.whence_;
+}
+inline int32_t SeekRequestMulti::whence() const {
+  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.whence)
+  return _internal_whence();
+}
+inline void SeekRequestMulti::_internal_set_whence(int32_t value) {
+  
+  _impl_.whence_ = value;
+}
+inline void SeekRequestMulti::set_whence(int32_t value) {
+  _internal_set_whence(value);
+  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.whence)
+}
+
+// -------------------------------------------------------------------
+
+// SeekResponse
+
+// bool success = 1;
+inline void SeekResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool SeekResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool SeekResponse::success() const {
+  // @@protoc_insertion_point(field_get:fs.SeekResponse.success)
+  return _internal_success();
+}
+inline void SeekResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void SeekResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:fs.SeekResponse.success)
+}
+
+// string error = 2;
+inline void SeekResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& SeekResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.SeekResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SeekResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.SeekResponse.error)
+}
+inline std::string* SeekResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.SeekResponse.error)
+  return _s;
+}
+inline const std::string& SeekResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void SeekResponse::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline void MountResponse::set_allocated_error(std::string* error) {
+inline std::string* SeekResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SeekResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.SeekResponse.error)
+  return _impl_.error_.Release();
+}
+inline void SeekResponse::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     
   } else {
@@ -2639,143 +5474,316 @@ inline void MountResponse::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.MountResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:fs.SeekResponse.error)
 }
 
 // -------------------------------------------------------------------
 
-// FileRequest
+// ListdirResponse
 
-// int32 mount_id = 1;
-inline void FileRequest::clear_mount_id() {
-  _impl_.mount_id_ = 0;
+// repeated string entries = 1;
+inline int ListdirResponse::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline int32_t FileRequest::_internal_mount_id() const {
-  return _impl_.mount_id_;
+inline int ListdirResponse::entries_size() const {
+  return _internal_entries_size();
 }
-inline int32_t FileRequest::mount_id() const {
-  // @@protoc_insertion_point(field_get:fs.FileRequest.mount_id)
-  return _internal_mount_id();
+inline void ListdirResponse::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline void FileRequest::_internal_set_mount_id(int32_t value) {
+inline std::string* ListdirResponse::add_entries() {
+  std::string* _s = _internal_add_entries();
+  // @@protoc_insertion_point(field_add_mutable:fs.ListdirResponse.entries)
+  return _s;
+}
+inline const std::string& ListdirResponse::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const std::string& ListdirResponse::entries(int index) const {
+  // @@protoc_insertion_point(field_get:fs.ListdirResponse.entries)
+  return _internal_entries(index);
+}
+inline std::string* ListdirResponse::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.ListdirResponse.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline void ListdirResponse::set_entries(int index, const std::string& value) {
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::set_entries(int index, std::string&& value) {
+  _impl_.entries_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::set_entries(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::set_entries(int index, const char* value, size_t size) {
+  _impl_.entries_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:fs.ListdirResponse.entries)
+}
+inline std::string* ListdirResponse::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline void ListdirResponse::add_entries(const std::string& value) {
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::add_entries(std::string&& value) {
+  _impl_.entries_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::add_entries(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:fs.ListdirResponse.entries)
+}
+inline void ListdirResponse::add_entries(const char* value, size_t size) {
+  _impl_.entries_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:fs.ListdirResponse.entries)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ListdirResponse::entries() const {
+  // @@protoc_insertion_point(field_list:fs.ListdirResponse.entries)
+  return _impl_.entries_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ListdirResponse::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:fs.ListdirResponse.entries)
+  return &_impl_.entries_;
+}
+
+// string error = 2;
+inline void ListdirResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& ListdirResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.ListdirResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListdirResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.ListdirResponse.error)
+}
+inline std::string* ListdirResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.ListdirResponse.error)
+  return _s;
+}
+inline const std::string& ListdirResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ListdirResponse::_internal_set_error(const std::string& value) {
   
-  _impl_.mount_id_ = value;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline void FileRequest::set_mount_id(int32_t value) {
-  _internal_set_mount_id(value);
-  // @@protoc_insertion_point(field_set:fs.FileRequest.mount_id)
+inline std::string* ListdirResponse::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListdirResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.ListdirResponse.error)
+  return _impl_.error_.Release();
+}
+inline void ListdirResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.ListdirResponse.error)
 }
 
-// string path = 2;
-inline void FileRequest::clear_path() {
-  _impl_.path_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// RemoveResponse
+
+// bool success = 1;
+inline void RemoveResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline const std::string& FileRequest::path() const {
-  // @@protoc_insertion_point(field_get:fs.FileRequest.path)
-  return _internal_path();
+inline bool RemoveResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool RemoveResponse::success() const {
+  // @@protoc_insertion_point(field_get:fs.RemoveResponse.success)
+  return _internal_success();
+}
+inline void RemoveResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void RemoveResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:fs.RemoveResponse.success)
+}
+
+// string error = 2;
+inline void RemoveResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& RemoveResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.RemoveResponse.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FileRequest::set_path(ArgT0&& arg0, ArgT... args) {
+void RemoveResponse::set_error(ArgT0&& arg0, ArgT... args) {
  
- _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.FileRequest.path)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.RemoveResponse.error)
 }
-inline std::string* FileRequest::mutable_path() {
-  std::string* _s = _internal_mutable_path();
-  // @@protoc_insertion_point(field_mutable:fs.FileRequest.path)
+inline std::string* RemoveResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.RemoveResponse.error)
   return _s;
 }
-inline const std::string& FileRequest::_internal_path() const {
-  return _impl_.path_.Get();
+inline const std::string& RemoveResponse::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void FileRequest::_internal_set_path(const std::string& value) {
+inline void RemoveResponse::_internal_set_error(const std::string& value) {
   
-  _impl_.path_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FileRequest::_internal_mutable_path() {
+inline std::string* RemoveResponse::_internal_mutable_error() {
   
-  return _impl_.path_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FileRequest::release_path() {
-  // @@protoc_insertion_point(field_release:fs.FileRequest.path)
-  return _impl_.path_.Release();
+inline std::string* RemoveResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.RemoveResponse.error)
+  return _impl_.error_.Release();
 }
-inline void FileRequest::set_allocated_path(std::string* path) {
-  if (path != nullptr) {
+inline void RemoveResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     
   } else {
     
   }
-  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.path_.IsDefault()) {
-    _impl_.path_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.FileRequest.path)
+  // @@protoc_insertion_point(field_set_allocated:fs.RemoveResponse.error)
 }
 
 // -------------------------------------------------------------------
 
-// CreateResponse
+// FdRequest
 
-// int32 inum = 1;
-inline void CreateResponse::clear_inum() {
-  _impl_.inum_ = 0;
+// int32 mount_id = 1;
+inline void FdRequest::clear_mount_id() {
+  _impl_.mount_id_ = 0;
+}
+inline int32_t FdRequest::_internal_mount_id() const {
+  return _impl_.mount_id_;
+}
+inline int32_t FdRequest::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.FdRequest.mount_id)
+  return _internal_mount_id();
+}
+inline void FdRequest::_internal_set_mount_id(int32_t value) {
+  
+  _impl_.mount_id_ = value;
+}
+inline void FdRequest::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.FdRequest.mount_id)
+}
+
+// int32 fd = 2;
+inline void FdRequest::clear_fd() {
+  _impl_.fd_ = 0;
+}
+inline int32_t FdRequest::_internal_fd() const {
+  return _impl_.fd_;
+}
+inline int32_t FdRequest::fd() const {
+  // @@protoc_insertion_point(field_get:fs.FdRequest.fd)
+  return _internal_fd();
+}
+inline void FdRequest::_internal_set_fd(int32_t value) {
+  
+  _impl_.fd_ = value;
+}
+inline void FdRequest::set_fd(int32_t value) {
+  _internal_set_fd(value);
+  // @@protoc_insertion_point(field_set:fs.FdRequest.fd)
+}
+
+// -------------------------------------------------------------------
+
+// CloseResponse
+
+// bool success = 1;
+inline void CloseResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline int32_t CreateResponse::_internal_inum() const {
-  return _impl_.inum_;
+inline bool CloseResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline int32_t CreateResponse::inum() const {
-  // @@protoc_insertion_point(field_get:fs.CreateResponse.inum)
-  return _internal_inum();
+inline bool CloseResponse::success() const {
+  // @@protoc_insertion_point(field_get:fs.CloseResponse.success)
+  return _internal_success();
 }
-inline void CreateResponse::_internal_set_inum(int32_t value) {
+inline void CloseResponse::_internal_set_success(bool value) {
   
-  _impl_.inum_ = value;
+  _impl_.success_ = value;
 }
-inline void CreateResponse::set_inum(int32_t value) {
-  _internal_set_inum(value);
-  // @@protoc_insertion_point(field_set:fs.CreateResponse.inum)
+inline void CloseResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:fs.CloseResponse.success)
 }
 
 // string error = 2;
-inline void CreateResponse::clear_error() {
+inline void CloseResponse::clear_error() {
   _impl_.error_.ClearToEmpty();
 }
-inline const std::string& CreateResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.CreateResponse.error)
+inline const std::string& CloseResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.CloseResponse.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void CreateResponse::set_error(ArgT0&& arg0, ArgT... args) {
+void CloseResponse::set_error(ArgT0&& arg0, ArgT... args) {
  
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.CreateResponse.error)
+  // @@protoc_insertion_point(field_set:fs.CloseResponse.error)
 }
-inline std::string* CreateResponse::mutable_error() {
+inline std::string* CloseResponse::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.CreateResponse.error)
+  // @@protoc_insertion_point(field_mutable:fs.CloseResponse.error)
   return _s;
 }
-inline const std::string& CreateResponse::_internal_error() const {
+inline const std::string& CloseResponse::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void CreateResponse::_internal_set_error(const std::string& value) {
+inline void CloseResponse::_internal_set_error(const std::string& value) {
   
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* CreateResponse::_internal_mutable_error() {
+inline std::string* CloseResponse::_internal_mutable_error() {
   
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* CreateResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.CreateResponse.error)
+inline std::string* CloseResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.CloseResponse.error)
   return _impl_.error_.Release();
 }
-inline void CreateResponse::set_allocated_error(std::string* error) {
+inline void CloseResponse::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     
   } else {
@@ -2787,69 +5795,69 @@ inline void CreateResponse::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.CreateResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:fs.CloseResponse.error)
 }
 
 // -------------------------------------------------------------------
 
-// MkdirResponse
+// FsyncResponse
 
-// int32 inum = 1;
-inline void MkdirResponse::clear_inum() {
-  _impl_.inum_ = 0;
+// bool success = 1;
+inline void FsyncResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline int32_t MkdirResponse::_internal_inum() const {
-  return _impl_.inum_;
+inline bool FsyncResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline int32_t MkdirResponse::inum() const {
-  // @@protoc_insertion_point(field_get:fs.MkdirResponse.inum)
-  return _internal_inum();
+inline bool FsyncResponse::success() const {
+  // @@protoc_insertion_point(field_get:fs.FsyncResponse.success)
+  return _internal_success();
 }
-inline void MkdirResponse::_internal_set_inum(int32_t value) {
+inline void FsyncResponse::_internal_set_success(bool value) {
   
-  _impl_.inum_ = value;
+  _impl_.success_ = value;
 }
-inline void MkdirResponse::set_inum(int32_t value) {
-  _internal_set_inum(value);
-  // @@protoc_insertion_point(field_set:fs.MkdirResponse.inum)
+inline void FsyncResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:fs.FsyncResponse.success)
 }
 
 // string error = 2;
-inline void MkdirResponse::clear_error() {
+inline void FsyncResponse::clear_error() {
   _impl_.error_.ClearToEmpty();
 }
-inline const std::string& MkdirResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.MkdirResponse.error)
+inline const std::string& FsyncResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.FsyncResponse.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void MkdirResponse::set_error(ArgT0&& arg0, ArgT... args) {
+void FsyncResponse::set_error(ArgT0&& arg0, ArgT... args) {
  
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.MkdirResponse.error)
+  // @@protoc_insertion_point(field_set:fs.FsyncResponse.error)
 }
-inline std::string* MkdirResponse::mutable_error() {
+inline std::string* FsyncResponse::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.MkdirResponse.error)
+  // @@protoc_insertion_point(field_mutable:fs.FsyncResponse.error)
   return _s;
 }
-inline const std::string& MkdirResponse::_internal_error() const {
+inline const std::string& FsyncResponse::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void MkdirResponse::_internal_set_error(const std::string& value) {
+inline void FsyncResponse::_internal_set_error(const std::string& value) {
   
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* MkdirResponse::_internal_mutable_error() {
+inline std::string* FsyncResponse::_internal_mutable_error() {
   
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* MkdirResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.MkdirResponse.error)
+inline std::string* FsyncResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.FsyncResponse.error)
   return _impl_.error_.Release();
 }
-inline void MkdirResponse::set_allocated_error(std::string* error) {
+inline void FsyncResponse::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     
   } else {
@@ -2861,237 +5869,445 @@ inline void MkdirResponse::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.MkdirResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:fs.FsyncResponse.error)
 }
 
 // -------------------------------------------------------------------
 
-// OpenResponse
+// MountStatsRequest
 
-// int32 fd = 1;
-inline void OpenResponse::clear_fd() {
-  _impl_.fd_ = 0;
+// int32 mount_id = 1;
+inline void MountStatsRequest::clear_mount_id() {
+  _impl_.mount_id_ = 0;
 }
-inline int32_t OpenResponse::_internal_fd() const {
-  return _impl_.fd_;
+inline int32_t MountStatsRequest::_internal_mount_id() const {
+  return _impl_.mount_id_;
 }
-inline int32_t OpenResponse::fd() const {
-  // @@protoc_insertion_point(field_get:fs.OpenResponse.fd)
-  return _internal_fd();
+inline int32_t MountStatsRequest::mount_id() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsRequest.mount_id)
+  return _internal_mount_id();
 }
-inline void OpenResponse::_internal_set_fd(int32_t value) {
+inline void MountStatsRequest::_internal_set_mount_id(int32_t value) {
   
-  _impl_.fd_ = value;
+  _impl_.mount_id_ = value;
 }
-inline void OpenResponse::set_fd(int32_t value) {
-  _internal_set_fd(value);
-  // @@protoc_insertion_point(field_set:fs.OpenResponse.fd)
+inline void MountStatsRequest::set_mount_id(int32_t value) {
+  _internal_set_mount_id(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsRequest.mount_id)
 }
 
-// string error = 2;
-inline void OpenResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// BlockClassStats
+
+// string block_class = 1;
+inline void BlockClassStats::clear_block_class() {
+  _impl_.block_class_.ClearToEmpty();
 }
-inline const std::string& OpenResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.OpenResponse.error)
-  return _internal_error();
+inline const std::string& BlockClassStats::block_class() const {
+  // @@protoc_insertion_point(field_get:fs.BlockClassStats.block_class)
+  return _internal_block_class();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void OpenResponse::set_error(ArgT0&& arg0, ArgT... args) {
+void BlockClassStats::set_block_class(ArgT0&& arg0, ArgT... args) {
  
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.OpenResponse.error)
+ _impl_.block_class_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.BlockClassStats.block_class)
 }
-inline std::string* OpenResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.OpenResponse.error)
+inline std::string* BlockClassStats::mutable_block_class() {
+  std::string* _s = _internal_mutable_block_class();
+  // @@protoc_insertion_point(field_mutable:fs.BlockClassStats.block_class)
   return _s;
 }
-inline const std::string& OpenResponse::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& BlockClassStats::_internal_block_class() const {
+  return _impl_.block_class_.Get();
 }
-inline void OpenResponse::_internal_set_error(const std::string& value) {
+inline void BlockClassStats::_internal_set_block_class(const std::string& value) {
   
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.block_class_.Set(value, GetArenaForAllocation());
 }
-inline std::string* OpenResponse::_internal_mutable_error() {
+inline std::string* BlockClassStats::_internal_mutable_block_class() {
   
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.block_class_.Mutable(GetArenaForAllocation());
 }
-inline std::string* OpenResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.OpenResponse.error)
-  return _impl_.error_.Release();
+inline std::string* BlockClassStats::release_block_class() {
+  // @@protoc_insertion_point(field_release:fs.BlockClassStats.block_class)
+  return _impl_.block_class_.Release();
 }
-inline void OpenResponse::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void BlockClassStats::set_allocated_block_class(std::string* block_class) {
+  if (block_class != nullptr) {
     
   } else {
     
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.block_class_.SetAllocated(block_class, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.block_class_.IsDefault()) {
+    _impl_.block_class_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.OpenResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:fs.BlockClassStats.block_class)
 }
 
-// -------------------------------------------------------------------
-
-// ReadRequestMulti
+// uint64 hits = 2;
+inline void BlockClassStats::clear_hits() {
+  _impl_.hits_ = uint64_t{0u};
+}
+inline uint64_t BlockClassStats::_internal_hits() const {
+  return _impl_.hits_;
+}
+inline uint64_t BlockClassStats::hits() const {
+  // @@protoc_insertion_point(field_get:fs.BlockClassStats.hits)
+  return _internal_hits();
+}
+inline void BlockClassStats::_internal_set_hits(uint64_t value) {
+  
+  _impl_.hits_ = value;
+}
+inline void BlockClassStats::set_hits(uint64_t value) {
+  _internal_set_hits(value);
+  // @@protoc_insertion_point(field_set:fs.BlockClassStats.hits)
+}
 
-// int32 mount_id = 1;
-inline void ReadRequestMulti::clear_mount_id() {
-  _impl_.mount_id_ = 0;
+// uint64 misses = 3;
+inline void BlockClassStats::clear_misses() {
+  _impl_.misses_ = uint64_t{0u};
 }
-inline int32_t ReadRequestMulti::_internal_mount_id() const {
-  return _impl_.mount_id_;
+inline uint64_t BlockClassStats::_internal_misses() const {
+  return _impl_.misses_;
 }
-inline int32_t ReadRequestMulti::mount_id() const {
-  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.mount_id)
-  return _internal_mount_id();
+inline uint64_t BlockClassStats::misses() const {
+  // @@protoc_insertion_point(field_get:fs.BlockClassStats.misses)
+  return _internal_misses();
 }
-inline void ReadRequestMulti::_internal_set_mount_id(int32_t value) {
+inline void BlockClassStats::_internal_set_misses(uint64_t value) {
   
-  _impl_.mount_id_ = value;
+  _impl_.misses_ = value;
 }
-inline void ReadRequestMulti::set_mount_id(int32_t value) {
-  _internal_set_mount_id(value);
-  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.mount_id)
+inline void BlockClassStats::set_misses(uint64_t value) {
+  _internal_set_misses(value);
+  // @@protoc_insertion_point(field_set:fs.BlockClassStats.misses)
 }
 
-// int32 fd = 2;
-inline void ReadRequestMulti::clear_fd() {
-  _impl_.fd_ = 0;
+// uint64 evictions = 4;
+inline void BlockClassStats::clear_evictions() {
+  _impl_.evictions_ = uint64_t{0u};
 }
-inline int32_t ReadRequestMulti::_internal_fd() const {
-  return _impl_.fd_;
+inline uint64_t BlockClassStats::_internal_evictions() const {
+  return _impl_.evictions_;
 }
-inline int32_t ReadRequestMulti::fd() const {
-  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.fd)
-  return _internal_fd();
+inline uint64_t BlockClassStats::evictions() const {
+  // @@protoc_insertion_point(field_get:fs.BlockClassStats.evictions)
+  return _internal_evictions();
 }
-inline void ReadRequestMulti::_internal_set_fd(int32_t value) {
+inline void BlockClassStats::_internal_set_evictions(uint64_t value) {
   
-  _impl_.fd_ = value;
+  _impl_.evictions_ = value;
 }
-inline void ReadRequestMulti::set_fd(int32_t value) {
-  _internal_set_fd(value);
-  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.fd)
+inline void BlockClassStats::set_evictions(uint64_t value) {
+  _internal_set_evictions(value);
+  // @@protoc_insertion_point(field_set:fs.BlockClassStats.evictions)
 }
 
-// int32 num_bytes = 3;
-inline void ReadRequestMulti::clear_num_bytes() {
-  _impl_.num_bytes_ = 0;
+// uint64 writebacks = 5;
+inline void BlockClassStats::clear_writebacks() {
+  _impl_.writebacks_ = uint64_t{0u};
 }
-inline int32_t ReadRequestMulti::_internal_num_bytes() const {
-  return _impl_.num_bytes_;
+inline uint64_t BlockClassStats::_internal_writebacks() const {
+  return _impl_.writebacks_;
 }
-inline int32_t ReadRequestMulti::num_bytes() const {
-  // @@protoc_insertion_point(field_get:fs.ReadRequestMulti.num_bytes)
-  return _internal_num_bytes();
+inline uint64_t BlockClassStats::writebacks() const {
+  // @@protoc_insertion_point(field_get:fs.BlockClassStats.writebacks)
+  return _internal_writebacks();
 }
-inline void ReadRequestMulti::_internal_set_num_bytes(int32_t value) {
+inline void BlockClassStats::_internal_set_writebacks(uint64_t value) {
   
-  _impl_.num_bytes_ = value;
+  _impl_.writebacks_ = value;
 }
-inline void ReadRequestMulti::set_num_bytes(int32_t value) {
-  _internal_set_num_bytes(value);
-  // @@protoc_insertion_point(field_set:fs.ReadRequestMulti.num_bytes)
+inline void BlockClassStats::set_writebacks(uint64_t value) {
+  _internal_set_writebacks(value);
+  // @@protoc_insertion_point(field_set:fs.BlockClassStats.writebacks)
 }
 
 // -------------------------------------------------------------------
 
-// ReadResponse
+// LatencyStats
 
-// bytes data = 1;
-inline void ReadResponse::clear_data() {
-  _impl_.data_.ClearToEmpty();
+// string op = 1;
+inline void LatencyStats::clear_op() {
+  _impl_.op_.ClearToEmpty();
 }
-inline const std::string& ReadResponse::data() const {
-  // @@protoc_insertion_point(field_get:fs.ReadResponse.data)
-  return _internal_data();
+inline const std::string& LatencyStats::op() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.op)
+  return _internal_op();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ReadResponse::set_data(ArgT0&& arg0, ArgT... args) {
+void LatencyStats::set_op(ArgT0&& arg0, ArgT... args) {
  
- _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.ReadResponse.data)
+ _impl_.op_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.op)
 }
-inline std::string* ReadResponse::mutable_data() {
-  std::string* _s = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:fs.ReadResponse.data)
+inline std::string* LatencyStats::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:fs.LatencyStats.op)
   return _s;
 }
-inline const std::string& ReadResponse::_internal_data() const {
-  return _impl_.data_.Get();
+inline const std::string& LatencyStats::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void LatencyStats::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LatencyStats::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LatencyStats::release_op() {
+  // @@protoc_insertion_point(field_release:fs.LatencyStats.op)
+  return _impl_.op_.Release();
+}
+inline void LatencyStats::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.LatencyStats.op)
+}
+
+// uint64 count = 2;
+inline void LatencyStats::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencyStats::count() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.count)
+  return _internal_count();
+}
+inline void LatencyStats::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencyStats::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.count)
+}
+
+// uint64 blocks = 3;
+inline void LatencyStats::clear_blocks() {
+  _impl_.blocks_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_blocks() const {
+  return _impl_.blocks_;
+}
+inline uint64_t LatencyStats::blocks() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.blocks)
+  return _internal_blocks();
+}
+inline void LatencyStats::_internal_set_blocks(uint64_t value) {
+  
+  _impl_.blocks_ = value;
+}
+inline void LatencyStats::set_blocks(uint64_t value) {
+  _internal_set_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.blocks)
+}
+
+// uint64 errors = 4;
+inline void LatencyStats::clear_errors() {
+  _impl_.errors_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_errors() const {
+  return _impl_.errors_;
+}
+inline uint64_t LatencyStats::errors() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.errors)
+  return _internal_errors();
+}
+inline void LatencyStats::_internal_set_errors(uint64_t value) {
+  
+  _impl_.errors_ = value;
+}
+inline void LatencyStats::set_errors(uint64_t value) {
+  _internal_set_errors(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.errors)
+}
+
+// double mean_us = 5;
+inline void LatencyStats::clear_mean_us() {
+  _impl_.mean_us_ = 0;
+}
+inline double LatencyStats::_internal_mean_us() const {
+  return _impl_.mean_us_;
+}
+inline double LatencyStats::mean_us() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.mean_us)
+  return _internal_mean_us();
+}
+inline void LatencyStats::_internal_set_mean_us(double value) {
+  
+  _impl_.mean_us_ = value;
+}
+inline void LatencyStats::set_mean_us(double value) {
+  _internal_set_mean_us(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.mean_us)
+}
+
+// uint64 p50_us = 6;
+inline void LatencyStats::clear_p50_us() {
+  _impl_.p50_us_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_p50_us() const {
+  return _impl_.p50_us_;
+}
+inline uint64_t LatencyStats::p50_us() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.p50_us)
+  return _internal_p50_us();
+}
+inline void LatencyStats::_internal_set_p50_us(uint64_t value) {
+  
+  _impl_.p50_us_ = value;
+}
+inline void LatencyStats::set_p50_us(uint64_t value) {
+  _internal_set_p50_us(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.p50_us)
+}
+
+// uint64 p99_us = 7;
+inline void LatencyStats::clear_p99_us() {
+  _impl_.p99_us_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_p99_us() const {
+  return _impl_.p99_us_;
+}
+inline uint64_t LatencyStats::p99_us() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.p99_us)
+  return _internal_p99_us();
+}
+inline void LatencyStats::_internal_set_p99_us(uint64_t value) {
+  
+  _impl_.p99_us_ = value;
+}
+inline void LatencyStats::set_p99_us(uint64_t value) {
+  _internal_set_p99_us(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.p99_us)
+}
+
+// uint64 max_us = 8;
+inline void LatencyStats::clear_max_us() {
+  _impl_.max_us_ = uint64_t{0u};
+}
+inline uint64_t LatencyStats::_internal_max_us() const {
+  return _impl_.max_us_;
+}
+inline uint64_t LatencyStats::max_us() const {
+  // @@protoc_insertion_point(field_get:fs.LatencyStats.max_us)
+  return _internal_max_us();
+}
+inline void LatencyStats::_internal_set_max_us(uint64_t value) {
+  
+  _impl_.max_us_ = value;
+}
+inline void LatencyStats::set_max_us(uint64_t value) {
+  _internal_set_max_us(value);
+  // @@protoc_insertion_point(field_set:fs.LatencyStats.max_us)
+}
+
+// -------------------------------------------------------------------
+
+// HitRatePoint
+
+// uint64 cache_blocks = 1;
+inline void HitRatePoint::clear_cache_blocks() {
+  _impl_.cache_blocks_ = uint64_t{0u};
+}
+inline uint64_t HitRatePoint::_internal_cache_blocks() const {
+  return _impl_.cache_blocks_;
+}
+inline uint64_t HitRatePoint::cache_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.HitRatePoint.cache_blocks)
+  return _internal_cache_blocks();
+}
+inline void HitRatePoint::_internal_set_cache_blocks(uint64_t value) {
+  
+  _impl_.cache_blocks_ = value;
+}
+inline void HitRatePoint::set_cache_blocks(uint64_t value) {
+  _internal_set_cache_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.HitRatePoint.cache_blocks)
+}
+
+// double hit_rate = 2;
+inline void HitRatePoint::clear_hit_rate() {
+  _impl_.hit_rate_ = 0;
+}
+inline double HitRatePoint::_internal_hit_rate() const {
+  return _impl_.hit_rate_;
 }
-inline void ReadResponse::_internal_set_data(const std::string& value) {
-  
-  _impl_.data_.Set(value, GetArenaForAllocation());
+inline double HitRatePoint::hit_rate() const {
+  // @@protoc_insertion_point(field_get:fs.HitRatePoint.hit_rate)
+  return _internal_hit_rate();
 }
-inline std::string* ReadResponse::_internal_mutable_data() {
+inline void HitRatePoint::_internal_set_hit_rate(double value) {
   
-  return _impl_.data_.Mutable(GetArenaForAllocation());
-}
-inline std::string* ReadResponse::release_data() {
-  // @@protoc_insertion_point(field_release:fs.ReadResponse.data)
-  return _impl_.data_.Release();
+  _impl_.hit_rate_ = value;
 }
-inline void ReadResponse::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.data_.IsDefault()) {
-    _impl_.data_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.ReadResponse.data)
+inline void HitRatePoint::set_hit_rate(double value) {
+  _internal_set_hit_rate(value);
+  // @@protoc_insertion_point(field_set:fs.HitRatePoint.hit_rate)
 }
 
-// string error = 2;
-inline void ReadResponse::clear_error() {
+// -------------------------------------------------------------------
+
+// MountStatsResponse
+
+// string error = 1;
+inline void MountStatsResponse::clear_error() {
   _impl_.error_.ClearToEmpty();
 }
-inline const std::string& ReadResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.ReadResponse.error)
+inline const std::string& MountStatsResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ReadResponse::set_error(ArgT0&& arg0, ArgT... args) {
+void MountStatsResponse::set_error(ArgT0&& arg0, ArgT... args) {
  
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.ReadResponse.error)
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.error)
 }
-inline std::string* ReadResponse::mutable_error() {
+inline std::string* MountStatsResponse::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.ReadResponse.error)
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.error)
   return _s;
 }
-inline const std::string& ReadResponse::_internal_error() const {
+inline const std::string& MountStatsResponse::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void ReadResponse::_internal_set_error(const std::string& value) {
+inline void MountStatsResponse::_internal_set_error(const std::string& value) {
   
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReadResponse::_internal_mutable_error() {
+inline std::string* MountStatsResponse::_internal_mutable_error() {
   
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ReadResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.ReadResponse.error)
+inline std::string* MountStatsResponse::release_error() {
+  // @@protoc_insertion_point(field_release:fs.MountStatsResponse.error)
   return _impl_.error_.Release();
 }
-inline void ReadResponse::set_allocated_error(std::string* error) {
+inline void MountStatsResponse::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     
   } else {
@@ -3103,536 +6319,697 @@ inline void ReadResponse::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.ReadResponse.error)
-}
-
-// -------------------------------------------------------------------
-
-// WriteRequestMulti
-
-// int32 mount_id = 1;
-inline void WriteRequestMulti::clear_mount_id() {
-  _impl_.mount_id_ = 0;
-}
-inline int32_t WriteRequestMulti::_internal_mount_id() const {
-  return _impl_.mount_id_;
-}
-inline int32_t WriteRequestMulti::mount_id() const {
-  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.mount_id)
-  return _internal_mount_id();
-}
-inline void WriteRequestMulti::_internal_set_mount_id(int32_t value) {
-  
-  _impl_.mount_id_ = value;
-}
-inline void WriteRequestMulti::set_mount_id(int32_t value) {
-  _internal_set_mount_id(value);
-  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.mount_id)
+  // @@protoc_insertion_point(field_set_allocated:fs.MountStatsResponse.error)
 }
 
-// int32 fd = 2;
-inline void WriteRequestMulti::clear_fd() {
-  _impl_.fd_ = 0;
+// bool cache_enabled = 2;
+inline void MountStatsResponse::clear_cache_enabled() {
+  _impl_.cache_enabled_ = false;
 }
-inline int32_t WriteRequestMulti::_internal_fd() const {
-  return _impl_.fd_;
+inline bool MountStatsResponse::_internal_cache_enabled() const {
+  return _impl_.cache_enabled_;
 }
-inline int32_t WriteRequestMulti::fd() const {
-  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.fd)
-  return _internal_fd();
+inline bool MountStatsResponse::cache_enabled() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_enabled)
+  return _internal_cache_enabled();
 }
-inline void WriteRequestMulti::_internal_set_fd(int32_t value) {
+inline void MountStatsResponse::_internal_set_cache_enabled(bool value) {
   
-  _impl_.fd_ = value;
+  _impl_.cache_enabled_ = value;
 }
-inline void WriteRequestMulti::set_fd(int32_t value) {
-  _internal_set_fd(value);
-  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.fd)
+inline void MountStatsResponse::set_cache_enabled(bool value) {
+  _internal_set_cache_enabled(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_enabled)
 }
 
-// bytes data = 3;
-inline void WriteRequestMulti::clear_data() {
-  _impl_.data_.ClearToEmpty();
+// string cache_policy = 3;
+inline void MountStatsResponse::clear_cache_policy() {
+  _impl_.cache_policy_.ClearToEmpty();
 }
-inline const std::string& WriteRequestMulti::data() const {
-  // @@protoc_insertion_point(field_get:fs.WriteRequestMulti.data)
-  return _internal_data();
+inline const std::string& MountStatsResponse::cache_policy() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_policy)
+  return _internal_cache_policy();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void WriteRequestMulti::set_data(ArgT0&& arg0, ArgT... args) {
+void MountStatsResponse::set_cache_policy(ArgT0&& arg0, ArgT... args) {
  
- _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.WriteRequestMulti.data)
+ _impl_.cache_policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_policy)
 }
-inline std::string* WriteRequestMulti::mutable_data() {
-  std::string* _s = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:fs.WriteRequestMulti.data)
+inline std::string* MountStatsResponse::mutable_cache_policy() {
+  std::string* _s = _internal_mutable_cache_policy();
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.cache_policy)
   return _s;
 }
-inline const std::string& WriteRequestMulti::_internal_data() const {
-  return _impl_.data_.Get();
+inline const std::string& MountStatsResponse::_internal_cache_policy() const {
+  return _impl_.cache_policy_.Get();
 }
-inline void WriteRequestMulti::_internal_set_data(const std::string& value) {
+inline void MountStatsResponse::_internal_set_cache_policy(const std::string& value) {
   
-  _impl_.data_.Set(value, GetArenaForAllocation());
+  _impl_.cache_policy_.Set(value, GetArenaForAllocation());
 }
-inline std::string* WriteRequestMulti::_internal_mutable_data() {
+inline std::string* MountStatsResponse::_internal_mutable_cache_policy() {
   
-  return _impl_.data_.Mutable(GetArenaForAllocation());
+  return _impl_.cache_policy_.Mutable(GetArenaForAllocation());
 }
-inline std::string* WriteRequestMulti::release_data() {
-  // @@protoc_insertion_point(field_release:fs.WriteRequestMulti.data)
-  return _impl_.data_.Release();
+inline std::string* MountStatsResponse::release_cache_policy() {
+  // @@protoc_insertion_point(field_release:fs.MountStatsResponse.cache_policy)
+  return _impl_.cache_policy_.Release();
 }
-inline void WriteRequestMulti::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
+inline void MountStatsResponse::set_allocated_cache_policy(std::string* cache_policy) {
+  if (cache_policy != nullptr) {
     
   } else {
     
   }
-  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+  _impl_.cache_policy_.SetAllocated(cache_policy, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.data_.IsDefault()) {
-    _impl_.data_.Set("", GetArenaForAllocation());
+  if (_impl_.cache_policy_.IsDefault()) {
+    _impl_.cache_policy_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.WriteRequestMulti.data)
+  // @@protoc_insertion_point(field_set_allocated:fs.MountStatsResponse.cache_policy)
 }
 
-// -------------------------------------------------------------------
-
-// WriteResponse
-
-// bool success = 1;
-inline void WriteResponse::clear_success() {
-  _impl_.success_ = false;
+// uint64 cache_capacity = 4;
+inline void MountStatsResponse::clear_cache_capacity() {
+  _impl_.cache_capacity_ = uint64_t{0u};
 }
-inline bool WriteResponse::_internal_success() const {
-  return _impl_.success_;
+inline uint64_t MountStatsResponse::_internal_cache_capacity() const {
+  return _impl_.cache_capacity_;
 }
-inline bool WriteResponse::success() const {
-  // @@protoc_insertion_point(field_get:fs.WriteResponse.success)
-  return _internal_success();
+inline uint64_t MountStatsResponse::cache_capacity() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_capacity)
+  return _internal_cache_capacity();
 }
-inline void WriteResponse::_internal_set_success(bool value) {
+inline void MountStatsResponse::_internal_set_cache_capacity(uint64_t value) {
   
-  _impl_.success_ = value;
+  _impl_.cache_capacity_ = value;
 }
-inline void WriteResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:fs.WriteResponse.success)
+inline void MountStatsResponse::set_cache_capacity(uint64_t value) {
+  _internal_set_cache_capacity(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_capacity)
 }
 
-// string error = 2;
-inline void WriteResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
+// uint64 cached_blocks = 5;
+inline void MountStatsResponse::clear_cached_blocks() {
+  _impl_.cached_blocks_ = uint64_t{0u};
 }
-inline const std::string& WriteResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.WriteResponse.error)
-  return _internal_error();
+inline uint64_t MountStatsResponse::_internal_cached_blocks() const {
+  return _impl_.cached_blocks_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void WriteResponse::set_error(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.WriteResponse.error)
+inline uint64_t MountStatsResponse::cached_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cached_blocks)
+  return _internal_cached_blocks();
 }
-inline std::string* WriteResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.WriteResponse.error)
-  return _s;
+inline void MountStatsResponse::_internal_set_cached_blocks(uint64_t value) {
+  
+  _impl_.cached_blocks_ = value;
 }
-inline const std::string& WriteResponse::_internal_error() const {
-  return _impl_.error_.Get();
+inline void MountStatsResponse::set_cached_blocks(uint64_t value) {
+  _internal_set_cached_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cached_blocks)
 }
-inline void WriteResponse::_internal_set_error(const std::string& value) {
-  
-  _impl_.error_.Set(value, GetArenaForAllocation());
+
+// uint64 metadata_blocks = 6;
+inline void MountStatsResponse::clear_metadata_blocks() {
+  _impl_.metadata_blocks_ = uint64_t{0u};
 }
-inline std::string* WriteResponse::_internal_mutable_error() {
-  
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+inline uint64_t MountStatsResponse::_internal_metadata_blocks() const {
+  return _impl_.metadata_blocks_;
 }
-inline std::string* WriteResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.WriteResponse.error)
-  return _impl_.error_.Release();
+inline uint64_t MountStatsResponse::metadata_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.metadata_blocks)
+  return _internal_metadata_blocks();
 }
-inline void WriteResponse::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.WriteResponse.error)
+inline void MountStatsResponse::_internal_set_metadata_blocks(uint64_t value) {
+  
+  _impl_.metadata_blocks_ = value;
+}
+inline void MountStatsResponse::set_metadata_blocks(uint64_t value) {
+  _internal_set_metadata_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.metadata_blocks)
 }
 
-// -------------------------------------------------------------------
+// uint64 dirty_blocks = 7;
+inline void MountStatsResponse::clear_dirty_blocks() {
+  _impl_.dirty_blocks_ = uint64_t{0u};
+}
+inline uint64_t MountStatsResponse::_internal_dirty_blocks() const {
+  return _impl_.dirty_blocks_;
+}
+inline uint64_t MountStatsResponse::dirty_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.dirty_blocks)
+  return _internal_dirty_blocks();
+}
+inline void MountStatsResponse::_internal_set_dirty_blocks(uint64_t value) {
+  
+  _impl_.dirty_blocks_ = value;
+}
+inline void MountStatsResponse::set_dirty_blocks(uint64_t value) {
+  _internal_set_dirty_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.dirty_blocks)
+}
 
-// SeekRequestMulti
+// repeated .fs.BlockClassStats block_classes = 8;
+inline int MountStatsResponse::_internal_block_classes_size() const {
+  return _impl_.block_classes_.size();
+}
+inline int MountStatsResponse::block_classes_size() const {
+  return _internal_block_classes_size();
+}
+inline void MountStatsResponse::clear_block_classes() {
+  _impl_.block_classes_.Clear();
+}
+inline ::fs::BlockClassStats* MountStatsResponse::mutable_block_classes(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.block_classes)
+  return _impl_.block_classes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::BlockClassStats >*
+MountStatsResponse::mutable_block_classes() {
+  // @@protoc_insertion_point(field_mutable_list:fs.MountStatsResponse.block_classes)
+  return &_impl_.block_classes_;
+}
+inline const ::fs::BlockClassStats& MountStatsResponse::_internal_block_classes(int index) const {
+  return _impl_.block_classes_.Get(index);
+}
+inline const ::fs::BlockClassStats& MountStatsResponse::block_classes(int index) const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.block_classes)
+  return _internal_block_classes(index);
+}
+inline ::fs::BlockClassStats* MountStatsResponse::_internal_add_block_classes() {
+  return _impl_.block_classes_.Add();
+}
+inline ::fs::BlockClassStats* MountStatsResponse::add_block_classes() {
+  ::fs::BlockClassStats* _add = _internal_add_block_classes();
+  // @@protoc_insertion_point(field_add:fs.MountStatsResponse.block_classes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::BlockClassStats >&
+MountStatsResponse::block_classes() const {
+  // @@protoc_insertion_point(field_list:fs.MountStatsResponse.block_classes)
+  return _impl_.block_classes_;
+}
 
-// int32 mount_id = 1;
-inline void SeekRequestMulti::clear_mount_id() {
-  _impl_.mount_id_ = 0;
+// uint64 prefetched = 9;
+inline void MountStatsResponse::clear_prefetched() {
+  _impl_.prefetched_ = uint64_t{0u};
 }
-inline int32_t SeekRequestMulti::_internal_mount_id() const {
-  return _impl_.mount_id_;
+inline uint64_t MountStatsResponse::_internal_prefetched() const {
+  return _impl_.prefetched_;
 }
-inline int32_t SeekRequestMulti::mount_id() const {
-  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.mount_id)
-  return _internal_mount_id();
+inline uint64_t MountStatsResponse::prefetched() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.prefetched)
+  return _internal_prefetched();
 }
-inline void SeekRequestMulti::_internal_set_mount_id(int32_t value) {
+inline void MountStatsResponse::_internal_set_prefetched(uint64_t value) {
   
-  _impl_.mount_id_ = value;
+  _impl_.prefetched_ = value;
 }
-inline void SeekRequestMulti::set_mount_id(int32_t value) {
-  _internal_set_mount_id(value);
-  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.mount_id)
+inline void MountStatsResponse::set_prefetched(uint64_t value) {
+  _internal_set_prefetched(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.prefetched)
 }
 
-// int32 fd = 2;
-inline void SeekRequestMulti::clear_fd() {
-  _impl_.fd_ = 0;
+// uint64 prefetch_hits = 10;
+inline void MountStatsResponse::clear_prefetch_hits() {
+  _impl_.prefetch_hits_ = uint64_t{0u};
 }
-inline int32_t SeekRequestMulti::_internal_fd() const {
-  return _impl_.fd_;
+inline uint64_t MountStatsResponse::_internal_prefetch_hits() const {
+  return _impl_.prefetch_hits_;
 }
-inline int32_t SeekRequestMulti::fd() const {
-  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.fd)
-  return _internal_fd();
+inline uint64_t MountStatsResponse::prefetch_hits() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.prefetch_hits)
+  return _internal_prefetch_hits();
 }
-inline void SeekRequestMulti::_internal_set_fd(int32_t value) {
+inline void MountStatsResponse::_internal_set_prefetch_hits(uint64_t value) {
   
-  _impl_.fd_ = value;
+  _impl_.prefetch_hits_ = value;
 }
-inline void SeekRequestMulti::set_fd(int32_t value) {
-  _internal_set_fd(value);
-  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.fd)
+inline void MountStatsResponse::set_prefetch_hits(uint64_t value) {
+  _internal_set_prefetch_hits(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.prefetch_hits)
 }
 
-// int32 offset = 3;
-inline void SeekRequestMulti::clear_offset() {
-  _impl_.offset_ = 0;
+// .fs.LatencyStats cache_miss = 11;
+inline bool MountStatsResponse::_internal_has_cache_miss() const {
+  return this != internal_default_instance() && _impl_.cache_miss_ != nullptr;
 }
-inline int32_t SeekRequestMulti::_internal_offset() const {
-  return _impl_.offset_;
+inline bool MountStatsResponse::has_cache_miss() const {
+  return _internal_has_cache_miss();
 }
-inline int32_t SeekRequestMulti::offset() const {
-  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.offset)
-  return _internal_offset();
+inline void MountStatsResponse::clear_cache_miss() {
+  if (GetArenaForAllocation() == nullptr && _impl_.cache_miss_ != nullptr) {
+    delete _impl_.cache_miss_;
+  }
+  _impl_.cache_miss_ = nullptr;
 }
-inline void SeekRequestMulti::_internal_set_offset(int32_t value) {
+inline const ::fs::LatencyStats& MountStatsResponse::_internal_cache_miss() const {
+  const ::fs::LatencyStats* p = _impl_.cache_miss_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::LatencyStats&>(
+      ::fs::_LatencyStats_default_instance_);
+}
+inline const ::fs::LatencyStats& MountStatsResponse::cache_miss() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_miss)
+  return _internal_cache_miss();
+}
+inline void MountStatsResponse::unsafe_arena_set_allocated_cache_miss(
+    ::fs::LatencyStats* cache_miss) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cache_miss_);
+  }
+  _impl_.cache_miss_ = cache_miss;
+  if (cache_miss) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.MountStatsResponse.cache_miss)
+}
+inline ::fs::LatencyStats* MountStatsResponse::release_cache_miss() {
   
-  _impl_.offset_ = value;
+  ::fs::LatencyStats* temp = _impl_.cache_miss_;
+  _impl_.cache_miss_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::LatencyStats* MountStatsResponse::unsafe_arena_release_cache_miss() {
+  // @@protoc_insertion_point(field_release:fs.MountStatsResponse.cache_miss)
+  
+  ::fs::LatencyStats* temp = _impl_.cache_miss_;
+  _impl_.cache_miss_ = nullptr;
+  return temp;
 }
-inline void SeekRequestMulti::set_offset(int32_t value) {
-  _internal_set_offset(value);
-  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.offset)
+inline ::fs::LatencyStats* MountStatsResponse::_internal_mutable_cache_miss() {
+  
+  if (_impl_.cache_miss_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::LatencyStats>(GetArenaForAllocation());
+    _impl_.cache_miss_ = p;
+  }
+  return _impl_.cache_miss_;
+}
+inline ::fs::LatencyStats* MountStatsResponse::mutable_cache_miss() {
+  ::fs::LatencyStats* _msg = _internal_mutable_cache_miss();
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.cache_miss)
+  return _msg;
+}
+inline void MountStatsResponse::set_allocated_cache_miss(::fs::LatencyStats* cache_miss) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cache_miss_;
+  }
+  if (cache_miss) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cache_miss);
+    if (message_arena != submessage_arena) {
+      cache_miss = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cache_miss, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.cache_miss_ = cache_miss;
+  // @@protoc_insertion_point(field_set_allocated:fs.MountStatsResponse.cache_miss)
 }
 
-// int32 whence = 4;
-inline void SeekRequestMulti::clear_whence() {
-  _impl_.whence_ = 0;
+// repeated .fs.HitRatePoint hit_rate_curve = 12;
+inline int MountStatsResponse::_internal_hit_rate_curve_size() const {
+  return _impl_.hit_rate_curve_.size();
 }
-inline int32_t SeekRequestMulti::_internal_whence() const {
-  return _impl_.whence_;
+inline int MountStatsResponse::hit_rate_curve_size() const {
+  return _internal_hit_rate_curve_size();
 }
-inline int32_t SeekRequestMulti::whence() const {
-  // @@protoc_insertion_point(field_get:fs.SeekRequestMulti.whence)
-  return _internal_whence();
+inline void MountStatsResponse::clear_hit_rate_curve() {
+  _impl_.hit_rate_curve_.Clear();
 }
-inline void SeekRequestMulti::_internal_set_whence(int32_t value) {
-  
-  _impl_.whence_ = value;
+inline ::fs::HitRatePoint* MountStatsResponse::mutable_hit_rate_curve(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.hit_rate_curve)
+  return _impl_.hit_rate_curve_.Mutable(index);
 }
-inline void SeekRequestMulti::set_whence(int32_t value) {
-  _internal_set_whence(value);
-  // @@protoc_insertion_point(field_set:fs.SeekRequestMulti.whence)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::HitRatePoint >*
+MountStatsResponse::mutable_hit_rate_curve() {
+  // @@protoc_insertion_point(field_mutable_list:fs.MountStatsResponse.hit_rate_curve)
+  return &_impl_.hit_rate_curve_;
+}
+inline const ::fs::HitRatePoint& MountStatsResponse::_internal_hit_rate_curve(int index) const {
+  return _impl_.hit_rate_curve_.Get(index);
+}
+inline const ::fs::HitRatePoint& MountStatsResponse::hit_rate_curve(int index) const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.hit_rate_curve)
+  return _internal_hit_rate_curve(index);
+}
+inline ::fs::HitRatePoint* MountStatsResponse::_internal_add_hit_rate_curve() {
+  return _impl_.hit_rate_curve_.Add();
+}
+inline ::fs::HitRatePoint* MountStatsResponse::add_hit_rate_curve() {
+  ::fs::HitRatePoint* _add = _internal_add_hit_rate_curve();
+  // @@protoc_insertion_point(field_add:fs.MountStatsResponse.hit_rate_curve)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::HitRatePoint >&
+MountStatsResponse::hit_rate_curve() const {
+  // @@protoc_insertion_point(field_list:fs.MountStatsResponse.hit_rate_curve)
+  return _impl_.hit_rate_curve_;
 }
 
-// -------------------------------------------------------------------
-
-// SeekResponse
-
-// bool success = 1;
-inline void SeekResponse::clear_success() {
-  _impl_.success_ = false;
+// repeated .fs.LatencyStats disk = 13;
+inline int MountStatsResponse::_internal_disk_size() const {
+  return _impl_.disk_.size();
 }
-inline bool SeekResponse::_internal_success() const {
-  return _impl_.success_;
+inline int MountStatsResponse::disk_size() const {
+  return _internal_disk_size();
 }
-inline bool SeekResponse::success() const {
-  // @@protoc_insertion_point(field_get:fs.SeekResponse.success)
-  return _internal_success();
+inline void MountStatsResponse::clear_disk() {
+  _impl_.disk_.Clear();
 }
-inline void SeekResponse::_internal_set_success(bool value) {
-  
-  _impl_.success_ = value;
+inline ::fs::LatencyStats* MountStatsResponse::mutable_disk(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.disk)
+  return _impl_.disk_.Mutable(index);
 }
-inline void SeekResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:fs.SeekResponse.success)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::LatencyStats >*
+MountStatsResponse::mutable_disk() {
+  // @@protoc_insertion_point(field_mutable_list:fs.MountStatsResponse.disk)
+  return &_impl_.disk_;
+}
+inline const ::fs::LatencyStats& MountStatsResponse::_internal_disk(int index) const {
+  return _impl_.disk_.Get(index);
+}
+inline const ::fs::LatencyStats& MountStatsResponse::disk(int index) const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.disk)
+  return _internal_disk(index);
+}
+inline ::fs::LatencyStats* MountStatsResponse::_internal_add_disk() {
+  return _impl_.disk_.Add();
+}
+inline ::fs::LatencyStats* MountStatsResponse::add_disk() {
+  ::fs::LatencyStats* _add = _internal_add_disk();
+  // @@protoc_insertion_point(field_add:fs.MountStatsResponse.disk)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::LatencyStats >&
+MountStatsResponse::disk() const {
+  // @@protoc_insertion_point(field_list:fs.MountStatsResponse.disk)
+  return _impl_.disk_;
 }
 
-// string error = 2;
-inline void SeekResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
+// string io_engine = 14;
+inline void MountStatsResponse::clear_io_engine() {
+  _impl_.io_engine_.ClearToEmpty();
 }
-inline const std::string& SeekResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.SeekResponse.error)
-  return _internal_error();
+inline const std::string& MountStatsResponse::io_engine() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.io_engine)
+  return _internal_io_engine();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SeekResponse::set_error(ArgT0&& arg0, ArgT... args) {
+void MountStatsResponse::set_io_engine(ArgT0&& arg0, ArgT... args) {
  
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.SeekResponse.error)
+ _impl_.io_engine_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.io_engine)
 }
-inline std::string* SeekResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.SeekResponse.error)
+inline std::string* MountStatsResponse::mutable_io_engine() {
+  std::string* _s = _internal_mutable_io_engine();
+  // @@protoc_insertion_point(field_mutable:fs.MountStatsResponse.io_engine)
   return _s;
 }
-inline const std::string& SeekResponse::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& MountStatsResponse::_internal_io_engine() const {
+  return _impl_.io_engine_.Get();
 }
-inline void SeekResponse::_internal_set_error(const std::string& value) {
+inline void MountStatsResponse::_internal_set_io_engine(const std::string& value) {
   
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.io_engine_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SeekResponse::_internal_mutable_error() {
+inline std::string* MountStatsResponse::_internal_mutable_io_engine() {
   
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.io_engine_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SeekResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.SeekResponse.error)
-  return _impl_.error_.Release();
+inline std::string* MountStatsResponse::release_io_engine() {
+  // @@protoc_insertion_point(field_release:fs.MountStatsResponse.io_engine)
+  return _impl_.io_engine_.Release();
 }
-inline void SeekResponse::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void MountStatsResponse::set_allocated_io_engine(std::string* io_engine) {
+  if (io_engine != nullptr) {
     
   } else {
     
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.io_engine_.SetAllocated(io_engine, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.io_engine_.IsDefault()) {
+    _impl_.io_engine_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.SeekResponse.error)
+  // @@protoc_insertion_point(field_set_allocated:fs.MountStatsResponse.io_engine)
 }
 
-// -------------------------------------------------------------------
-
-// ListdirResponse
-
-// repeated string entries = 1;
-inline int ListdirResponse::_internal_entries_size() const {
-  return _impl_.entries_.size();
+// bool cache_shared = 15;
+inline void MountStatsResponse::clear_cache_shared() {
+  _impl_.cache_shared_ = false;
 }
-inline int ListdirResponse::entries_size() const {
-  return _internal_entries_size();
+inline bool MountStatsResponse::_internal_cache_shared() const {
+  return _impl_.cache_shared_;
 }
-inline void ListdirResponse::clear_entries() {
-  _impl_.entries_.Clear();
+inline bool MountStatsResponse::cache_shared() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_shared)
+  return _internal_cache_shared();
 }
-inline std::string* ListdirResponse::add_entries() {
-  std::string* _s = _internal_add_entries();
-  // @@protoc_insertion_point(field_add_mutable:fs.ListdirResponse.entries)
-  return _s;
+inline void MountStatsResponse::_internal_set_cache_shared(bool value) {
+  
+  _impl_.cache_shared_ = value;
 }
-inline const std::string& ListdirResponse::_internal_entries(int index) const {
-  return _impl_.entries_.Get(index);
+inline void MountStatsResponse::set_cache_shared(bool value) {
+  _internal_set_cache_shared(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_shared)
 }
-inline const std::string& ListdirResponse::entries(int index) const {
-  // @@protoc_insertion_point(field_get:fs.ListdirResponse.entries)
-  return _internal_entries(index);
+
+// uint64 cache_quota_blocks = 16;
+inline void MountStatsResponse::clear_cache_quota_blocks() {
+  _impl_.cache_quota_blocks_ = uint64_t{0u};
 }
-inline std::string* ListdirResponse::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:fs.ListdirResponse.entries)
-  return _impl_.entries_.Mutable(index);
+inline uint64_t MountStatsResponse::_internal_cache_quota_blocks() const {
+  return _impl_.cache_quota_blocks_;
 }
-inline void ListdirResponse::set_entries(int index, const std::string& value) {
-  _impl_.entries_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:fs.ListdirResponse.entries)
+inline uint64_t MountStatsResponse::cache_quota_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_quota_blocks)
+  return _internal_cache_quota_blocks();
 }
-inline void ListdirResponse::set_entries(int index, std::string&& value) {
-  _impl_.entries_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:fs.ListdirResponse.entries)
+inline void MountStatsResponse::_internal_set_cache_quota_blocks(uint64_t value) {
+  
+  _impl_.cache_quota_blocks_ = value;
 }
-inline void ListdirResponse::set_entries(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.entries_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:fs.ListdirResponse.entries)
+inline void MountStatsResponse::set_cache_quota_blocks(uint64_t value) {
+  _internal_set_cache_quota_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_quota_blocks)
 }
-inline void ListdirResponse::set_entries(int index, const char* value, size_t size) {
-  _impl_.entries_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:fs.ListdirResponse.entries)
+
+// uint64 cache_reserved_blocks = 17;
+inline void MountStatsResponse::clear_cache_reserved_blocks() {
+  _impl_.cache_reserved_blocks_ = uint64_t{0u};
 }
-inline std::string* ListdirResponse::_internal_add_entries() {
-  return _impl_.entries_.Add();
+inline uint64_t MountStatsResponse::_internal_cache_reserved_blocks() const {
+  return _impl_.cache_reserved_blocks_;
 }
-inline void ListdirResponse::add_entries(const std::string& value) {
-  _impl_.entries_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:fs.ListdirResponse.entries)
+inline uint64_t MountStatsResponse::cache_reserved_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_reserved_blocks)
+  return _internal_cache_reserved_blocks();
 }
-inline void ListdirResponse::add_entries(std::string&& value) {
-  _impl_.entries_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:fs.ListdirResponse.entries)
+inline void MountStatsResponse::_internal_set_cache_reserved_blocks(uint64_t value) {
+  
+  _impl_.cache_reserved_blocks_ = value;
 }
-inline void ListdirResponse::add_entries(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.entries_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:fs.ListdirResponse.entries)
+inline void MountStatsResponse::set_cache_reserved_blocks(uint64_t value) {
+  _internal_set_cache_reserved_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_reserved_blocks)
 }
-inline void ListdirResponse::add_entries(const char* value, size_t size) {
-  _impl_.entries_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:fs.ListdirResponse.entries)
+
+// uint64 cache_total_blocks = 18;
+inline void MountStatsResponse::clear_cache_total_blocks() {
+  _impl_.cache_total_blocks_ = uint64_t{0u};
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ListdirResponse::entries() const {
-  // @@protoc_insertion_point(field_list:fs.ListdirResponse.entries)
-  return _impl_.entries_;
+inline uint64_t MountStatsResponse::_internal_cache_total_blocks() const {
+  return _impl_.cache_total_blocks_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ListdirResponse::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:fs.ListdirResponse.entries)
-  return &_impl_.entries_;
+inline uint64_t MountStatsResponse::cache_total_blocks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.cache_total_blocks)
+  return _internal_cache_total_blocks();
 }
-
-// string error = 2;
-inline void ListdirResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
+inline void MountStatsResponse::_internal_set_cache_total_blocks(uint64_t value) {
+  
+  _impl_.cache_total_blocks_ = value;
 }
-inline const std::string& ListdirResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.ListdirResponse.error)
-  return _internal_error();
+inline void MountStatsResponse::set_cache_total_blocks(uint64_t value) {
+  _internal_set_cache_total_blocks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.cache_total_blocks)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ListdirResponse::set_error(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.ListdirResponse.error)
+
+// uint64 icache_inodes = 19;
+inline void MountStatsResponse::clear_icache_inodes() {
+  _impl_.icache_inodes_ = uint64_t{0u};
 }
-inline std::string* ListdirResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.ListdirResponse.error)
-  return _s;
+inline uint64_t MountStatsResponse::_internal_icache_inodes() const {
+  return _impl_.icache_inodes_;
 }
-inline const std::string& ListdirResponse::_internal_error() const {
-  return _impl_.error_.Get();
+inline uint64_t MountStatsResponse::icache_inodes() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.icache_inodes)
+  return _internal_icache_inodes();
 }
-inline void ListdirResponse::_internal_set_error(const std::string& value) {
+inline void MountStatsResponse::_internal_set_icache_inodes(uint64_t value) {
   
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.icache_inodes_ = value;
 }
-inline std::string* ListdirResponse::_internal_mutable_error() {
-  
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+inline void MountStatsResponse::set_icache_inodes(uint64_t value) {
+  _internal_set_icache_inodes(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.icache_inodes)
 }
-inline std::string* ListdirResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.ListdirResponse.error)
-  return _impl_.error_.Release();
+
+// uint64 icache_hits = 20;
+inline void MountStatsResponse::clear_icache_hits() {
+  _impl_.icache_hits_ = uint64_t{0u};
 }
-inline void ListdirResponse::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.ListdirResponse.error)
+inline uint64_t MountStatsResponse::_internal_icache_hits() const {
+  return _impl_.icache_hits_;
+}
+inline uint64_t MountStatsResponse::icache_hits() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.icache_hits)
+  return _internal_icache_hits();
+}
+inline void MountStatsResponse::_internal_set_icache_hits(uint64_t value) {
+  
+  _impl_.icache_hits_ = value;
+}
+inline void MountStatsResponse::set_icache_hits(uint64_t value) {
+  _internal_set_icache_hits(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.icache_hits)
 }
 
-// -------------------------------------------------------------------
-
-// RemoveResponse
+// uint64 icache_misses = 21;
+inline void MountStatsResponse::clear_icache_misses() {
+  _impl_.icache_misses_ = uint64_t{0u};
+}
+inline uint64_t MountStatsResponse::_internal_icache_misses() const {
+  return _impl_.icache_misses_;
+}
+inline uint64_t MountStatsResponse::icache_misses() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.icache_misses)
+  return _internal_icache_misses();
+}
+inline void MountStatsResponse::_internal_set_icache_misses(uint64_t value) {
+  
+  _impl_.icache_misses_ = value;
+}
+inline void MountStatsResponse::set_icache_misses(uint64_t value) {
+  _internal_set_icache_misses(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.icache_misses)
+}
 
-// bool success = 1;
-inline void RemoveResponse::clear_success() {
-  _impl_.success_ = false;
+// uint64 icache_writebacks = 22;
+inline void MountStatsResponse::clear_icache_writebacks() {
+  _impl_.icache_writebacks_ = uint64_t{0u};
 }
-inline bool RemoveResponse::_internal_success() const {
-  return _impl_.success_;
+inline uint64_t MountStatsResponse::_internal_icache_writebacks() const {
+  return _impl_.icache_writebacks_;
 }
-inline bool RemoveResponse::success() const {
-  // @@protoc_insertion_point(field_get:fs.RemoveResponse.success)
-  return _internal_success();
+inline uint64_t MountStatsResponse::icache_writebacks() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.icache_writebacks)
+  return _internal_icache_writebacks();
 }
-inline void RemoveResponse::_internal_set_success(bool value) {
+inline void MountStatsResponse::_internal_set_icache_writebacks(uint64_t value) {
   
-  _impl_.success_ = value;
+  _impl_.icache_writebacks_ = value;
 }
-inline void RemoveResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:fs.RemoveResponse.success)
+inline void MountStatsResponse::set_icache_writebacks(uint64_t value) {
+  _internal_set_icache_writebacks(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.icache_writebacks)
 }
 
-// string error = 2;
-inline void RemoveResponse::clear_error() {
-  _impl_.error_.ClearToEmpty();
+// uint64 dentries = 23;
+inline void MountStatsResponse::clear_dentries() {
+  _impl_.dentries_ = uint64_t{0u};
 }
-inline const std::string& RemoveResponse::error() const {
-  // @@protoc_insertion_point(field_get:fs.RemoveResponse.error)
-  return _internal_error();
+inline uint64_t MountStatsResponse::_internal_dentries() const {
+  return _impl_.dentries_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RemoveResponse::set_error(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:fs.RemoveResponse.error)
+inline uint64_t MountStatsResponse::dentries() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.dentries)
+  return _internal_dentries();
 }
-inline std::string* RemoveResponse::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:fs.RemoveResponse.error)
-  return _s;
+inline void MountStatsResponse::_internal_set_dentries(uint64_t value) {
+  
+  _impl_.dentries_ = value;
 }
-inline const std::string& RemoveResponse::_internal_error() const {
-  return _impl_.error_.Get();
+inline void MountStatsResponse::set_dentries(uint64_t value) {
+  _internal_set_dentries(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.dentries)
 }
-inline void RemoveResponse::_internal_set_error(const std::string& value) {
+
+// uint64 dentry_hits = 24;
+inline void MountStatsResponse::clear_dentry_hits() {
+  _impl_.dentry_hits_ = uint64_t{0u};
+}
+inline uint64_t MountStatsResponse::_internal_dentry_hits() const {
+  return _impl_.dentry_hits_;
+}
+inline uint64_t MountStatsResponse::dentry_hits() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.dentry_hits)
+  return _internal_dentry_hits();
+}
+inline void MountStatsResponse::_internal_set_dentry_hits(uint64_t value) {
   
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.dentry_hits_ = value;
 }
-inline std::string* RemoveResponse::_internal_mutable_error() {
+inline void MountStatsResponse::set_dentry_hits(uint64_t value) {
+  _internal_set_dentry_hits(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.dentry_hits)
+}
+
+// uint64 dentry_misses = 25;
+inline void MountStatsResponse::clear_dentry_misses() {
+  _impl_.dentry_misses_ = uint64_t{0u};
+}
+inline uint64_t MountStatsResponse::_internal_dentry_misses() const {
+  return _impl_.dentry_misses_;
+}
+inline uint64_t MountStatsResponse::dentry_misses() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.dentry_misses)
+  return _internal_dentry_misses();
+}
+inline void MountStatsResponse::_internal_set_dentry_misses(uint64_t value) {
   
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  _impl_.dentry_misses_ = value;
 }
-inline std::string* RemoveResponse::release_error() {
-  // @@protoc_insertion_point(field_release:fs.RemoveResponse.error)
-  return _impl_.error_.Release();
+inline void MountStatsResponse::set_dentry_misses(uint64_t value) {
+  _internal_set_dentry_misses(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.dentry_misses)
 }
-inline void RemoveResponse::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:fs.RemoveResponse.error)
+
+// uint64 path_hits = 26;
+inline void MountStatsResponse::clear_path_hits() {
+  _impl_.path_hits_ = uint64_t{0u};
+}
+inline uint64_t MountStatsResponse::_internal_path_hits() const {
+  return _impl_.path_hits_;
+}
+inline uint64_t MountStatsResponse::path_hits() const {
+  // @@protoc_insertion_point(field_get:fs.MountStatsResponse.path_hits)
+  return _internal_path_hits();
+}
+inline void MountStatsResponse::_internal_set_path_hits(uint64_t value) {
+  
+  _impl_.path_hits_ = value;
+}
+inline void MountStatsResponse::set_path_hits(uint64_t value) {
+  _internal_set_path_hits(value);
+  // @@protoc_insertion_point(field_set:fs.MountStatsResponse.path_hits)
 }
 
 #ifdef __GNUC__
@@ -3664,6 +7041,22 @@ inline void RemoveResponse::set_allocated_error(std::string* error) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3,18 +3,36 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include "disk.h"
 #include "block_cache_controller.h"
+#include "superblock.h"
+#include "bitmap.h"
+#include "bmap.h"
+#include "icache.h"
+#include "dcache.h"
+
+// Per-fd sequential read detection, driving readahead in sfs_read. Block numbers are file blocks.
+struct Readahead {
+    int prev = -1;   // last block the previous read touched
+    int start = 0;   // first block of the newest readahead window
+    int size = 0;    // its length; 0 while reads are not sequential
+    int marker = 0;  // a read reaching this block issues the next window
+};
 
 struct OpenFile {
     int inum;
     int offset;
+    Readahead ra;
+    BmapRun map; // last mapped run resolved through this fd
+    Inode* ino = nullptr; // pinned in FSContext::icache while the fd is open
 };
 
 struct FSContext {
     std::string disk_image;
-    std::vector<bool> block_bitmap;
-    std::vector<bool> inode_bitmap;
+    Bitmap block_bitmap; // loaded by block_manager_init, written through on every change
+    Bitmap inode_bitmap;
     
     // File descriptor table & allocator
     std::map<int, OpenFile> fd_table;
@@ -25,11 +43,44 @@ struct FSContext {
     std::shared_ptr<Disk> disk;
     std::shared_ptr<BlockCacheController> cache_controller; 
     bool use_cache = true; // toggle default
+    CachePolicy cache_policy = CachePolicy::LRU; // replacement policy for init_cache
+    std::shared_ptr<BlockCache> shared_cache; // fs_server's process-wide cache; null for a private one
+    size_t cache_blocks = 0;          // quota in the shared cache, size of a private one (0: no quota / CACHE_NUM_BLOCKS)
+    size_t cache_reserved_blocks = 0; // shared cache only: blocks other mounts cannot take
+    IOEngineKind io_engine = IOEngineKind::Auto; // async engine for batched I/O, read by sfs_init
+    DiskMode disk_mode = DiskMode::Buffered; // buffered, O_DIRECT or mmap, read by sfs_init
+    FSGeometry geometry;      // used only when sfs_init has to format the image
+    bool preallocate = false; // fallocate a newly created image instead of leaving it sparse
+    Superblock sb{};          // geometry of the mounted image
+    InodeCache icache;        // decoded inodes; dirty ones are written back at the latest on unmount
+    DentryCache dcache;       // name and path lookups, kept current by dir_add/dir_remove
+
+    // fs_server runs Read and Listdir under a shared op_mutex, so reads on one mount proceed in
+    // parallel; everything else takes it exclusively. A read also holds its fd's stripe, which
+    // guards that fd's offset.
+    std::shared_mutex op_mutex;
+    static constexpr int FD_LOCK_STRIPES = 16;
+    std::mutex fd_locks[FD_LOCK_STRIPES];
+    std::mutex& fd_lock(int fd) { return fd_locks[(unsigned)fd % FD_LOCK_STRIPES]; }
 
     FSContext(uint64_t id) : mount_id(id) {}
+    // Dirty inodes go to their table blocks before the cache controller writes those back
+    ~FSContext() {
+        if (disk) icache.syncAll(*this);
+    }
 
-    void init_cache(size_t cache_capacity_blocks, size_t block_size) {
+    // Attaches to shared_cache when it runs cache_policy, otherwise builds a private cache.
+    // False if the reservation does not fit in the shared cache.
+    bool init_cache() {
         if (!disk) throw std::runtime_error("Disk must be initialized before cache.");
-        cache_controller = std::make_shared<BlockCacheController>(cache_capacity_blocks, block_size, disk);
+        // Detaching writes back what only the old cache has seen (e.g. the root inode)
+        cache_controller.reset();
+        if (shared_cache && shared_cache->policy() == cache_policy) {
+            cache_controller = BlockCacheController::attach(shared_cache, disk, cache_reserved_blocks, cache_blocks);
+            return cache_controller != nullptr;
+        }
+        size_t capacity = cache_blocks > 0 ? cache_blocks : CACHE_NUM_BLOCKS;
+        cache_controller = std::make_shared<BlockCacheController>(capacity, BLOCK_SIZE, disk, cache_policy);
+        return true;
     }
 };
@@ -4,6 +4,7 @@
 #include "sfs.h"
 #include "fs_context.h"
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 #include <unordered_map>
 #include <iostream>
@@ -35,45 +36,90 @@ using fs::SeekResponse;
 
 using fs::ListdirResponse;
 using fs::RemoveResponse;
+using fs::FdRequest;
+using fs::CloseResponse;
+using fs::FsyncResponse;
+
+using fs::MountStatsRequest;
+using fs::MountStatsResponse;
+using fs::LatencyStats;
+
+static void fill_latency(LatencyStats* out, const char* op, const LatencyHistogram& latency) {
+    out->set_op(op);
+    out->set_count(latency.count());
+    out->set_mean_us(latency.mean());
+    out->set_p50_us(latency.percentile(0.50));
+    out->set_p99_us(latency.percentile(0.99));
+    out->set_max_us(latency.max());
+}
+
+static void fill_io(LatencyStats* out, const char* op, const IOOpStats& io) {
+    fill_latency(out, op, io.latency);
+    out->set_count(io.ops.load());
+    out->set_blocks(io.blocks.load());
+    out->set_errors(io.errors.load());
+}
 
 class FileSystemServiceImpl final : public FileSystem::Service {
-    std::mutex mu_;
+    std::mutex mu_; // guards the mount table; each mount serializes its own ops (FSContext::op_mutex)
     int next_mount_id_ = 1;
+    std::shared_ptr<BlockCache> cache_; // shared by the mounts; declared first so it outlives them
     std::unordered_map<int, std::unique_ptr<FSContext>> contexts_;
 
+    // Mounts are never removed, so the pointer stays valid after the lock is dropped
     FSContext* get_ctx(int mid) {
+        std::lock_guard<std::mutex> lk(mu_);
         auto it = contexts_.find(mid);
         return it == contexts_.end() ? nullptr : it->second.get();
     }
 public:
+    explicit FileSystemServiceImpl(std::shared_ptr<BlockCache> cache) : cache_(std::move(cache)) {}
+
     Status Mount(ServerContext*, const MountRequest* req, MountResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
-        
-        int id = next_mount_id_++;
+        int id;
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            id = next_mount_id_++;
+        }
         auto ctx = std::make_unique<FSContext>(id);
+        ctx->use_cache = req->enable_cache() && !req->mmap_io(); // the mapping already is the cache
+        if (req->mmap_io()) ctx->disk_mode = DiskMode::Mapped;
+        else if (req->direct_io()) ctx->disk_mode = DiskMode::Direct;
+        ctx->geometry.num_blocks = req->num_blocks();
+        ctx->geometry.num_inodes = req->num_inodes();
+        ctx->preallocate = req->preallocate();
+        auto policy = parse_cache_policy(req->cache_policy());
+        if (!policy) {
+            res->set_error("Unknown cache_policy " + req->cache_policy());
+            return Status::OK;
+        }
+        // Mounts on the shared cache's policy share it; any other gets a private cache
+        ctx->cache_policy = req->cache_policy().empty() ? cache_->policy() : *policy;
+        ctx->shared_cache = cache_;
+        ctx->cache_blocks = req->cache_blocks() > 0 ? req->cache_blocks() : 0;
+        ctx->cache_reserved_blocks = req->cache_reserved_blocks();
+        if (req->io_engine() == "io_uring") ctx->io_engine = IOEngineKind::Uring;
+        else if (req->io_engine() == "threads") ctx->io_engine = IOEngineKind::ThreadPool;
     
         if (!sfs_init(*ctx, req->disk_image())) {
             res->set_error("Failed to initialize FS on " + req->disk_image());
             return Status::OK;
         }
-        ctx->use_cache = req->enable_cache();
-        if (ctx->use_cache) {
-            const size_t block_size = BLOCK_SIZE;
-            const size_t cache_blocks = req->cache_blocks();
-            ctx->init_cache(cache_blocks, block_size);
-        } 
-        contexts_[id] = std::move(ctx);
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            contexts_[id] = std::move(ctx);
+        }
         res->set_mount_id(id);
         return Status::OK;
     }
 
     Status Create(ServerContext*, const FileRequest* req, CreateResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id"); 
             return Status::OK; 
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         
         int inum = sfs_create(*ctx, req->path());
         if (inum < 0) res->set_error("Create failed");
@@ -82,12 +128,12 @@ public:
     }
 
     Status Mkdir(ServerContext*, const FileRequest* req, MkdirResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         int inum = sfs_mkdir(*ctx, req->path());
         if (inum < 0) res->set_error("Mkdir failed");
         else          res->set_inum(inum);
@@ -95,12 +141,12 @@ public:
     }
 
     Status Open(ServerContext*, const FileRequest* req, OpenResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         int fd = sfs_open(*ctx, req->path());
         if (fd < 0) res->set_error("Open failed");
         else        res->set_fd(fd);
@@ -108,7 +154,6 @@ public:
     }
 
     Status Write(ServerContext*, const WriteRequestMulti* req, WriteResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!res) return Status(grpc::StatusCode::INTERNAL, "WriteReponse* is null");
 
@@ -116,6 +161,7 @@ public:
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         int written = sfs_write(*ctx, req->fd(), req->data().c_str(), req->data().size());
         res->set_success(written >= 0);
         if (written < 0) res->set_error("Write failed");
@@ -123,12 +169,13 @@ public:
     }
 
     Status Read(ServerContext*, const ReadRequestMulti* req, ReadResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::shared_lock<std::shared_mutex> op_lk(ctx->op_mutex);
+        std::lock_guard<std::mutex> fd_lk(ctx->fd_lock(req->fd()));
         std::vector<char> buf(req->num_bytes());
         int n = sfs_read(*ctx, req->fd(), buf.data(), req->num_bytes());
         if (n < 0) {
@@ -140,12 +187,12 @@ public:
     }
 
     Status Seek(ServerContext*, const SeekRequestMulti* req, SeekResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         bool ok = sfs_seek(*ctx, req->fd(), req->offset(), req->whence());
         res->set_success(ok);
         if (!ok) res->set_error("Seek failed");
@@ -158,6 +205,7 @@ public:
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::shared_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         auto names = sfs_listdir(*ctx, req->path());
 
         for (const auto& n: names) {
@@ -167,21 +215,106 @@ public:
     }
 
     Status Remove(ServerContext*, const FileRequest* req, RemoveResponse* res) override {
-        std::lock_guard<std::mutex> lk(mu_);
         auto ctx = get_ctx(req->mount_id());
         if (!ctx) {
             res->set_error("Invalid mount_id");
             return Status::OK;
         }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
         bool ok = sfs_remove(*ctx, req->path());
         res->set_success(ok);
         if (!ok) res->set_error("Remove failed");
         return Status::OK;
     }
+
+    Status Close(ServerContext*, const FdRequest* req, CloseResponse* res) override {
+        auto ctx = get_ctx(req->mount_id());
+        if (!ctx) {
+            res->set_error("Invalid mount_id");
+            return Status::OK;
+        }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
+        bool ok = sfs_close(*ctx, req->fd());
+        res->set_success(ok);
+        if (!ok) res->set_error("Close failed");
+        return Status::OK;
+    }
+
+    Status Fsync(ServerContext*, const FdRequest* req, FsyncResponse* res) override {
+        auto ctx = get_ctx(req->mount_id());
+        if (!ctx) {
+            res->set_error("Invalid mount_id");
+            return Status::OK;
+        }
+        std::unique_lock<std::shared_mutex> op_lk(ctx->op_mutex);
+        bool ok = sfs_fsync(*ctx, req->fd());
+        res->set_success(ok);
+        if (!ok) res->set_error("Fsync failed");
+        return Status::OK;
+    }
+
+    Status GetMountStats(ServerContext*, const MountStatsRequest* req, MountStatsResponse* res) override {
+        auto ctx = get_ctx(req->mount_id());
+        if (!ctx) {
+            res->set_error("Invalid mount_id");
+            return Status::OK;
+        }
+        std::shared_lock<std::shared_mutex> op_lk(ctx->op_mutex);
+        if (ctx->cache_controller) {
+            BlockCacheController& cache = *ctx->cache_controller;
+            CacheStats& stats = cache.stats();
+            auto [cached, metadata] = cache.residentBlocks();
+            res->set_cache_enabled(true);
+            res->set_cache_shared(cache.shared());
+            res->set_cache_policy(cache_policy_name(cache.policy()));
+            res->set_cache_capacity(cache.capacity());
+            res->set_cache_quota_blocks(cache.quota());
+            res->set_cache_reserved_blocks(cache.reserved());
+            res->set_cache_total_blocks(cache.cache().residentBlocks().first);
+            res->set_cached_blocks(cached);
+            res->set_metadata_blocks(metadata);
+            res->set_dirty_blocks(cache.dirtyBlocks());
+            for (int k = 0; k < NUM_BLOCK_KINDS; ++k) {
+                const CacheStats::PerKind& kind = stats.kinds[k];
+                auto* out = res->add_block_classes();
+                out->set_block_class(block_kind_name((BlockKind)k));
+                out->set_hits(kind.hits.load());
+                out->set_misses(kind.misses.load());
+                out->set_evictions(kind.evictions.load());
+                out->set_writebacks(kind.writebacks.load());
+            }
+            res->set_prefetched(stats.prefetched.load());
+            res->set_prefetch_hits(stats.prefetch_hits.load());
+            fill_latency(res->mutable_cache_miss(), "cache_miss", stats.miss_latency);
+            for (auto [blocks, rate] : stats.hit_rate_curve.curve()) {
+                auto* point = res->add_hit_rate_curve();
+                point->set_cache_blocks(blocks);
+                point->set_hit_rate(rate);
+            }
+        }
+        if (ctx->disk) {
+            const DiskStats& disk = ctx->disk->stats();
+            fill_io(res->add_disk(), "read", disk.read);
+            fill_io(res->add_disk(), "write", disk.write);
+            fill_io(res->add_disk(), "sync", disk.sync);
+            res->set_io_engine(ctx->disk->io_engine_name());
+        }
+        InodeCache::Stats icache = ctx->icache.stats();
+        res->set_icache_inodes(ctx->icache.size());
+        res->set_icache_hits(icache.hits);
+        res->set_icache_misses(icache.misses);
+        res->set_icache_writebacks(icache.writebacks);
+        DentryCache::Stats dcache = ctx->dcache.stats();
+        res->set_dentries(ctx->dcache.size());
+        res->set_dentry_hits(dcache.hits);
+        res->set_dentry_misses(dcache.misses);
+        res->set_path_hits(dcache.path_hits);
+        return Status::OK;
+    }
 };
 
-void RunServer(const std::string& address) {
-    FileSystemServiceImpl service;  // constructor calls sfs_init()
+void RunServer(const std::string& address, size_t cache_blocks, CachePolicy policy) {
+    FileSystemServiceImpl service(std::make_shared<BlockCache>(cache_blocks, BLOCK_SIZE, policy));
     ServerBuilder builder;
     builder.AddListeningPort(address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
@@ -190,8 +323,23 @@ void RunServer(const std::string& address) {
     server->Wait();
 }
 
+// fs_server [--cache-blocks=N] [--cache-policy=lru|2q|arc] sizes the block cache all mounts share
 int main(int argc, char** argv) {
     const std::string address = "0.0.0.0:50051";
-    RunServer(address);
+    size_t cache_blocks = SHARED_CACHE_BLOCKS;
+    CachePolicy policy = CachePolicy::LRU;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--cache-blocks=", 0) == 0) {
+            cache_blocks = std::strtoull(arg.c_str() + 15, nullptr, 10);
+        } else if (arg.rfind("--cache-policy=", 0) == 0 && parse_cache_policy(arg.substr(15))) {
+            policy = *parse_cache_policy(arg.substr(15));
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--cache-blocks=N] [--cache-policy=lru|2q|arc]" << std::endl;
+            return 1;
+        }
+    }
+    if (cache_blocks == 0) cache_blocks = SHARED_CACHE_BLOCKS;
+    RunServer(address, cache_blocks, policy);
     return 0;
 }
@@ -0,0 +1,147 @@
+#include "icache.h"
+#include "fs_context.h"
+#include "inode.h"
+#include "block_manager.h"
+#include <cstring>
+#include <map>
+#include <vector>
+
+struct InodeCache::Entry {
+    Inode ino{};
+    int refs = 0;
+    bool dirty = false;
+    Clock::time_point dirtied;
+};
+
+static uint64_t table_block(FSContext& ctx, int inum) { return ctx.sb.inode_table_start + inum / INODES_PER_BLOCK; }
+static size_t table_offset(int inum) { return (size_t)(inum % INODES_PER_BLOCK) * sizeof(Inode); }
+
+InodeCache::InodeCache(size_t capacity) : capacity_(capacity) {}
+
+InodeCache::~InodeCache() = default;
+
+Inode* InodeCache::get(FSContext& ctx, int inum, bool load) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = entries_.find(inum);
+    if (it != entries_.end()) {
+        ++stats_.hits;
+        Entry& e = *it->second;
+        if (e.refs++ == 0) lru_.erase(inum);
+        return &e.ino;
+    }
+    if (inum <= 0 || (uint64_t)inum >= ctx.sb.num_inodes) return nullptr;
+    ++stats_.misses;
+    auto e = std::make_unique<Entry>();
+    if (load) {
+        // Only the inode itself is copied; the block is read in place
+        char scratch[BLOCK_SIZE];
+        BlockRef ref;
+        const char* data = block_load(ctx, table_block(ctx, inum), ref, scratch, BlockKind::Inode);
+        if (!data) return nullptr;
+        std::memcpy(&e->ino, data + table_offset(inum), sizeof(Inode));
+    }
+    e->refs = 1;
+    Inode* ino = &e->ino;
+    entries_.emplace(inum, std::move(e));
+    evict(ctx);
+    return ino;
+}
+
+void InodeCache::put(int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = entries_.find(inum);
+    if (it == entries_.end() || it->second->refs == 0) return;
+    if (--it->second->refs == 0) lru_.pushFront(inum);
+}
+
+void InodeCache::markDirty(FSContext& ctx, int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = entries_.find(inum);
+    if (it == entries_.end()) return;
+    Entry& e = *it->second;
+    Clock::time_point now = Clock::now();
+    if (!e.dirty) {
+        e.dirty = true;
+        e.dirtied = now;
+        dirty_.pushFront(inum);
+    }
+    auto expire = std::chrono::milliseconds(DIRTY_EXPIRE_MS);
+    if (now - entries_.at((int)dirty_.back())->dirtied >= expire) {
+        writeBackWhere(ctx, [&](const Entry& d) { return now - d.dirtied >= expire; });
+    }
+}
+
+bool InodeCache::sync(FSContext& ctx, int inum) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = entries_.find(inum);
+    if (it == entries_.end() || !it->second->dirty) return true;
+    return writeBack(ctx, inum, *it->second);
+}
+
+bool InodeCache::syncAll(FSContext& ctx) {
+    std::lock_guard<std::mutex> lk(mu_);
+    return writeBackWhere(ctx, [](const Entry&) { return true; });
+}
+
+size_t InodeCache::size() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return entries_.size();
+}
+
+InodeCache::Stats InodeCache::stats() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return stats_;
+}
+
+bool InodeCache::writeBack(FSContext& ctx, int inum, Entry& e) {
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    uint64_t block = table_block(ctx, inum);
+    char* data = block_load(ctx, block, ref, scratch, BlockKind::Inode);
+    if (!data) return false;
+    std::memcpy(data + table_offset(inum), &e.ino, sizeof(Inode));
+    if (!block_store(ctx, block, ref, data)) return false;
+    e.dirty = false;
+    dirty_.erase(inum);
+    ++stats_.writebacks;
+    return true;
+}
+
+bool InodeCache::writeBackWhere(FSContext& ctx, const std::function<bool(const Entry&)>& pred) {
+    std::map<uint64_t, std::vector<int>> by_block;
+    for (auto& [inum, e] : entries_) {
+        if (e->dirty && pred(*e)) by_block[table_block(ctx, inum)].push_back(inum);
+    }
+    bool ok = true;
+    for (auto& [block, inums] : by_block) {
+        char scratch[BLOCK_SIZE];
+        BlockRef ref;
+        char* data = block_load(ctx, block, ref, scratch, BlockKind::Inode);
+        if (!data) {
+            ok = false;
+            continue;
+        }
+        for (int inum : inums) std::memcpy(data + table_offset(inum), &entries_.at(inum)->ino, sizeof(Inode));
+        if (!block_store(ctx, block, ref, data)) {
+            ok = false;
+            continue;
+        }
+        for (int inum : inums) {
+            entries_.at(inum)->dirty = false;
+            dirty_.erase(inum);
+        }
+        stats_.writebacks += inums.size();
+    }
+    return ok;
+}
+
+void InodeCache::evict(FSContext& ctx) {
+    while (entries_.size() > capacity_ && !lru_.empty()) {
+        int victim = (int)lru_.back();
+        Entry& e = *entries_.at(victim);
+        // A dirty inode that cannot be written back stays cached rather than being lost
+        if (e.dirty && !writeBack(ctx, victim, e)) return;
+        lru_.erase(victim);
+        entries_.erase(victim);
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "cache_policy.h"
+#include "stat.h"
+
+struct FSContext;
+struct Inode;
+
+// In-memory inode cache (icache): decoded inodes keyed by inum, so reading or updating one is a
+// struct access rather than a pass over its 4 KB inode-table block. A changed inode is only
+// marked dirty; it goes back into its table block (through the block cache when enabled) when
+// synced (sfs_fsync, sfs_close, unmount), when evicted, or once it has been dirty for
+// DIRTY_EXPIRE_MS and another inode is dirtied.
+//
+// Entries are pinned by get() until the matching put(); open files keep theirs pinned, so the
+// Inode* they hold stays valid. Only unpinned entries are evicted, least recently used first;
+// with everything pinned the cache grows past its capacity.
+//
+// The cache's own structure is locked, so shared-lock operations (sfs_read, sfs_listdir) can
+// look inodes up concurrently. The Inode contents follow the mount's op_mutex: they are only
+// changed by operations holding it exclusively.
+class InodeCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t writebacks = 0; // inodes written into their table block
+    };
+
+    explicit InodeCache(size_t capacity = ICACHE_INODES);
+    ~InodeCache();
+    InodeCache(const InodeCache&) = delete;
+    InodeCache& operator=(const InodeCache&) = delete;
+
+    // Pins inode inum and returns it, read from the inode table on a miss. With load false a
+    // missing inode starts zeroed instead, for a caller about to overwrite all of it. nullptr
+    // if inum is out of range or its table block cannot be read.
+    Inode* get(FSContext& ctx, int inum, bool load = true);
+    // Drops a pin taken by get()
+    void put(int inum);
+
+    // The cached inode was changed. Also writes back inodes that have been dirty longer than
+    // DIRTY_EXPIRE_MS.
+    void markDirty(FSContext& ctx, int inum);
+
+    // Writes inum back if it is cached and dirty. False if its table block could not be written.
+    bool sync(FSContext& ctx, int inum);
+    // Writes back every dirty inode, one load and store per table block
+    bool syncAll(FSContext& ctx);
+
+    size_t size();
+    Stats stats();
+
+private:
+    struct Entry;
+    using Key = KeyList::Key;
+
+    bool writeBack(FSContext& ctx, int inum, Entry& e);
+    // Writes back the dirty inodes for which pred holds, grouped by table block
+    bool writeBackWhere(FSContext& ctx, const std::function<bool(const Entry&)>& pred);
+    void evict(FSContext& ctx);
+
+    std::mutex mu_;
+    std::unordered_map<int, std::unique_ptr<Entry>> entries_;
+    KeyList lru_;   // unpinned entries, most recently used first
+    KeyList dirty_; // dirty entries, most recently dirtied first
+    size_t capacity_;
+    Stats stats_;
+};
@@ -2,70 +2,90 @@
 #include "fs_context.h"
 #include "inode.h"
 #include "block_cache_controller.h"
+#include "block_manager.h"
+#include "bmap.h"
+#include <algorithm>
 #include <vector>
 #include <cstring>
 #include <memory>
 
-const int INODES_PER_BLOCK = BLOCK_SIZE / sizeof(Inode);
+// For images without on-disk bitmaps: an inode with a mode is in use, and so is every block
+// it points to.
+void inode_mark_used(FSContext &ctx) {
+    std::vector<char> table((size_t)MAX_IO_BLOCKS * BLOCK_SIZE);
+    auto mark_block = [&](uint32_t b) {
+        if (b < ctx.block_bitmap.size()) ctx.block_bitmap.set(b);
+    };
+    for (uint64_t tb = 0; tb < ctx.sb.inode_table_blocks; tb += MAX_IO_BLOCKS) {
+        size_t n = std::min<uint64_t>(MAX_IO_BLOCKS, ctx.sb.inode_table_blocks - tb);
+        if (ctx.disk->read_blocks(ctx.sb.inode_table_start + tb, n, table.data()) != 0) return;
+        for (size_t b = 0; b < n; ++b) {
+            for (int k = 0; k < INODES_PER_BLOCK; ++k) {
+                uint64_t inum = (tb + b) * INODES_PER_BLOCK + k;
+                if (inum == 0 || inum >= ctx.sb.num_inodes) continue;
+                Inode ino;
+                std::memcpy(&ino, table.data() + b * BLOCK_SIZE + k * sizeof(Inode), sizeof(Inode));
+                if (ino.mode == 0) continue;
+                ctx.inode_bitmap.set(inum);
+                bmap_walk(ctx, ino,
+                          [&](int, uint32_t block, int count) {
+                              for (int i = 0; i < count; ++i) mark_block(block + i);
+                              return true;
+                          },
+                          mark_block);
+            }
+        }
+    }
+}
 
 void inode_init(FSContext &ctx) {
-    ctx.inode_bitmap.assign(NUM_INODES, false);
-    ctx.inode_bitmap[0] = true;
     Inode root;
     inode_read(ctx, 1, root);
     if (root.mode == 0) { // first run (root uninitialized) => init root
         root.mode = 040755;
         root.size = 0;
-        root.direct[0] = 2; // allocate a data block for root directory "/"
-        for (int i = 1;i < NDIRECT; ++i) root.direct[i] = 0;
-        root.indirect = 0;
+        bmap_init(ctx, root);
+        bmap_alloc(ctx, root, 0, 1); // allocate a data block for root directory "/"
+        int block = bmap_lookup(ctx, root, 0);
+        char scratch[BLOCK_SIZE];
+        BlockRef ref;
+        if (char* zero = block > 0 ? block_load(ctx, block, ref, scratch, BlockKind::Dir, /*zero_fill=*/true) : nullptr) {
+            block_store(ctx, block, ref, zero);
+        }
         inode_write(ctx, 1, root);
-        ctx.inode_bitmap[1] = true;
+    }
+    if (!ctx.inode_bitmap.test(1)) {
+        ctx.inode_bitmap.set(1);
+        bitmap_store(ctx, ctx.inode_bitmap, ctx.sb.inode_bitmap_start, 1);
     }
 }
 
 bool inode_read(FSContext &ctx, int inum, Inode &out) {
-    if (inum <= 0 || inum >= NUM_INODES) return false;
-    int block = 1 + (inum / INODES_PER_BLOCK);
-    int off = inum % INODES_PER_BLOCK;
-    std::vector<char> buf(BLOCK_SIZE);
-    //if (!ctx.disk.disk_read(block, buf.data())) return false;
-    if (ctx.use_cache) {
-        auto& data = ctx.cache_controller->getBlock(block);
-        std::memcpy(buf.data(), data.data(), BLOCK_SIZE);
-    } else {
-        if (!ctx.disk->disk_read(block, buf.data())) return false;
-    }
-    std::memcpy(&out, buf.data() + off * sizeof(Inode), sizeof(Inode));
+    Inode* ino = ctx.icache.get(ctx, inum);
+    if (!ino) return false;
+    out = *ino;
+    ctx.icache.put(inum);
     return true;
 }
 
 bool inode_write(FSContext &ctx, int inum, const Inode &in) {
-    if (inum <= 0 || inum >= NUM_INODES) return false;
-    int block = 1 + (inum / INODES_PER_BLOCK);
-    int off = inum % INODES_PER_BLOCK;
-    std::vector<char> buf(BLOCK_SIZE);
-    //ctx.disk.disk_read(block, buf.data());
-    if (ctx.use_cache) {
-        auto& data = ctx.cache_controller->getBlock(block);
-        std::memcpy(buf.data(), data.data(), BLOCK_SIZE);
-    } else {
-        ctx.disk->disk_read(block, buf.data());
-    }
-    std::memcpy(buf.data() + off * sizeof(Inode), &in, sizeof(Inode));
-    if (ctx.use_cache) {
-        ctx.cache_controller->writeBlock(block, buf.data());
-        return true;
-    }
-    return ctx.disk->disk_write(block, buf.data());
+    Inode* ino = ctx.icache.get(ctx, inum, /*load=*/false);
+    if (!ino) return false;
+    *ino = in;
+    ctx.icache.markDirty(ctx, inum);
+    ctx.icache.put(inum);
+    return true;
 }
 
 int inode_alloc(FSContext &ctx) {
-    for (int i = 1;i < NUM_INODES; ++i) {
-        if (!ctx.inode_bitmap[i]) {
-            ctx.inode_bitmap[i] = true;
-            return i;
-        }
-    }
-    return -1;
+    uint64_t inum = ctx.inode_bitmap.alloc(1);
+    if (inum == Bitmap::npos) return -1;
+    bitmap_store(ctx, ctx.inode_bitmap, ctx.sb.inode_bitmap_start, inum);
+    return (int)inum;
+}
+
+void inode_free(FSContext &ctx, int inum) {
+    if (inum <= 1 || (uint64_t)inum >= ctx.sb.num_inodes) return;
+    ctx.inode_bitmap.clear(inum);
+    bitmap_store(ctx, ctx.inode_bitmap, ctx.sb.inode_bitmap_start, inum);
 }
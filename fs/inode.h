@@ -6,14 +6,34 @@
 
 struct FSContext;
 
+// Mode bit above the file type: the inode's blocks are mapped by an extent tree (extent.h)
+// rather than by block pointers. Set on new inodes of version 3 images (see bmap_init).
+constexpr uint32_t INODE_EXTENTS = 1u << 16;
+// Mode bit of a directory whose entries are indexed by name hash (dir.cpp) rather than kept in
+// one linear list. Set once the directory outgrows DIR_INDEX_BLOCKS on a version 4 image.
+constexpr uint32_t INODE_DIR_INDEX = 1u << 17;
+
 struct Inode {
-    uint32_t mode; // file type and permissions
+    uint32_t mode; // file type and permissions, plus INODE_EXTENTS and INODE_DIR_INDEX
     uint32_t size; // file size in bytes
-    uint32_t direct[NDIRECT]; //direct block pointers
-    uint32_t indirect; // single-indirect block pointer
+    union {
+        struct {
+            uint32_t direct[NDIRECT]; //direct block pointers
+            uint32_t indirect; // single-indirect block pointer
+        };
+        uint32_t extents[NDIRECT + 1]; // with INODE_EXTENTS: root of the extent tree
+    };
 };
 
+constexpr int INODES_PER_BLOCK = BLOCK_SIZE / sizeof(Inode);
+
 void inode_init(FSContext &ctx);
+// Sets the bitmap bits of every inode in use and every block they point to (by a full scan of
+// the inode table; used only on images that do not store their bitmaps)
+void inode_mark_used(FSContext &ctx);
+// Copy an inode out of / into the mount's inode cache (icache.h); inode_write leaves the table
+// block to write-back. Code that keeps an inode across calls pins it with ctx.icache instead.
 bool inode_read(FSContext &ctx, int inum, Inode &out);
 bool inode_write(FSContext &ctx, int inum, const Inode &in);
 int inode_alloc(FSContext &ctx);
+void inode_free(FSContext &ctx, int inum);
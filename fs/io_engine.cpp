@@ -0,0 +1,292 @@
+#include "io_engine.h"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+int IOEngine::run_batch(std::vector<IORequest>& reqs) {
+    std::mutex m;
+    std::condition_variable cv;
+    size_t pending = reqs.size();
+    for (IORequest& req : reqs) {
+        submit(req, [&, r = &req](int result) {
+            r->result = result;
+            std::lock_guard<std::mutex> lock(m);
+            if (--pending == 0) cv.notify_one();
+        });
+    }
+    std::unique_lock<std::mutex> lock(m);
+    cv.wait(lock, [&] { return pending == 0; });
+    for (const IORequest& req : reqs) {
+        if (req.result != 0) return req.result;
+    }
+    return 0;
+}
+
+/* THREAD POOL ENGINE */
+// Plain pread/pwrite on worker threads; always available.
+class ThreadPoolEngine : public IOEngine {
+public:
+    ThreadPoolEngine(int fd, size_t block_size, unsigned queue_depth, unsigned threads)
+        : fd_(fd), block_size_(block_size), depth_(queue_depth) {
+        for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this] { work(); });
+    }
+
+    ~ThreadPoolEngine() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto& t : workers_) t.join();
+    }
+
+    void submit(const IORequest& req, Callback done) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_.wait(lock, [&] { return queued_ < depth_; });
+        ++queued_;
+        queue_.push_back({req, std::move(done)});
+        ready_.notify_one();
+    }
+
+    const char* name() const override { return "threads"; }
+
+private:
+    struct Op {
+        IORequest req;
+        Callback done;
+    };
+
+    int fd_;
+    size_t block_size_;
+    unsigned depth_;
+    std::mutex mutex_;
+    std::condition_variable ready_, space_;
+    std::deque<Op> queue_;
+    unsigned queued_ = 0; // queued or executing
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+
+    int execute(const IORequest& req) {
+        size_t total = req.count * block_size_, done = 0;
+        off_t offset = (off_t)(req.first_block * block_size_);
+        while (done < total) {
+            ssize_t n = req.write ? pwrite(fd_, req.buffer + done, total - done, offset + done)
+                                  : pread(fd_, req.buffer + done, total - done, offset + done);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return -errno;
+            }
+            if (n == 0) return -EIO;
+            done += n;
+        }
+        return 0;
+    }
+
+    void work() {
+        while (true) {
+            Op op;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+                if (queue_.empty()) return;
+                op = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            op.done(execute(op.req));
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --queued_;
+            }
+            space_.notify_one();
+        }
+    }
+};
+
+/* IO_URING ENGINE */
+// Talks to the kernel through the raw io_uring_setup/io_uring_enter syscalls and the mmap'd
+// rings, so liburing is not needed. Submitters fill SQEs under a mutex; one reaper thread
+// drains the CQ, resubmits the tail of short transfers and runs the callbacks.
+class UringEngine : public IOEngine {
+public:
+    static std::unique_ptr<UringEngine> create(int fd, size_t block_size, unsigned queue_depth) {
+        std::unique_ptr<UringEngine> engine(new UringEngine(fd, block_size));
+        if (!engine->setup(queue_depth)) return nullptr;
+        engine->reaper_ = std::thread([e = engine.get()] { e->reap(); });
+        return engine;
+    }
+
+    ~UringEngine() override {
+        if (reaper_.joinable()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            space_.wait(lock, [&] { return in_flight_ == 0; });
+            push(nullptr); // NOP with no op attached tells the reaper to exit
+            lock.unlock();
+            reaper_.join();
+        }
+        if (sqes_) munmap(sqes_, sqes_len_);
+        if (cq_ptr_ && cq_ptr_ != sq_ptr_) munmap(cq_ptr_, cq_len_);
+        if (sq_ptr_) munmap(sq_ptr_, sq_len_);
+        if (ring_fd_ >= 0) close(ring_fd_);
+    }
+
+    void submit(const IORequest& req, Callback done) override {
+        Op* op = new Op{req, std::move(done), 0, {}};
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_.wait(lock, [&] { return in_flight_ < sq_entries_; });
+        ++in_flight_;
+        push(op);
+    }
+
+    const char* name() const override { return "io_uring"; }
+
+private:
+    struct Op {
+        IORequest req;
+        Callback done;
+        size_t transferred;
+        struct iovec iov;
+    };
+
+    int fd_;
+    size_t block_size_;
+    int ring_fd_ = -1;
+    unsigned sq_entries_ = 0;
+    void* sq_ptr_ = nullptr;
+    void* cq_ptr_ = nullptr;
+    size_t sq_len_ = 0, cq_len_ = 0, sqes_len_ = 0;
+    struct io_uring_sqe* sqes_ = nullptr;
+    struct io_uring_cqe* cqes_ = nullptr;
+    unsigned *sq_tail_, *sq_mask_, *sq_array_;
+    unsigned *cq_head_, *cq_tail_, *cq_mask_;
+
+    std::mutex mutex_; // guards the SQ ring and in_flight_
+    std::condition_variable space_;
+    unsigned in_flight_ = 0;
+    std::thread reaper_;
+
+    UringEngine(int fd, size_t block_size) : fd_(fd), block_size_(block_size) {}
+
+    static int enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+        return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0);
+    }
+
+    bool setup(unsigned entries) {
+        struct io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        ring_fd_ = (int)syscall(__NR_io_uring_setup, entries, &p);
+        if (ring_fd_ < 0) return false;
+        sq_entries_ = p.sq_entries;
+
+        sq_len_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_len_ = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+        bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single) sq_len_ = cq_len_ = std::max(sq_len_, cq_len_);
+        sq_ptr_ = mmap(nullptr, sq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) return (sq_ptr_ = nullptr), false;
+        cq_ptr_ = single ? sq_ptr_
+                         : mmap(nullptr, cq_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+        if (cq_ptr_ == MAP_FAILED) return (cq_ptr_ = nullptr), false;
+        sqes_len_ = p.sq_entries * sizeof(struct io_uring_sqe);
+        void* sqes = mmap(nullptr, sqes_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return false;
+        sqes_ = (struct io_uring_sqe*)sqes;
+
+        char* sq = (char*)sq_ptr_;
+        sq_tail_ = (unsigned*)(sq + p.sq_off.tail);
+        sq_mask_ = (unsigned*)(sq + p.sq_off.ring_mask);
+        sq_array_ = (unsigned*)(sq + p.sq_off.array);
+        char* cq = (char*)cq_ptr_;
+        cq_head_ = (unsigned*)(cq + p.cq_off.head);
+        cq_tail_ = (unsigned*)(cq + p.cq_off.tail);
+        cq_mask_ = (unsigned*)(cq + p.cq_off.ring_mask);
+        cqes_ = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+        return true;
+    }
+
+    // Caller holds mutex_. At most sq_entries_ ops are in flight, so a slot is always free.
+    void push(Op* op) {
+        unsigned tail = *sq_tail_;
+        unsigned idx = tail & *sq_mask_;
+        struct io_uring_sqe* sqe = &sqes_[idx];
+        std::memset(sqe, 0, sizeof(*sqe));
+        if (op) {
+            size_t total = op->req.count * block_size_;
+            op->iov = {op->req.buffer + op->transferred, total - op->transferred};
+            sqe->opcode = op->req.write ? IORING_OP_WRITEV : IORING_OP_READV;
+            sqe->fd = fd_;
+            sqe->off = op->req.first_block * block_size_ + op->transferred;
+            sqe->addr = (uint64_t)(uintptr_t)&op->iov;
+            sqe->len = 1;
+        } else {
+            sqe->opcode = IORING_OP_NOP;
+        }
+        sqe->user_data = (uint64_t)(uintptr_t)op;
+        sq_array_[idx] = idx;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        int ret;
+        while ((ret = enter(ring_fd_, 1, 0, 0)) < 0 && errno == EINTR) {}
+        if (ret < 0) std::cerr<<"[IOEngine] io_uring_enter failed: "<<std::strerror(errno)<<"\n";
+    }
+
+    void finish(Op* op, int result) {
+        op->done(result);
+        delete op;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --in_flight_;
+        }
+        space_.notify_all();
+    }
+
+    void reap() {
+        while (true) {
+            if (enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                std::cerr<<"[IOEngine] io_uring wait failed: "<<std::strerror(errno)<<"\n";
+                return;
+            }
+            unsigned head = *cq_head_;
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            bool stop = false;
+            while (head != tail) {
+                struct io_uring_cqe* cqe = &cqes_[head & *cq_mask_];
+                Op* op = (Op*)(uintptr_t)cqe->user_data;
+                int res = cqe->res;
+                __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+                if (!op) {
+                    stop = true;
+                    continue;
+                }
+                if (res < 0) {
+                    finish(op, res);
+                } else if (res == 0) {
+                    finish(op, -EIO); // past the end of the image
+                } else if ((op->transferred += res) < op->req.count * block_size_) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    push(op); // short transfer: queue the rest
+                } else {
+                    finish(op, 0);
+                }
+            }
+            if (stop) return;
+        }
+    }
+};
+
+std::unique_ptr<IOEngine> IOEngine::create(IOEngineKind kind, int fd, size_t block_size, unsigned queue_depth) {
+    if (kind != IOEngineKind::ThreadPool) {
+        if (auto uring = UringEngine::create(fd, block_size, queue_depth)) return uring;
+        std::cerr<<"[IOEngine] io_uring unavailable ("<<std::strerror(errno)<<"), using thread pool\n";
+    }
+    unsigned threads = std::max(1u, std::min(queue_depth, std::thread::hardware_concurrency()));
+    return std::make_unique<ThreadPoolEngine>(fd, block_size, queue_depth, threads);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+enum class IOEngineKind { Auto, Uring, ThreadPool };
+
+// One positional transfer of `count` consecutive blocks to/from `buffer`.
+struct IORequest {
+    uint64_t first_block = 0;
+    size_t count = 1;
+    char* buffer = nullptr;
+    bool write = false;
+    int result = 0; // filled in on completion: 0 or a negative errno
+};
+
+// Asynchronous block I/O against one open image. submit() returns as soon as the request
+// is queued and `done` later runs on an engine-owned thread, so it must not block on the
+// engine itself. Engines are thread-safe and cap requests in flight at their queue depth.
+class IOEngine {
+public:
+    using Callback = std::function<void(int result)>;
+
+    virtual ~IOEngine() = default;
+    virtual void submit(const IORequest& req, Callback done) = 0;
+    virtual const char* name() const = 0;
+
+    // Puts every request in flight at once and waits for all of them; returns the first error.
+    int run_batch(std::vector<IORequest>& reqs);
+
+    // Auto tries io_uring and falls back to the thread pool when the kernel refuses it.
+    static std::unique_ptr<IOEngine> create(IOEngineKind kind, int fd, size_t block_size, unsigned queue_depth);
+};
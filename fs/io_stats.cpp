@@ -0,0 +1,86 @@
+#include "io_stats.h"
+
+HitRateCurve::HitRateCurve() : block_at_(kSlots), marks_(kSlots + 1, 0) {}
+
+void HitRateCurve::sample(uint64_t block) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    ++samples_;
+    if (next_slot_ == kSlots) compact();
+    auto it = slot_of_.find(block);
+    if (it == slot_of_.end()) {
+        // First touch (or beyond the tracked sizes): a miss at every cache size
+        if (slot_of_.size() == kTracked) {
+            size_t lru = first_marked();
+            slot_of_.erase(block_at_[lru]);
+            mark(lru, -1);
+        }
+        it = slot_of_.emplace(block, 0).first;
+    } else {
+        // Stack depth counts the distinct sampled blocks used since, this one included
+        uint64_t depth = slot_of_.size() - marked_up_to(it->second) + 1;
+        uint64_t distance = depth << HIT_RATE_SAMPLE_SHIFT;
+        ++reuses_[64 - __builtin_clzll(distance - 1)]; // ceil(log2(distance)), distance >= 2
+        mark(it->second, -1);
+    }
+    it->second = next_slot_++;
+    block_at_[it->second] = block;
+    mark(it->second, 1);
+}
+
+void HitRateCurve::mark(size_t slot, int delta) {
+    for (size_t i = slot + 1; i <= kSlots; i += i & -i) marks_[i] += delta;
+}
+
+size_t HitRateCurve::marked_up_to(size_t slot) const {
+    size_t n = 0;
+    for (size_t i = slot + 1; i > 0; i -= i & -i) n += marks_[i];
+    return n;
+}
+
+size_t HitRateCurve::first_marked() const {
+    // Descend the tree for the longest prefix holding no mark
+    size_t pos = 0;
+    for (size_t step = size_t(1) << (63 - __builtin_clzll(kSlots)); step > 0; step >>= 1) {
+        if (pos + step <= kSlots && marks_[pos + step] == 0) pos += step;
+    }
+    return pos;
+}
+
+void HitRateCurve::compact() {
+    // Live slots keep their order, so every distance stays the same. At most kTracked are live,
+    // so this runs at most once per kSlots - kTracked samples.
+    std::vector<std::pair<size_t, uint64_t>> live;
+    live.reserve(slot_of_.size());
+    for (auto& [block, slot] : slot_of_) live.emplace_back(slot, block);
+    std::sort(live.begin(), live.end());
+    std::fill(marks_.begin(), marks_.end(), 0);
+    for (size_t i = 0; i < live.size(); ++i) {
+        slot_of_[live[i].second] = i;
+        block_at_[i] = live[i].second;
+        marks_[i + 1] = 1;
+    }
+    // Linear-time Fenwick build from the point values
+    for (size_t i = 1; i <= kSlots; ++i) {
+        size_t parent = i + (i & -i);
+        if (parent <= kSlots) marks_[parent] += marks_[i];
+    }
+    next_slot_ = live.size();
+}
+
+std::vector<std::pair<uint64_t, double>> HitRateCurve::curve() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    std::vector<std::pair<uint64_t, double>> out;
+    uint64_t hits = 0;
+    for (int k = 0; (1ull << k) <= HIT_RATE_MAX_BLOCKS; ++k) {
+        hits += reuses_[k];
+        // Below the sampling factor every size looks the same
+        if (k < HIT_RATE_SAMPLE_SHIFT) continue;
+        out.emplace_back(1ull << k, samples_ ? (double)hits / samples_ : 0.0);
+    }
+    return out;
+}
+
+uint64_t HitRateCurve::samples() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return samples_;
+}
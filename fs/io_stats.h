@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "histogram.h" // shared with core_kv (common/)
+#include "stat.h"
+
+// One kind of transfer (read, write, sync): operations, blocks moved, failures and latency.
+struct IOOpStats {
+    std::atomic<uint64_t> ops{0};
+    std::atomic<uint64_t> blocks{0};
+    std::atomic<uint64_t> errors{0};
+    LatencyHistogram latency; // microseconds
+
+    void record(size_t count, int err, std::chrono::steady_clock::time_point start) {
+        ops.fetch_add(1, std::memory_order_relaxed);
+        blocks.fetch_add(count, std::memory_order_relaxed);
+        if (err != 0) errors.fetch_add(1, std::memory_order_relaxed);
+        latency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+// Hit rate an LRU cache of any size would have had on the blocks accessed so far, so a mount's
+// cache_blocks can be sized from a live workload. Uses SHARDS (Waldspurger et al., FAST '15):
+// only blocks whose hash falls in 1 / 2^HIT_RATE_SAMPLE_SHIFT of the space are tracked, and reuse
+// distances measured among them are scaled back up by the same factor. Sampled accesses take a
+// mutex for O(log n) work; the rest cost one multiply.
+//
+// A reuse distance is the number of distinct sampled blocks used since the block's last access.
+// Each sampled access takes the next slot of a timeline, and a Fenwick tree marks the slot of
+// every tracked block's latest access, so the distance is a count of marks after that slot.
+// When the timeline fills up, the live slots are packed to its start.
+class HitRateCurve {
+public:
+    HitRateCurve();
+
+    void access(uint64_t block) {
+        if ((block * 0x9E3779B97F4A7C15ULL) >> (64 - HIT_RATE_SAMPLE_SHIFT) != 0) return;
+        sample(block);
+    }
+
+    // (cache_blocks, hit rate) for every power of two up to HIT_RATE_MAX_BLOCKS
+    std::vector<std::pair<uint64_t, double>> curve() const;
+    uint64_t samples() const;
+
+private:
+    // Sampled blocks tracked, the least recently used dropped past it
+    static constexpr size_t kTracked = HIT_RATE_MAX_BLOCKS >> HIT_RATE_SAMPLE_SHIFT;
+    static constexpr size_t kSlots = 2 * kTracked;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<uint64_t, size_t> slot_of_; // tracked block -> slot of its latest access
+    std::vector<uint64_t> block_at_;                // slot -> block, where marked
+    std::vector<uint32_t> marks_;                   // Fenwick tree over the slots, 1-based
+    size_t next_slot_ = 0;
+    // reuses[k]: sampled reuses at a scaled distance in (2^(k-1), 2^k]
+    std::vector<uint64_t> reuses_ = std::vector<uint64_t>(64, 0);
+    uint64_t samples_ = 0;
+
+    void sample(uint64_t block);
+    void mark(size_t slot, int delta);
+    size_t marked_up_to(size_t slot) const; // marks in slots [0, slot]
+    size_t first_marked() const;
+    void compact();
+};
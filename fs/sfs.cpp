@@ -1,5 +1,4 @@
 #include <map>
-#include <sstream>
 #include <cstring>
 #include <iostream>
 #include <vector>
@@ -7,76 +6,234 @@
 #include "inode.h"
 #include "dir.h"
 #include "block_manager.h"
+#include "bmap.h"
 #include "disk.h"
 #include "block_cache_controller.h"
 
+// Resolves a path from the root, one dir_lookup (a dentry cache hit when warm) per component.
+// Paths that resolve are remembered whole.
 static int lookup_path(FSContext &ctx, const std::string &path) {
-    std::stringstream ss(path);
+    int cur;
+    if (ctx.dcache.lookupPath(path, cur)) return cur;
+    cur = 1;
     std::string comp;
-
-    int cur = 1;
-    while (std::getline(ss, comp, '/')) {
-        if (comp.empty()) continue;
-        cur = dir_lookup(ctx, cur, comp);
-        if (cur < 0) return -1;
+    for (size_t pos = 0; pos < path.size();) {
+        size_t end = path.find('/', pos);
+        if (end == std::string::npos) end = path.size();
+        if (end > pos) {
+            comp.assign(path, pos, end - pos);
+            cur = dir_lookup(ctx, cur, comp);
+            if (cur < 0) return -1;
+        }
+        pos = end + 1;
     }
+    ctx.dcache.insertPath(path, cur);
     return cur;
 }
 
-static int get_data_block_index(FSContext &ctx, Inode &ino, int file_block_index, bool allocate = false) {
-    if (file_block_index < NDIRECT) {
-        if (allocate && ino.direct[file_block_index] == 0)
-            ino.direct[file_block_index] = block_alloc(ctx);
-        return ino.direct[file_block_index];
-    } else {
-        if (ino.indirect == 0 && allocate) {
-            ino.indirect = block_alloc(ctx);
-            char zero[BLOCK_SIZE] = {0};
-            //if (!ctx.disk.disk_write(ino.indirect, zero)) return -1;
-            if (ctx.use_cache) {
-                ctx.cache_controller->writeBlock(ino.indirect, zero);
-            } else {
-                if (!ctx.disk->disk_write(ino.indirect, zero)) return -1;
-            }
+// Moves `count` physically contiguous blocks with one vectored I/O, through the cache when enabled.
+static bool read_run(FSContext &ctx, uint32_t first_block, int count, char* out) {
+    if (ctx.use_cache) return ctx.cache_controller->readBlocks(first_block, count, out);
+    return ctx.disk->read_blocks(first_block, count, out) == 0;
+}
+
+static bool write_run(FSContext &ctx, uint32_t first_block, int count, const char* in) {
+    if (ctx.use_cache) {
+        ctx.cache_controller->writeBlocks(first_block, count, in);
+        return true;
+    }
+    return ctx.disk->write_blocks(first_block, count, in) == 0;
+}
+
+// Byte-range versions over a run starting at first_block. Whole blocks move straight between
+// the caller's buffer and the cache or disk; partial edge blocks are worked on in place through
+// block_load, so only the requested bytes are copied.
+static bool read_range(FSContext &ctx, uint32_t first_block, int offset, int len, char* out) {
+    uint32_t block = first_block + offset / BLOCK_SIZE;
+    offset %= BLOCK_SIZE;
+    char scratch[BLOCK_SIZE];
+    while (len > 0) {
+        if (offset == 0 && len >= BLOCK_SIZE) {
+            int whole = len / BLOCK_SIZE;
+            if (!read_run(ctx, block, whole, out)) return false;
+            block += whole;
+            out += whole * BLOCK_SIZE;
+            len -= whole * BLOCK_SIZE;
+            continue;
         }
-        if (ino.indirect == 0) return 0;
+        int n = std::min(len, BLOCK_SIZE - offset);
+        BlockRef ref;
+        const char* data = block_load(ctx, block, ref, scratch);
+        if (!data) return false;
+        std::memcpy(out, data + offset, n);
+        ++block;
+        out += n;
+        len -= n;
+        offset = 0;
+    }
+    return true;
+}
 
-        uint32_t indirect_block[NINDIRECT];
-        //if (!ctx.disk.disk_read(ino.indirect, (char*)indirect_block)) return -1;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(ino.indirect);
-            std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-        } else {
-            if (!ctx.disk->disk_read(ino.indirect, (char*)indirect_block)) return -1; 
+static bool write_range(FSContext &ctx, uint32_t first_block, int offset, int len, const char* in) {
+    uint32_t block = first_block + offset / BLOCK_SIZE;
+    offset %= BLOCK_SIZE;
+    char scratch[BLOCK_SIZE];
+    while (len > 0) {
+        if (offset == 0 && len >= BLOCK_SIZE) {
+            int whole = len / BLOCK_SIZE;
+            if (!write_run(ctx, block, whole, in)) return false;
+            block += whole;
+            in += whole * BLOCK_SIZE;
+            len -= whole * BLOCK_SIZE;
+            continue;
         }
+        // Partial block: read-modify-write of just these bytes
+        int n = std::min(len, BLOCK_SIZE - offset);
+        BlockRef ref;
+        char* data = block_load(ctx, block, ref, scratch);
+        if (!data) return false;
+        std::memcpy(data + offset, in, n);
+        if (!block_store(ctx, block, ref, data)) return false;
+        ++block;
+        in += n;
+        len -= n;
+        offset = 0;
+    }
+    return true;
+}
 
-        int idx = file_block_index - NDIRECT;
-        if (allocate && indirect_block[idx] == 0) {
-            indirect_block[idx] = block_alloc(ctx);
-            // if (!ctx.disk.disk_write(ino.indirect, (char*)indirect_block)) return -1;
-            if (ctx.use_cache) {
-                ctx.cache_controller->writeBlock(ino.indirect, (char*)indirect_block);
-            } else {
-                if (!ctx.disk->disk_write(ino.indirect, (char*)indirect_block)) return -1;
+// Number of file blocks starting at file_block_index (at most max_blocks) whose data blocks
+// are physically consecutive after first_block, so they can be moved as one run. `run` is how
+// many the lookup of first_block already vouched for; one lookup per extent covers the rest.
+static int contiguous_run(FSContext &ctx, OpenFile &of, const Inode &ino, int file_block_index, int first_block,
+                          int run, int max_blocks) {
+    int limit = std::min(max_blocks, MAX_IO_BLOCKS);
+    while (run < limit) {
+        int more;
+        int next = bmap_lookup(ctx, ino, file_block_index + run, &more, &of.map);
+        if (next != first_block + run) break;
+        run += more;
+    }
+    return std::min(run, limit);
+}
+
+// On-demand readahead in the style of Linux's. A read is sequential when it starts in or right
+// after the block the previous read on this fd ended in. The first sequential read starts a
+// window just past the request; when a later read reaches the window's first block (the marker),
+// the next window is issued at twice the size, up to READAHEAD_MAX_BLOCKS, so fetching stays a
+// window ahead of the reader. Anything else drops the window. Windows are resolved through the
+// inode to physical runs and handed to the cache's asynchronous prefetch.
+static void readahead(FSContext &ctx, OpenFile &of, const Inode &ino, int first, int last) {
+    // Without the cache the kernel already reads ahead (page cache or mapping), and O_DIRECT
+    // has nowhere to read ahead into
+    if (!ctx.use_cache) return;
+    Readahead &ra = of.ra;
+    bool sequential = first == ra.prev || first == ra.prev + 1;
+    ra.prev = last;
+    if (!sequential) {
+        ra.size = 0;
+        return;
+    }
+    int from, size;
+    if (ra.size == 0) {
+        from = last + 1;
+        size = std::min(std::max(2 * (last - first + 1), READAHEAD_MIN_BLOCKS), READAHEAD_MAX_BLOCKS);
+    } else if (last >= ra.marker) {
+        from = std::max(ra.start + ra.size, last + 1);
+        size = std::min(2 * ra.size, READAHEAD_MAX_BLOCKS);
+    } else {
+        return;
+    }
+    ra.start = ra.marker = from;
+    ra.size = size;
+
+    int file_blocks = (int)((ino.size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    int end = std::min(from + size, file_blocks);
+    uint32_t run_start = 0;
+    int run = 0;
+    for (int b = from; b < end;) {
+        int mapped;
+        int block_no = bmap_lookup(ctx, ino, b, &mapped);
+        if (block_no < 0) break;
+        mapped = std::min(mapped, end - b);
+        b += mapped;
+        if (block_no == 0) { // holes read as zeros, nothing to fetch
+            if (run > 0) ctx.cache_controller->prefetch(run_start, run);
+            run = 0;
+            continue;
+        }
+        for (int i = 0; i < mapped; ++i) {
+            if (run > 0 && (uint32_t)block_no + i == run_start + run && run < MAX_IO_BLOCKS) {
+                ++run;
+                continue;
             }
+            if (run > 0) ctx.cache_controller->prefetch(run_start, run);
+            run_start = block_no + i;
+            run = 1;
         }
-        return indirect_block[idx];
     }
+    if (run > 0) ctx.cache_controller->prefetch(run_start, run);
 }
 
 bool sfs_init(FSContext &ctx, const std::string &disk_image) {
-    
+    Superblock fresh;
+    if (!superblock_layout(ctx.geometry, fresh)) {
+        std::cerr<<"Invalid geometry: "<<ctx.geometry.num_blocks<<" blocks, "<<ctx.geometry.num_inodes<<" inodes.\n";
+        return false;
+    }
+    DiskOptions options;
+    options.engine = ctx.io_engine;
+    options.mode = ctx.disk_mode;
+    options.create_blocks = fresh.num_blocks;
+    options.preallocate = ctx.preallocate;
     ctx.disk = std::make_shared<Disk>();
-    if (!ctx.disk->disk_init(disk_image)) {
+    if (!ctx.disk->disk_init(disk_image, options)) {
         std::cerr<<"Failed to initialize disk.\n";
         return false;
     }
-    if (ctx.use_cache) {
-        size_t block_size = BLOCK_SIZE;
-        size_t cache_blocks = CACHE_NUM_BLOCKS;
-        ctx.init_cache(cache_blocks, block_size);
+
+    // mkfs happens here: an image without a superblock gets one sized to the file
+    bool formatted = false;
+    if (!superblock_read(*ctx.disk, ctx.sb)) {
+        if (ctx.sb.magic == SFS_MAGIC) {
+            std::cerr<<"Image "<<disk_image<<" has a superblock this build cannot mount.\n";
+            return false;
+        }
+        if (superblock_detect_legacy(*ctx.disk, ctx.sb)) {
+            std::cout<<"[SFS] Adding a superblock to legacy image "<<disk_image<<"\n";
+        } else {
+            FSGeometry geometry{ctx.disk->disk_get_num_blocks(), fresh.num_inodes};
+            if (!superblock_layout(geometry, ctx.sb)) {
+                std::cerr<<"Image "<<disk_image<<" is too small to format.\n";
+                return false;
+            }
+            formatted = true;
+        }
+        if (!superblock_write(*ctx.disk, ctx.sb)) {
+            std::cerr<<"Failed to write superblock.\n";
+            return false;
+        }
+    }
+    if (ctx.sb.num_blocks > ctx.disk->disk_get_num_blocks()) {
+        std::cerr<<"Image "<<disk_image<<" is shorter than its superblock says.\n";
+        return false;
+    }
+    std::cout<<"[SFS] "<<disk_image<<": "<<ctx.sb.num_blocks<<" blocks, "<<ctx.sb.num_inodes<<" inodes\n";
+    // Superblock and inode table see small scattered accesses; skip readaround there
+    ctx.disk->disk_advise(0, ctx.sb.data_start, DiskAccess::Random);
+    if (ctx.use_cache && !ctx.init_cache()) {
+        std::cerr<<"Cannot reserve "<<ctx.cache_reserved_blocks<<" cache blocks for "<<disk_image<<".\n";
+        return false;
+    }
+    block_manager_init(ctx, formatted);
+    if (ctx.sb.version >= 2 && ctx.sb.version < SFS_VERSION) {
+        // New inodes on this image are extent-mapped from now on and large directories get
+        // indexed; the existing inodes keep their format, which each records in its mode
+        // (INODE_EXTENTS, INODE_DIR_INDEX)
+        Superblock sb = ctx.sb;
+        sb.version = SFS_VERSION;
+        if (superblock_write(*ctx.disk, sb)) ctx.sb = sb;
     }
-    block_manager_init(ctx);
     inode_init(ctx);
     return true;
 }
@@ -90,14 +247,12 @@ int sfs_create(FSContext &ctx, const std::string &path) {
     if (parent < 0) return -1;
     int inum = inode_alloc(ctx);
     if (inum < 0) return -1;
-    int bno = block_alloc(ctx);
-    if (bno < 0) return -1;
-    
+
     Inode ino{};
     ino.mode = 0100644;
     ino.size = 0;
-    ino.direct[0] = bno;
-    ino.indirect = 0;
+    bmap_init(ctx, ino);
+    if (!bmap_alloc(ctx, ino, 0, 1)) return -1;
     inode_write(ctx, inum, ino);
     dir_add(ctx, parent, name, inum);
     return inum;
@@ -112,13 +267,13 @@ int sfs_mkdir(FSContext &ctx, const std::string &path) {
     if (parent < 0) return -1;
     int inum = inode_alloc(ctx);
     if (inum < 0) return -1;
-    int bno = block_alloc(ctx);
-    if (bno < 0) return -1;
 
     Inode ino{};
     ino.mode = 0040755;
     ino.size = 0;
-    ino.direct[0] = bno;
+    bmap_init(ctx, ino);
+    if (!bmap_alloc(ctx, ino, 0, 1)) return -1;
+    int bno = bmap_lookup(ctx, ino, 0);
     inode_write(ctx, inum, ino);
     char blockBuf[4096] = {0};
     //ctx.disk.disk_write(bno, blockBuf);
@@ -135,8 +290,11 @@ int sfs_open(FSContext &ctx, const std::string &path) {
     int inum = lookup_path(ctx, path);
     if (inum < 0) inum = sfs_create(ctx, path);
     if (inum < 0) return -1;
+    // The fd keeps its inode pinned in the icache until sfs_close
+    Inode* ino = ctx.icache.get(ctx, inum);
+    if (!ino) return -1;
     int fd = ctx.next_fd++;
-    ctx.fd_table[fd] = {inum, 0};
+    ctx.fd_table[fd] = {inum, 0, {}, {}, ino};
     return fd;
 }
 
@@ -145,29 +303,38 @@ int sfs_read(FSContext &ctx, int fd, char* buf, int size) {
     if (it == ctx.fd_table.end()) return -1;
     // 1. Getting fd for its inum and offset
     OpenFile &of = it->second;
-    Inode ino{};
-    
-    if (!inode_read(ctx, of.inum, ino)) return -1;
+    const Inode &ino = *of.ino;
+    if (size > 0 && of.offset < (int)ino.size) {
+        // In 64 bits, like sfs_seek: offset + size can pass INT_MAX near the end of a large file
+        int64_t end = std::min<int64_t>((int64_t)of.offset + size, ino.size);
+        readahead(ctx, of, ino, of.offset / BLOCK_SIZE, (int)((end - 1) / BLOCK_SIZE));
+    }
     int total = 0;
     // Reading bytes until 1) size bytes  and 2) no bytes left to read
-    while (total < size && of.offset < ino.size) {
+    while (total < size && of.offset < (int)ino.size) {
         int block_idx = of.offset / BLOCK_SIZE;
-        int inner_offset = of.offset / BLOCK_SIZE;
-        int block_no = get_data_block_index(ctx, ino, block_idx, true);
-        if (block_no == 0) break;
+        int inner_offset = of.offset % BLOCK_SIZE;
+        int want = std::min(size - total, (int)ino.size - of.offset);
+        int run;
+        int block_no = bmap_lookup(ctx, ino, block_idx, &run, &of.map);
+        if (block_no < 0) return -1;
 
-        char blockBuf[BLOCK_SIZE];
-        //if (!ctx.disk.disk_read(block_no, blockBuf)) return -1;
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(block_no);
-            std::memcpy(blockBuf, data.data(), BLOCK_SIZE);
+        int chunk;
+        if (block_no == 0) {
+            // Hole: never written, reads as zeros
+            chunk = std::min(want, BLOCK_SIZE - inner_offset);
+            std::memset(buf + total, 0, chunk);
         } else {
-            if (!ctx.disk->disk_read(block_no, blockBuf)) return -1;
+            int last_idx = (int)(((int64_t)of.offset + want - 1) / BLOCK_SIZE);
+            run = contiguous_run(ctx, of, ino, block_idx, block_no, run, last_idx - block_idx + 1);
+            chunk = std::min(want, run * BLOCK_SIZE - inner_offset);
+            if (const char* mapped = ctx.use_cache ? nullptr : ctx.disk->block_ptr(block_no)) {
+                // Mapped image: copy straight out of the mapping
+                std::memcpy(buf + total, mapped + inner_offset, chunk);
+            } else if (!read_range(ctx, block_no, inner_offset, chunk, buf + total)) {
+                return -1;
+            }
         }
-
-        int chunk = std::min(size - total, BLOCK_SIZE - inner_offset);
-        chunk = std::min(chunk, (int)ino.size - of.offset);
-        std::memcpy(buf + total, blockBuf + inner_offset, chunk);
         of.offset += chunk;
         total += chunk;
     }
@@ -180,47 +347,65 @@ int sfs_write(FSContext &ctx, int fd, const char* buf, int size) {
     if (it == ctx.fd_table.end()) return -1;
     OpenFile &of = it->second;
 
-    // 2) Load inode
-    Inode ino;
-    if (!inode_read(ctx, of.inum, ino)) return -1;
+    // 2) The inode is pinned in the icache; it is updated in place and only marked dirty, so a
+    //    small append into an already mapped block costs no inode-table I/O
+    Inode &ino = *of.ino;
+    Inode before = ino;
+    // On every exit from here on: bmap_alloc may have mapped blocks, which must reach the inode
+    // table or they stay allocated in the bitmaps with nothing pointing at them
+    auto mark_changed = [&] {
+        if (std::memcmp(&before, &ino, sizeof(Inode)) != 0) ctx.icache.markDirty(ctx, of.inum);
+    };
 
     int total = 0;
     const int BLOCK = BLOCK_SIZE;  // your constant for block size
 
+    // 3) Give every block the write touches a data block up front, so the new ones come out
+    //    of the allocator as contiguous runs. The end is taken in 64 bits, as in sfs_seek, and
+    //    a write that would pass the largest file the inode can map is refused whole.
+    int64_t end = (int64_t)of.offset + size;
+    if (size > 0 && end > (int64_t)bmap_max_blocks(ctx, ino) * BLOCK) return -1;
+    int last_block = size > 0 ? (int)((end - 1) / BLOCK) : 0;
+    if (size > 0 && !bmap_alloc(ctx, ino, of.offset / BLOCK, last_block - of.offset / BLOCK + 1)) {
+        mark_changed();
+        return -1;
+    }
+
     while (total < size) {
-        // 3) Compute which block and offset inside it
+        // 4) Compute which block and offset inside it, and how many following blocks
+        //    are physically adjacent so the whole stretch goes out as one write
         int block_idx    = of.offset / BLOCK;
         int inner_offset = of.offset % BLOCK;
-        int block_no     = get_data_block_index(ctx, ino, block_idx, /*allocate=*/true);
-        if (block_no <= 0 || NUM_BLOCKS) return -1;
-
-        // 4) Read the entire block into a local buffer
-        std::vector<char> blockBuf(BLOCK);
-        if (ctx.use_cache) {
-            const auto &cached = ctx.cache_controller->getBlock(block_no);
-            std::memcpy(blockBuf.data(), cached.data(), BLOCK);
-        } else {
-            if (!ctx.disk->disk_read(block_no, blockBuf.data())) return -1;
+        int run;
+        int block_no     = bmap_lookup(ctx, ino, block_idx, &run, &of.map);
+        if (block_no <= 0 || (uint64_t)block_no >= ctx.sb.num_blocks) {
+            mark_changed();
+            return -1;
+        }
+        run = contiguous_run(ctx, of, ino, block_idx, block_no, run, last_block - block_idx + 1);
+        int chunk = std::min(size - total, run * BLOCK - inner_offset);
+        if (char* mapped = ctx.use_cache ? nullptr : ctx.disk->mutable_block_ptr(block_no)) {
+            // Mapped image: the bytes land directly in the page, no read-modify-write
+            std::memcpy(mapped + inner_offset, buf + total, chunk);
+            of.offset += chunk;
+            total     += chunk;
+            continue;
         }
 
-        // 5) Copy just the requested bytes
-        int chunk = std::min(size - total, BLOCK - inner_offset);
-        std::memcpy(blockBuf.data() + inner_offset, buf + total, chunk);
-
-        // 6) Write back
-        if (ctx.use_cache) {
-            ctx.cache_controller->writeBlock(block_no, blockBuf.data());
-        } else {
-            if (!ctx.disk->disk_write(block_no, blockBuf.data())) return -1;
+        // 5) Whole blocks go out as one write; partially overwritten head/tail blocks
+        //    are patched in place
+        if (!write_range(ctx, block_no, inner_offset, chunk, buf + total)) {
+            mark_changed();
+            return -1;
         }
 
         of.offset += chunk;
         total     += chunk;
     }
 
-    // 7) Update file size if grown
+    // 6) Update file size if grown
     ino.size = std::max<uint32_t>(ino.size, of.offset);
-    inode_write(ctx, of.inum, ino);
+    mark_changed();
     return total;
 }
 
@@ -228,18 +413,18 @@ bool sfs_seek(FSContext &ctx, int fd, int offset, int whence) {
     auto it = ctx.fd_table.find(fd);
     if (it == ctx.fd_table.end()) return false;
     OpenFile &of = it->second;
-    int newOffset;
-    Inode ino{};
-    if (!inode_read(ctx, of.inum, ino)) return false;
+    // In 64 bits: extent-mapped files reach nearly INT_MAX, so the sums can overflow an int
+    int64_t newOffset;
+    const Inode &ino = *of.ino;
     switch (whence) {
         case 0: newOffset = offset; break;
-        case 1: newOffset = of.offset + offset; break;
-        case 2: newOffset == ino.size + offset; break;
+        case 1: newOffset = (int64_t)of.offset + offset; break;
+        case 2: newOffset = (int64_t)ino.size + offset; break;
         default: return false;
     }
-    int max_file_bytes = (NDIRECT + NINDIRECT) * BLOCK_SIZE;
+    int64_t max_file_bytes = (int64_t)bmap_max_blocks(ctx, ino) * BLOCK_SIZE;
     if (newOffset < 0 || newOffset >= max_file_bytes) return false;
-    of.offset = newOffset;
+    of.offset = (int)newOffset;
     return true;
 }
 
@@ -263,26 +448,36 @@ bool sfs_remove(FSContext &ctx, const std::string &path) {
     
     Inode ino;
     if (!inode_read(ctx, inum, ino)) return false;
-    for (int i = 0;i < NDIRECT; ++i)
-        if (ino.direct[i])
-            block_free(ctx, ino.direct[i]); // deallocating/free data blocks
-    if (ino.indirect) {
-        uint32_t indirect_block[NINDIRECT];
-        //ctx.disk.disk_read(ino.indirect, (char*)indirect_block);
-        if (ctx.use_cache) {
-            auto& data = ctx.cache_controller->getBlock(ino.indirect);
-            std::memcpy((char*)indirect_block, data.data(), BLOCK_SIZE);
-        } else {
-            ctx.disk->disk_read(ino.indirect, (char*)indirect_block);
-        }
-        for (int i = 0;i < NINDIRECT; ++i) {
-            if (indirect_block[i] == 0) continue;
-            block_free(ctx, indirect_block[i]);
-        }
-        block_free(ctx, ino.indirect);
+    bmap_free(ctx, ino); // deallocating/free data blocks
+    for (auto &entry : ctx.fd_table) {
+        if (entry.second.inum == inum) entry.second.map = BmapRun{};
     }
     if (dir_remove(ctx, parent, name) < 0) return false;
     Inode empty{};
     inode_write(ctx, inum, empty);
+    inode_free(ctx, inum);
+    ctx.dcache.forgetDir(inum); // entries cached under it must not outlive the inum's reuse
     return true;
 }
+
+bool sfs_close(FSContext &ctx, int fd) {
+    auto it = ctx.fd_table.find(fd);
+    if (it == ctx.fd_table.end()) return false;
+    int inum = it->second.inum;
+    bool ok = ctx.icache.sync(ctx, inum);
+    ctx.icache.put(inum);
+    ctx.fd_table.erase(it);
+    return ok;
+}
+
+bool sfs_fsync(FSContext &ctx, int fd) {
+    auto it = ctx.fd_table.find(fd);
+    if (it == ctx.fd_table.end()) return false;
+    if (!ctx.icache.sync(ctx, it->second.inum)) return false;
+    // The block cache keeps no per-file dirty lists, so this writes back the whole mount
+    if (ctx.use_cache) {
+        ctx.cache_controller->flushAll();
+        return true;
+    }
+    return ctx.disk->disk_sync() == 0;
+}
@@ -18,3 +18,7 @@ int sfs_write(FSContext &ctx, int fd, const char* buf, int size);
 bool sfs_seek(FSContext &ctx, int fd, int offset, int whence);
 std::vector<std::string> sfs_listdir(FSContext &ctx, const std::string &path);
 bool sfs_remove(FSContext &ctx, const std::string &path);
+// Writes the file's inode back if it changed and releases the fd
+bool sfs_close(FSContext &ctx, int fd);
+// Writes the file's inode back, then the mount's dirty blocks, and syncs the disk
+bool sfs_fsync(FSContext &ctx, int fd);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <climits>
 #include <cstdint>
 
 // === File System Constants ===
@@ -7,14 +8,58 @@
 constexpr int BLOCK_SIZE = 4096;         // bytes per block
 constexpr int NDIRECT = 12;              // direct pointers per inode
 constexpr int NINDIRECT = BLOCK_SIZE / sizeof(uint32_t); // entries in an indirect block
-constexpr int NUM_INODES = 128;
-constexpr int NUM_BLOCKS = 10240;         // total number of blocks in disk
-constexpr int RESERVED_BLOCKS = 1 + 16; // 1 SUPERBLOCK + 16 INODE BLOCKS
+// Geometry of a new image unless the mount asks for another; an existing image's
+// geometry comes from its superblock (see superblock.h)
+constexpr int DEFAULT_NUM_INODES = 128;
+constexpr int DEFAULT_NUM_BLOCKS = 10240;  // 40 MB
 
 // Cache Stats
-constexpr int CACHE_NUM_BLOCKS = 1024;
+constexpr int CACHE_NUM_BLOCKS = 1024;     // a mount's private cache
+constexpr int SHARED_CACHE_BLOCKS = 65536; // fs_server's cache shared by all mounts (256 MB)
+constexpr int CACHE_SHARDS = 16;        // upper bound on independently locked block-cache shards
+constexpr int CACHE_METADATA_PERCENT = 50; // share of a cache where metadata blocks are evicted after data
+
+// Background writeback of dirty cache blocks (BlockCache::flusherLoop)
+constexpr int WRITEBACK_INTERVAL_MS = 500;  // flusher wakeup period
+constexpr int DIRTY_EXPIRE_MS = 3000;       // a block dirty this long is written on the next pass
+constexpr int DIRTY_BACKGROUND_PERCENT = 10; // above this share of the cache every dirty block is written
+constexpr int DIRTY_LIMIT_PERCENT = 40;     // above this share writers wait for the flusher
+
+// Inodes kept decoded in a mount's inode cache (InodeCache) besides those open files pin
+constexpr int ICACHE_INODES = 4096;
+
+// Dentry cache (DentryCache): (directory, name) lookups and whole resolved paths kept per mount
+constexpr int DCACHE_ENTRIES = 65536;
+constexpr int DCACHE_PATHS = 4096;
+
+// A directory is indexed by name hash (INODE_DIR_INDEX) once this many of its blocks are full
+// (64 entries); below that a linear scan is as cheap
+constexpr int DIR_INDEX_BLOCKS = 4;
+
+// Sequential readahead (sfs_read): the window starts at twice the request, at least MIN, and
+// doubles with every window consumed up to MAX
+constexpr int READAHEAD_MIN_BLOCKS = 4;
+constexpr int READAHEAD_MAX_BLOCKS = 32;    // 128 KB, Linux's default
+
+// Hit-rate curve estimation (HitRateCurve): one block in 2^SHIFT is sampled; cache sizes up to
+// MAX blocks are covered
+constexpr int HIT_RATE_SAMPLE_SHIFT = 4;
+constexpr uint64_t HIT_RATE_MAX_BLOCKS = 1 << 16;
+
+// Multi-block allocation (block_alloc_range): free runs looked at for one long enough before
+// the longest of them is taken, and the room left after another file's blocks when a growing
+// file has to start a new run (one full vectored I/O)
+constexpr int ALLOC_RUN_PROBES = 32;
+constexpr int ALLOC_GAP_BLOCKS = 64;
+
+// Longest run of contiguous blocks moved by a single vectored I/O
+constexpr int MAX_IO_BLOCKS = 64;
+// Requests the async I/O engine keeps in flight at once
+constexpr unsigned IO_QUEUE_DEPTH = 64;
 
 // Optional: max file size calculation
 constexpr int MAX_FILE_BLOCKS = NDIRECT + NINDIRECT;
 constexpr int MAX_FILE_SIZE = MAX_FILE_BLOCKS * BLOCK_SIZE;
+// Extent-mapped files are bounded only by offsets travelling as int through the FS API
+constexpr int MAX_EXTENT_FILE_BLOCKS = INT_MAX / BLOCK_SIZE;
 
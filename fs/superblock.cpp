@@ -0,0 +1,73 @@
+#include "superblock.h"
+#include "disk.h"
+#include "inode.h"
+#include "aligned_buffer.h"
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+bool superblock_layout(const FSGeometry& geometry, Superblock& out) {
+    uint64_t num_blocks = geometry.num_blocks ? geometry.num_blocks : DEFAULT_NUM_BLOCKS;
+    uint64_t num_inodes = geometry.num_inodes ? geometry.num_inodes : DEFAULT_NUM_INODES;
+    // Block and inode numbers travel as int through the FS API
+    if (num_blocks > INT_MAX || num_inodes > INT_MAX || num_inodes < 2) return false;
+
+    std::memset(&out, 0, sizeof(out));
+    out.magic = SFS_MAGIC;
+    out.version = SFS_VERSION;
+    out.block_size = BLOCK_SIZE;
+    out.inode_size = sizeof(Inode);
+    out.num_blocks = num_blocks;
+    out.num_inodes = num_inodes;
+    out.inode_table_start = 1;
+    out.inode_table_blocks = (num_inodes + INODES_PER_BLOCK - 1) / INODES_PER_BLOCK;
+    out.inode_bitmap_start = out.inode_table_start + out.inode_table_blocks;
+    out.inode_bitmap_blocks = bitmap_blocks(num_inodes);
+    out.block_bitmap_start = out.inode_bitmap_start + out.inode_bitmap_blocks;
+    out.block_bitmap_blocks = bitmap_blocks(num_blocks);
+    out.data_start = out.block_bitmap_start + out.block_bitmap_blocks;
+    // Room for at least the root directory block
+    return out.data_start < num_blocks;
+}
+
+bool superblock_read(Disk& disk, Superblock& out) {
+    AlignedPtr buf = make_aligned(BLOCK_SIZE);
+    if (!disk.disk_read(0, buf.get())) return false;
+    std::memcpy(&out, buf.get(), sizeof(out));
+    if (out.magic != SFS_MAGIC) return false;
+    if (out.version > SFS_VERSION || out.block_size != BLOCK_SIZE || out.inode_size != sizeof(Inode)) {
+        std::cerr<<"[Superblock] unsupported image: version "<<out.version<<", block size "
+                 <<out.block_size<<", inode size "<<out.inode_size<<"\n";
+        return false;
+    }
+    return true;
+}
+
+bool superblock_write(Disk& disk, const Superblock& sb) {
+    AlignedPtr buf = make_aligned(BLOCK_SIZE);
+    std::memset(buf.get(), 0, BLOCK_SIZE);
+    std::memcpy(buf.get(), &sb, sizeof(sb));
+    return disk.disk_write(0, buf.get()) && disk.disk_sync() == 0;
+}
+
+bool superblock_detect_legacy(Disk& disk, Superblock& out) {
+    constexpr uint64_t kLegacyBlocks = 10240, kLegacyInodes = 128, kLegacyTableBlocks = 16;
+    if (disk.disk_get_num_blocks() < kLegacyBlocks) return false;
+    AlignedPtr buf = make_aligned(BLOCK_SIZE);
+    if (!disk.disk_read(1, buf.get())) return false;
+    Inode root;
+    std::memcpy(&root, buf.get() + sizeof(Inode), sizeof(Inode));
+    if (root.mode == 0) return false;
+
+    std::memset(&out, 0, sizeof(out));
+    out.magic = SFS_MAGIC;
+    out.version = 1; // block_manager_init adds the bitmaps
+    out.block_size = BLOCK_SIZE;
+    out.inode_size = sizeof(Inode);
+    out.num_blocks = kLegacyBlocks;
+    out.num_inodes = kLegacyInodes;
+    out.inode_table_start = 1;
+    out.inode_table_blocks = kLegacyTableBlocks;
+    out.data_start = 1 + kLegacyTableBlocks;
+    return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include "stat.h"
+#include "bitmap.h"
+
+class Disk;
+
+constexpr uint32_t SFS_MAGIC = 0x31534653; // "SFS1"
+// 2 added the on-disk bitmaps, 3 extent-mapped inodes, 4 indexed directories
+constexpr uint32_t SFS_VERSION = 4;
+constexpr uint32_t SFS_VERSION_EXTENTS = 3;
+constexpr uint32_t SFS_VERSION_DIR_INDEX = 4;
+
+// Block 0 of every image. Geometry is fixed when the image is formatted and read back on
+// every mount; BLOCK_SIZE stays a compile-time constant and is only recorded for checking.
+struct Superblock {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint32_t inode_size;
+    uint64_t num_blocks;         // image size in blocks
+    uint64_t num_inodes;         // inode 0 is never used, inode 1 is the root directory
+    uint64_t inode_table_start;  // first block of the inode table
+    uint64_t inode_table_blocks;
+    uint64_t data_start;         // first block handed out by block_alloc
+    // Allocation bitmaps (see bitmap.h), one bit per inode and per block. Zero on version 1
+    // images until block_manager_init places them in free space.
+    uint64_t inode_bitmap_start;
+    uint64_t inode_bitmap_blocks;
+    uint64_t block_bitmap_start;
+    uint64_t block_bitmap_blocks;
+};
+
+// Requested at mkfs time; zero fields take the defaults from stat.h
+struct FSGeometry {
+    uint64_t num_blocks = 0;
+    uint64_t num_inodes = 0;
+};
+
+// Lays out a fresh image. Returns false if the geometry cannot work (too small or too big).
+bool superblock_layout(const FSGeometry& geometry, Superblock& out);
+
+// Reads block 0; false if it does not hold a valid superblock. `out` is filled either way, so a
+// magic that matches tells an image from a newer version apart from an unformatted one.
+bool superblock_read(Disk& disk, Superblock& out);
+bool superblock_write(Disk& disk, const Superblock& sb);
+
+// Images written before the superblock existed: fixed 40 MB / 128 inode geometry with a
+// 16-block inode table. Recognised by an initialised root inode in the old position.
+bool superblock_detect_legacy(Disk& disk, Superblock& out);
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <string>
+#include "sfs.h"
+#include "test_util.h"
+#include "bitmap.h"
+
+static std::string content(int i) { return std::string(1000 + i * 4099 % 50000, 'a' + i % 26); }
+
+// A search skips full words through the summary level, and a bit cleared in a full word is
+// found again. Bits past the end never read as free.
+static void test_summary_skip() {
+    const uint64_t bits = 64 * 64 * 3 + 100;
+    Bitmap map;
+    map.assign(bits);
+    for (uint64_t i = 0; i < bits; ++i) map.set(i);
+    assert(map.count_set() == bits);
+    assert(map.find_clear(0, 0) == Bitmap::npos);
+
+    uint64_t hole = 64 * 64 * 2 + 64 * 7 + 13; // under the third summary word
+    map.clear(hole);
+    assert(map.find_clear(0, 0) == hole);
+    assert(map.find_clear(0, hole + 1) == hole); // found after wrapping to lo
+    assert(map.find_clear(hole + 1, hole + 1) == Bitmap::npos);
+    uint64_t got = map.alloc(0);
+    assert(got == hole);
+    assert(map.alloc(0) == Bitmap::npos);
+
+    Bitmap tail;
+    tail.assign(100);
+    for (uint64_t i = 0; i < 100; ++i) tail.set(i);
+    assert(tail.alloc(0) == Bitmap::npos);
+    std::cout << "[Bitmap] summary skip OK\n";
+}
+
+// Allocation resumes after the previous one and wraps around to lo, never below it
+static void test_hint_wraps() {
+    const uint64_t lo = 10;
+    Bitmap map;
+    map.assign(1000);
+    for (uint64_t i = lo; i < 500; ++i) {
+        uint64_t got = map.alloc(lo);
+        assert(got == i);
+    }
+    map.clear(20);
+    uint64_t got = map.alloc(lo);
+    assert(got == 500); // not back to the freed bit yet
+    for (uint64_t i = 501; i < 1000; ++i) map.alloc(lo);
+    got = map.alloc(lo);
+    assert(got == 20);
+    assert(map.alloc(lo) == Bitmap::npos);
+    assert(!map.test(0) && !map.test(lo - 1));
+
+    // A run search wraps the same way: the first run long enough, else the longest
+    for (uint64_t i = 30; i < 41; ++i) map.clear(i);
+    uint64_t n;
+    got = map.alloc_run(lo, 0, 8, 0, n);
+    assert(got == 30 && n == 8);
+    got = map.alloc_run(lo, 0, 8, 0, n);
+    assert(got == 38 && n == 3);
+    assert(map.alloc_run(lo, 0, 8, 0, n) == Bitmap::npos && n == 0);
+    std::cout << "[Bitmap] hint wrap-around OK\n";
+}
+
+// A run across the boundary of two bitmap blocks is set and freed in both, on disk
+static void test_free_range_spans_blocks(bool cache) {
+    const std::string img = "test_bitmap_range.img";
+    remove_image(img);
+    const uint64_t goal = BITS_PER_BLOCK - 10;
+    uint64_t base;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, cache);
+        base = ctx.block_bitmap.count_set();
+        int got;
+        int first = block_alloc_range(ctx, 20, got, goal);
+        assert(first == (int)goal && got == 20);
+        unmount(ctx);
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, cache);
+        for (uint64_t b = goal; b < goal + 20; ++b) assert(ctx.block_bitmap.test(b));
+        assert(ctx.block_bitmap.count_set() == base + 20);
+        block_free_range(ctx, goal, 20);
+        unmount(ctx);
+    }
+    {
+        FSContext ctx(3);
+        mount(ctx, img, cache);
+        for (uint64_t b = goal; b < goal + 20; ++b) assert(!ctx.block_bitmap.test(b));
+        assert(ctx.block_bitmap.count_set() == base);
+    }
+    remove_image(img);
+    std::cout << "[Bitmap] free range across bitmap blocks OK (cache " << cache << ")\n";
+}
+
+// The bitmaps an image has on disk match what a scan of the inode table gives
+static bool match_rebuild(FSContext& ctx) {
+    Bitmap blocks = ctx.block_bitmap, inodes = ctx.inode_bitmap;
+    ctx.block_bitmap.assign(ctx.sb.num_blocks);
+    ctx.inode_bitmap.assign(ctx.sb.num_inodes);
+    for (uint64_t b = 0; b < ctx.sb.data_start; ++b) ctx.block_bitmap.set(b);
+    uint64_t bitmaps_end = ctx.sb.block_bitmap_start + ctx.sb.block_bitmap_blocks;
+    for (uint64_t b = ctx.sb.inode_bitmap_start; b < bitmaps_end; ++b) ctx.block_bitmap.set(b);
+    ctx.inode_bitmap.set(0);
+    inode_mark_used(ctx);
+    for (uint64_t b = 0; b < ctx.sb.num_blocks; ++b) {
+        if (blocks.test(b) != ctx.block_bitmap.test(b)) return false;
+    }
+    for (uint64_t i = 0; i < ctx.sb.num_inodes; ++i) {
+        if (inodes.test(i) != ctx.inode_bitmap.test(i)) return false;
+    }
+    return true;
+}
+
+// A version 1 image (no bitmaps on disk, block-pointer inodes) gets bitmaps in its data area on
+// the first mount, matching an inode-table rebuild from then on
+static void test_v1_upgrade() {
+    const std::string img = "test_bitmap_v1.img";
+    remove_image(img);
+    const int files = 30;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, false);
+        ctx.sb.version = 1; // new inodes use block pointers, as a version 1 build wrote them
+        for (int i = 0; i < files; ++i) {
+            int fd = sfs_open(ctx, "/f" + std::to_string(i));
+            std::string c = content(i);
+            int written = sfs_write(ctx, fd, c.data(), c.size());
+            assert(written == (int)c.size());
+            sfs_close(ctx, fd);
+        }
+        for (int i = 0; i < files; i += 3) sfs_remove(ctx, "/f" + std::to_string(i));
+        Superblock v1 = ctx.sb;
+        v1.inode_bitmap_start = v1.inode_bitmap_blocks = 0;
+        v1.block_bitmap_start = v1.block_bitmap_blocks = 0;
+        bool ok = superblock_write(*ctx.disk, v1);
+        assert(ok);
+    }
+    uint64_t used;
+    {
+        FSContext ctx(2);
+        mount(ctx, img, false);
+        assert(ctx.sb.version == SFS_VERSION);
+        assert(ctx.sb.inode_bitmap_start >= ctx.sb.data_start);
+        used = ctx.block_bitmap.count_set();
+    }
+    {
+        FSContext ctx(3);
+        mount(ctx, img, false);
+        assert(ctx.block_bitmap.count_set() == used);
+        assert(match_rebuild(ctx));
+        for (int i = 0; i < files; ++i) {
+            std::string path = "/f" + std::to_string(i), c = content(i);
+            std::vector<std::string> root = sfs_listdir(ctx, "/");
+            bool listed = std::find(root.begin(), root.end(), path.substr(1)) != root.end();
+            assert(listed == (i % 3 != 0));
+            if (!listed) continue;
+            int fd = sfs_open(ctx, path);
+            std::string back(c.size(), '\0');
+            int got = sfs_read(ctx, fd, back.data(), back.size());
+            assert(got == (int)c.size() && back == c);
+            sfs_close(ctx, fd);
+        }
+    }
+    remove_image(img);
+    std::cout << "[Bitmap] version 1 upgrade OK\n";
+}
+
+int main() {
+    test_summary_skip();
+    test_hint_wraps();
+    test_free_range_spans_blocks(false);
+    test_free_range_spans_blocks(true);
+    test_v1_upgrade();
+    return 0;
+}
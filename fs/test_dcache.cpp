@@ -0,0 +1,110 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "sfs.h"
+#include "test_util.h"
+#include "dcache.h"
+#include "dir.h"
+
+// The cache on its own: negative entries, what added/removed/forgetDir drop, and both bounds
+static void test_entries() {
+    DentryCache dcache(4, 2);
+    int inum;
+    dcache.insert(1, "a", DentryCache::kMissing);
+    assert(dcache.lookup(1, "a", inum) && inum == DentryCache::kMissing);
+    dcache.added(1, "a", 7); // the negative entry becomes the new inum
+    assert(dcache.lookup(1, "a", inum) && inum == 7);
+
+    // Adding a name that is cached with an inum may shadow it: the entry and every path go
+    dcache.insertPath("/a", 7);
+    dcache.added(1, "a", 8);
+    assert(!dcache.lookup(1, "a", inum) && !dcache.lookupPath("/a", inum));
+
+    dcache.insert(1, "b", 9);
+    dcache.insert(2, "c", 10);
+    dcache.insertPath("/b", 9);
+    dcache.removed(1, "b");
+    assert(!dcache.lookup(1, "b", inum) && !dcache.lookupPath("/b", inum));
+    assert(dcache.lookup(2, "c", inum) && inum == 10);
+
+    dcache.insert(2, "d", 11);
+    dcache.insert(3, "e", 12);
+    dcache.insertPath("/x/c", 10);
+    dcache.forgetDir(2);
+    assert(!dcache.lookup(2, "c", inum) && !dcache.lookup(2, "d", inum) && !dcache.lookupPath("/x/c", inum));
+    assert(dcache.lookup(3, "e", inum) && dcache.size() == 1);
+
+    // Least recently used entries go first; the path cache empties when full
+    for (int i = 0; i < 4; ++i) dcache.insert(4, "f" + std::to_string(i), 20 + i);
+    assert(dcache.size() == 4 && !dcache.lookup(3, "e", inum));
+    assert(dcache.lookup(4, "f0", inum));
+    dcache.insert(4, "f4", 24);
+    assert(dcache.lookup(4, "f0", inum) && !dcache.lookup(4, "f1", inum));
+    dcache.insertPath("/p", 1);
+    dcache.insertPath("/q", 2);
+    dcache.insertPath("/r", 3);
+    assert(!dcache.lookupPath("/p", inum) && dcache.lookupPath("/r", inum) && inum == 3);
+    std::cout << "[DCache] entries OK\n";
+}
+
+static int open_inum(FSContext& ctx, const std::string& path) {
+    int fd = sfs_open(ctx, path);
+    assert(fd >= 0);
+    int inum = ctx.fd_table.at(fd).inum;
+    sfs_close(ctx, fd);
+    return inum;
+}
+
+// A name looked up while missing and then created, a file removed and created again, and a
+// removed directory whose inum comes back: each lookup gives what the directory now holds
+static void test_mount(bool cache) {
+    const std::string img = "test_dcache.img";
+    remove_image(img);
+    FSContext ctx(1);
+    mount(ctx, img, cache);
+    int dir = sfs_mkdir(ctx, "/d");
+    assert(dir > 0);
+
+    // The negative entry the failed lookup left is replaced by the create, not just dropped
+    int missing = dir_lookup(ctx, dir, "f");
+    int inum;
+    assert(missing == -1 && ctx.dcache.lookup(dir, "f", inum) && inum == DentryCache::kMissing);
+    int first = open_inum(ctx, "/d/f");
+    uint64_t misses = ctx.dcache.stats().misses;
+    assert(dir_lookup(ctx, dir, "f") == first && ctx.dcache.stats().misses == misses);
+
+    // Resolved once, /d/f is in the path cache; the remove must drop it
+    assert(open_inum(ctx, "/d/f") == first);
+    bool removed = sfs_remove(ctx, "/d/f");
+    assert(removed && dir_lookup(ctx, dir, "f") == -1);
+    int second = open_inum(ctx, "/d/f");
+    assert(second != first && dir_lookup(ctx, dir, "f") == second);
+    assert(open_inum(ctx, "/d/f") == second);
+
+    // A removed directory's entries go with it, so a directory given its inum starts empty
+    removed = sfs_remove(ctx, "/d");
+    assert(removed && !ctx.dcache.lookup(dir, "f", inum));
+    int reused = -1;
+    for (uint64_t i = 0; i < ctx.sb.num_inodes && reused != dir; ++i) {
+        reused = sfs_mkdir(ctx, "/n" + std::to_string(i));
+        assert(reused > 0);
+    }
+    assert(reused == dir);
+    assert(dir_lookup(ctx, dir, "f") == -1);
+    std::vector<std::string> listed;
+    dir_list(ctx, dir, listed);
+    assert(listed.empty());
+    int fd = sfs_open(ctx, "/d/f");
+    assert(fd < 0); // /d itself is gone
+    unmount(ctx);
+    remove_image(img);
+    std::cout << "[DCache] create, remove and inum reuse OK (cache " << cache << ")\n";
+}
+
+int main() {
+    test_entries();
+    test_mount(false);
+    test_mount(true);
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "sfs.h"
+#include "test_util.h"
+#include "dir.h"
+
+// What dir_list gives for an indexed directory: (hash, name) order
+static std::vector<std::string> hash_order(std::vector<std::string> names) {
+    std::sort(names.begin(), names.end(), [](const std::string& a, const std::string& b) {
+        uint32_t ha = dir_name_hash(a), hb = dir_name_hash(b);
+        return ha != hb ? ha < hb : a < b;
+    });
+    return names;
+}
+
+static std::vector<std::string> list(FSContext& ctx, int dir_inum) {
+    std::vector<std::string> out;
+    bool ok = dir_list(ctx, dir_inum, out);
+    assert(ok);
+    return out;
+}
+
+static int make_dir(FSContext& ctx, const std::string& path) {
+    int inum = sfs_mkdir(ctx, path);
+    assert(inum > 0);
+    return inum;
+}
+
+// Entries point at made-up inodes: the directory code never follows them
+static int inum_of(int i) { return 100000 + i; }
+
+// A linear directory lists in slot order; the add that finds all DIR_INDEX_BLOCKS full indexes
+// it, keeping every entry
+static void test_convert(bool cache) {
+    const std::string img = "test_dir_convert.img";
+    remove_image(img);
+    FSContext ctx(1);
+    mount(ctx, img, cache);
+    int d = make_dir(ctx, "/d");
+    std::vector<std::string> names;
+    const int linear_max = DIR_INDEX_BLOCKS * (BLOCK_SIZE / 256); // 256-byte entries
+    for (int i = 0; i < linear_max; ++i) {
+        names.push_back("f" + std::to_string(i));
+        bool added = dir_add(ctx, d, names.back(), inum_of(i));
+        assert(added);
+    }
+    assert(dir_index_depth(ctx, d) == -1);
+    assert(list(ctx, d) == names);
+
+    names.push_back("last");
+    bool added = dir_add(ctx, d, names.back(), inum_of(names.size()));
+    assert(added);
+    assert(dir_index_depth(ctx, d) == 0);
+    assert(list(ctx, d) == hash_order(names));
+    ctx.dcache.forgetDir(d);
+    for (size_t i = 0; i + 1 < names.size(); ++i) assert(dir_lookup(ctx, d, names[i]) == inum_of(i));
+    assert(dir_lookup(ctx, d, "missing") == -1);
+
+    // Small directories stay linear
+    int small = make_dir(ctx, "/small");
+    for (int i = 0; i < 20; ++i) dir_add(ctx, small, "s" + std::to_string(i), inum_of(i));
+    assert(dir_index_depth(ctx, small) == -1 && list(ctx, small).size() == 20);
+    unmount(ctx);
+    remove_image(img);
+    std::cout << "[DirIndex] conversion at " << DIR_INDEX_BLOCKS << " blocks OK (cache " << cache << ")\n";
+}
+
+// Pairs of distinct names with the same hash; a leaf is only ever split between two hashes, so
+// each pair must stay in one leaf for both names to be found
+static std::vector<std::pair<std::string, std::string>> colliding_names(size_t want) {
+    std::vector<std::pair<std::string, std::string>> pairs;
+    std::unordered_map<uint32_t, std::string> seen;
+    for (int i = 0; pairs.size() < want; ++i) {
+        std::string name = "c" + std::to_string(i);
+        auto [it, fresh] = seen.emplace(dir_name_hash(name), name);
+        if (!fresh) pairs.emplace_back(it->second, name);
+    }
+    return pairs;
+}
+
+// Enough entries in random hash order that leaves split all over and the root splits, giving
+// the index its second level; names of one hash stay together. Then half of them go, and the
+// rest are looked up and removed after a remount.
+static void test_grow(bool cache) {
+    const std::string img = "test_dir_grow.img";
+    remove_image(img);
+    std::vector<std::string> names;
+    for (auto& [a, b] : colliding_names(8)) {
+        names.push_back(a);
+        names.push_back(b);
+    }
+    for (int i = 0; i < 12000; ++i) names.push_back("n" + std::to_string(i));
+    std::shuffle(names.begin(), names.end(), std::mt19937(5));
+    std::unordered_map<std::string, int> inums;
+    for (size_t i = 0; i < names.size(); ++i) inums[names[i]] = inum_of(i);
+
+    std::vector<std::string> kept, gone;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, cache);
+        int d = make_dir(ctx, "/d");
+        size_t deepened = 0;
+        for (size_t i = 0; i < names.size(); ++i) {
+            bool added = dir_add(ctx, d, names[i], inums[names[i]]);
+            assert(added);
+            if (deepened == 0 && i % 100 == 0 && dir_index_depth(ctx, d) == 1) deepened = i;
+        }
+        assert(deepened > 0 && dir_index_depth(ctx, d) == 1);
+        assert(list(ctx, d) == hash_order(names));
+        ctx.dcache.forgetDir(d);
+        for (const std::string& name : names) assert(dir_lookup(ctx, d, name) == inums[name]);
+
+        // Removing leaves the others where they were in the listing
+        for (size_t i = 0; i < names.size(); ++i) {
+            if (i % 2 == 0) {
+                kept.push_back(names[i]);
+                continue;
+            }
+            gone.push_back(names[i]);
+            bool removed = dir_remove(ctx, d, names[i]);
+            assert(removed);
+        }
+        assert(list(ctx, d) == hash_order(kept));
+        unmount(ctx);
+        std::cout << "[DirIndex] depth 1 after " << deepened << " entries OK (cache " << cache << ")\n";
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, cache);
+        int d = dir_lookup(ctx, 1, "d");
+        assert(d > 0 && dir_index_depth(ctx, d) == 1);
+        assert(list(ctx, d) == hash_order(kept));
+        for (const std::string& name : kept) assert(dir_lookup(ctx, d, name) == inums[name]);
+        for (const std::string& name : gone) assert(dir_lookup(ctx, d, name) == -1);
+        for (const std::string& name : gone) {
+            int removed = dir_remove(ctx, d, name);
+            assert(removed == 0);
+        }
+
+        // Removed names can be added again, and then everything goes
+        for (size_t i = 0; i < 1000; ++i) {
+            bool added = dir_add(ctx, d, gone[i], inums[gone[i]]);
+            assert(added);
+            kept.push_back(gone[i]);
+        }
+        assert(list(ctx, d) == hash_order(kept));
+        for (const std::string& name : kept) {
+            bool removed = dir_remove(ctx, d, name);
+            assert(removed);
+        }
+        assert(list(ctx, d).empty());
+        ctx.dcache.forgetDir(d);
+        assert(dir_lookup(ctx, d, kept[0]) == -1);
+        unmount(ctx);
+    }
+    remove_image(img);
+    std::cout << "[DirIndex] remove across remount OK (cache " << cache << ")\n";
+}
+
+int main() {
+    test_convert(false);
+    test_convert(true);
+    test_grow(false);
+    test_grow(true);
+    return 0;
+}
@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "sfs.h"
+#include "test_util.h"
+#include "extent.h"
+
+static const ExtentHeader& root_header(const Inode& ino) { return *(const ExtentHeader*)ino.extents; }
+
+static int count_extents(FSContext& ctx, const Inode& ino, int* tree_blocks = nullptr) {
+    int extents = 0, blocks = 0;
+    bool ok = extent_walk(ctx, ino, [&](const Extent&) { ++extents; return true; },
+                          [&](uint32_t) { ++blocks; });
+    assert(ok);
+    if (tree_blocks) *tree_blocks = blocks;
+    return extents;
+}
+
+// Maps `len` freshly allocated blocks at file block `logical`, and remembers them in `model`
+static void add(FSContext& ctx, Inode& ino, std::vector<Extent>& model, uint32_t logical, int len, uint32_t goal = 0) {
+    int got;
+    int start = block_alloc_range(ctx, len, got, goal);
+    assert(start > 0 && got == len);
+    Extent e{logical, (uint32_t)start, (uint32_t)len};
+    bool ok = extent_insert(ctx, ino, e);
+    assert(ok);
+    model.push_back(e);
+}
+
+static void check_model(FSContext& ctx, const Inode& ino, const std::vector<Extent>& model) {
+    for (const Extent& e : model) {
+        for (uint32_t b = 0; b < e.len; ++b) {
+            uint32_t run;
+            int block = extent_lookup(ctx, ino, e.logical + b, run);
+            assert(block == (int)(e.start + b));
+            assert(run >= 1);
+        }
+    }
+}
+
+// Builds a tree through the inline root, its move into a block, a leaf split and a second
+// level, checking holes and merges on the way, then frees it all. Extents go every kStride file
+// blocks, so none continues the one before it.
+static void test_tree(bool cache) {
+    const uint32_t kStride = 3;
+    const std::string img = "test_extent_tree.img";
+    remove_image(img);
+    FSContext ctx(1);
+    mount(ctx, img, cache);
+    uint64_t base = ctx.block_bitmap.count_set();
+    Inode ino{};
+    ino.mode = 0100644;
+    bmap_init(ctx, ino);
+    assert(ino.mode & INODE_EXTENTS);
+    std::vector<Extent> model;
+    int tree_blocks;
+    uint32_t run;
+
+    // A block that continues an extent in the file and on disk only lengthens it
+    add(ctx, ino, model, 0, 1);
+    add(ctx, ino, model, 1, 1, model[0].start + 1);
+    assert(model[1].start == model[0].start + 1);
+    assert(root_header(ino).entries == 1);
+    assert(extent_lookup(ctx, ino, 0, run) == (int)model[0].start && run == 2);
+
+    // Four extents fit in the inode
+    for (uint32_t i = 1; i < EXTENTS_INLINE; ++i) add(ctx, ino, model, kStride * i, 1);
+    assert(root_header(ino).depth == 0 && root_header(ino).entries == EXTENTS_INLINE);
+    assert(count_extents(ctx, ino, &tree_blocks) == EXTENTS_INLINE && tree_blocks == 0);
+
+    // The fifth moves the root into a new block
+    add(ctx, ino, model, kStride * EXTENTS_INLINE, 1);
+    assert(root_header(ino).depth == 1 && root_header(ino).entries == 1);
+    assert(count_extents(ctx, ino, &tree_blocks) == EXTENTS_INLINE + 1 && tree_blocks == 1);
+
+    // Holes: between extents the run ends at the next one; past the last it never ends
+    assert(extent_lookup(ctx, ino, 2, run) == 0 && run == 1);
+    assert(extent_lookup(ctx, ino, kStride + 1, run) == 0 && run == 2);
+    assert(extent_lookup(ctx, ino, kStride * EXTENTS_INLINE + 1, run) == 0 && run > (1u << 30));
+
+    // The leaf splits once it holds more than a block's worth
+    for (uint32_t i = EXTENTS_INLINE + 1; i <= EXTENTS_PER_BLOCK; ++i) add(ctx, ino, model, kStride * i, 1);
+    assert(root_header(ino).depth == 1 && root_header(ino).entries == 2);
+    assert(count_extents(ctx, ino, &tree_blocks) == EXTENTS_PER_BLOCK + 1 && tree_blocks == 2);
+
+    // Past four full leaves the root grows a second level. Inserted out of order, so leaves
+    // also split in the middle of the tree.
+    const uint32_t total = 6000;
+    std::vector<uint32_t> rest;
+    for (uint32_t i = EXTENTS_PER_BLOCK + 1; i < total; ++i) rest.push_back(kStride * i);
+    std::shuffle(rest.begin(), rest.end(), std::mt19937(7));
+    for (uint32_t logical : rest) add(ctx, ino, model, logical, 1);
+    assert(root_header(ino).depth == 2);
+    assert(count_extents(ctx, ino, &tree_blocks) == (int)total);
+    check_model(ctx, ino, model);
+    for (uint32_t i = 1; i + 1 < total; ++i) {
+        assert(extent_lookup(ctx, ino, kStride * i + 1, run) == 0 && run == kStride - 1);
+    }
+
+    // Every data and tree block goes back
+    bmap_free(ctx, ino);
+    assert(ctx.block_bitmap.count_set() == base);
+    unmount(ctx);
+    remove_image(img);
+    std::cout << "[Extent] tree of " << tree_blocks << " blocks OK (cache " << cache << ")\n";
+}
+
+static void write_at(FSContext& ctx, int fd, std::string& model, int offset, const std::string& data) {
+    bool ok = sfs_seek(ctx, fd, offset, 0);
+    int written = sfs_write(ctx, fd, data.data(), data.size());
+    assert(ok && written == (int)data.size());
+    if (model.size() < offset + data.size()) model.resize(offset + data.size(), '\0');
+    model.replace(offset, data.size(), data);
+}
+
+static void check_file(FSContext& ctx, const std::string& path, const std::string& model) {
+    int fd = sfs_open(ctx, path);
+    std::string back(model.size() + 100, '\1');
+    int got = sfs_read(ctx, fd, back.data(), back.size());
+    assert(got == (int)model.size());
+    back.resize(got);
+    assert(back == model);
+    sfs_close(ctx, fd);
+}
+
+// A file of thousands of scattered extents, overwritten at random and checked against a model
+// before and after a remount; removing it frees every block
+static void test_overwrites(bool cache) {
+    const std::string img = "test_extent_rw.img";
+    remove_image(img);
+    std::mt19937 rng(11);
+    std::string model;
+    uint64_t base;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, cache);
+        base = ctx.block_bitmap.count_set();
+        int fd = sfs_open(ctx, "/f");
+        for (int i = 0; i < 3000; ++i) write_at(ctx, fd, model, 2 * i * BLOCK_SIZE, std::string(BLOCK_SIZE, 'a' + i % 26));
+        for (int i = 0; i < 1000; ++i) {
+            std::string data(1 + rng() % 20000, 'A' + rng() % 26);
+            write_at(ctx, fd, model, rng() % (model.size() + 50000), data);
+        }
+        sfs_close(ctx, fd);
+        check_file(ctx, "/f", model);
+        unmount(ctx);
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, cache);
+        check_file(ctx, "/f", model);
+        bool removed = sfs_remove(ctx, "/f");
+        assert(removed);
+        assert(ctx.block_bitmap.count_set() == base);
+        unmount(ctx);
+    }
+    remove_image(img);
+    std::cout << "[Extent] random overwrites across remount OK (cache " << cache << ")\n";
+}
+
+// A version 2 image is bumped on mount: its block-pointer files stay readable, new files get
+// extents, and a pointer file growing past the indirect block is converted in place
+static void test_upgrade() {
+    const std::string img = "test_extent_v2.img";
+    remove_image(img);
+    std::string small(100000, 's'), big(MAX_FILE_SIZE - BLOCK_SIZE, 'b');
+    uint64_t base;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, false);
+        base = ctx.block_bitmap.count_set();
+        Superblock v2 = ctx.sb;
+        v2.version = 2;
+        bool ok = superblock_write(*ctx.disk, v2);
+        assert(ok);
+        ctx.sb.version = 2; // new inodes use block pointers, as a version 2 build wrote them
+        for (const char* path : {"/small", "/big"}) {
+            int fd = sfs_open(ctx, path);
+            const std::string& data = path[1] == 's' ? small : big;
+            int written = sfs_write(ctx, fd, data.data(), data.size());
+            assert(written == (int)data.size());
+            assert(!(ctx.fd_table.at(fd).ino->mode & INODE_EXTENTS));
+            sfs_close(ctx, fd);
+        }
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, false);
+        assert(ctx.sb.version == SFS_VERSION);
+        check_file(ctx, "/small", small);
+        check_file(ctx, "/big", big);
+        int fd = sfs_open(ctx, "/new");
+        assert(ctx.fd_table.at(fd).ino->mode & INODE_EXTENTS);
+        sfs_close(ctx, fd);
+
+        // Growing past MAX_FILE_BLOCKS converts the file to an extent tree
+        fd = sfs_open(ctx, "/big");
+        std::string more(4 * BLOCK_SIZE, 'm');
+        sfs_seek(ctx, fd, big.size(), 0);
+        int written = sfs_write(ctx, fd, more.data(), more.size());
+        assert(written == (int)more.size());
+        assert(ctx.fd_table.at(fd).ino->mode & INODE_EXTENTS);
+        sfs_close(ctx, fd);
+        big += more;
+    }
+    {
+        FSContext ctx(3);
+        mount(ctx, img, false);
+        check_file(ctx, "/small", small);
+        check_file(ctx, "/big", big);
+        bool removed = sfs_remove(ctx, "/big") && sfs_remove(ctx, "/small") && sfs_remove(ctx, "/new");
+        assert(removed);
+        assert(ctx.block_bitmap.count_set() == base);
+    }
+    remove_image(img);
+    std::cout << "[Extent] version 2 upgrade OK\n";
+}
+
+// Writes and reads at the very end of the largest extent-mapped file: bounds that pass INT_MAX
+// are computed without overflowing, and a write that would end past the limit maps nothing
+static void test_end_of_range() {
+    const std::string img = "test_extent_end.img";
+    remove_image(img);
+    FSContext ctx(1);
+    mount(ctx, img, false);
+    int fd = sfs_open(ctx, "/f");
+    uint64_t base = ctx.block_bitmap.count_set();
+    const int max_bytes = MAX_EXTENT_FILE_BLOCKS * BLOCK_SIZE;
+    std::string data(2 * BLOCK_SIZE, 'e');
+    bool ok = sfs_seek(ctx, fd, max_bytes - BLOCK_SIZE, 0);
+    int written = sfs_write(ctx, fd, data.data(), data.size());
+    assert(ok && written == -1);
+    assert(ctx.block_bitmap.count_set() == base && ctx.fd_table.at(fd).ino->size == 0);
+
+    sfs_seek(ctx, fd, max_bytes - (int)data.size(), 0);
+    written = sfs_write(ctx, fd, data.data(), data.size());
+    assert(written == (int)data.size() && ctx.fd_table.at(fd).ino->size == (uint32_t)max_bytes);
+    std::string back(4 * BLOCK_SIZE, '\0');
+    sfs_seek(ctx, fd, max_bytes - (int)data.size(), 0);
+    int got = sfs_read(ctx, fd, back.data(), back.size());
+    assert(got == (int)data.size() && back.substr(0, got) == data);
+    sfs_close(ctx, fd);
+    bool removed = sfs_remove(ctx, "/f");
+    assert(removed);
+    remove_image(img);
+    std::cout << "[Extent] end of the largest file OK\n";
+}
+
+int main() {
+    test_tree(false);
+    test_tree(true);
+    test_overwrites(false);
+    test_overwrites(true);
+    test_upgrade();
+    test_end_of_range();
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "sfs.h"
+#include "test_util.h"
+#include "bmap.h"
+#include "block_manager.h"
+
+// The inode as its table block holds it, past the icache
+static Inode table_inode(FSContext& ctx, int inum) {
+    char scratch[BLOCK_SIZE];
+    BlockRef ref;
+    const char* block = block_load(ctx, ctx.sb.inode_table_start + inum / INODES_PER_BLOCK, ref, scratch, BlockKind::Inode);
+    assert(block);
+    Inode ino;
+    std::memcpy(&ino, block + inum % INODES_PER_BLOCK * sizeof(Inode), sizeof(Inode));
+    return ino;
+}
+
+static std::string content(int i, int size) { return std::string(size, 'a' + i % 26); }
+
+static void append(FSContext& ctx, int fd, std::string& model, const std::string& data) {
+    sfs_seek(ctx, fd, 0, 2);
+    int written = sfs_write(ctx, fd, data.data(), data.size());
+    assert(written == (int)data.size());
+    model += data;
+}
+
+static void check_file(FSContext& ctx, const std::string& path, const std::string& model) {
+    int fd = sfs_open(ctx, path);
+    std::string back(model.size() + 100, '\1');
+    int got = sfs_read(ctx, fd, back.data(), back.size());
+    assert(got == (int)model.size());
+    back.resize(got);
+    assert(back == model);
+    sfs_close(ctx, fd);
+}
+
+// An append only dirties the cached inode; sfs_close and sfs_fsync write it to the table, and
+// an unmount writes back what is still open
+static void test_sync_points(bool cache) {
+    const std::string img = "test_icache_sync.img";
+    remove_image(img);
+    std::string closed, synced, open;
+    {
+        FSContext ctx(1);
+        mount(ctx, img, cache);
+        int fd = sfs_open(ctx, "/closed");
+        int inum = ctx.fd_table.at(fd).inum;
+        append(ctx, fd, closed, content(0, 5000));
+        append(ctx, fd, closed, content(1, 3 * BLOCK_SIZE));
+        assert(table_inode(ctx, inum).size != closed.size());
+        bool ok = sfs_close(ctx, fd);
+        assert(ok && table_inode(ctx, inum).size == closed.size());
+
+        fd = sfs_open(ctx, "/synced");
+        inum = ctx.fd_table.at(fd).inum;
+        append(ctx, fd, synced, content(2, 7000));
+        ok = sfs_fsync(ctx, fd);
+        assert(ok && table_inode(ctx, inum).size == synced.size());
+        append(ctx, fd, synced, content(3, 100));
+        sfs_close(ctx, fd);
+
+        // Left open: the FSContext destructor writes it back
+        fd = sfs_open(ctx, "/open");
+        append(ctx, fd, open, content(4, 2 * BLOCK_SIZE + 1));
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, cache);
+        check_file(ctx, "/closed", closed);
+        check_file(ctx, "/synced", synced);
+        check_file(ctx, "/open", open);
+        unmount(ctx);
+    }
+    remove_image(img);
+    std::cout << "[ICache] close, fsync and unmount write back OK (cache " << cache << ")\n";
+}
+
+// More dirty inodes than the cache holds: the evicted ones reach the table with their sizes and
+// mappings, while inodes pinned by open files stay cached however far the rest churn
+static void test_eviction(bool cache) {
+    const std::string img = "test_icache_evict.img";
+    remove_image(img);
+    const int files = ICACHE_INODES + 1000, pinned = 8;
+    std::vector<Inode> expected(files);
+    std::vector<int> inums(files);
+    std::vector<std::string> models(pinned);
+    {
+        FSContext ctx(1);
+        mount(ctx, img, cache, FSGeometry{1 << 17, 2 * ICACHE_INODES});
+        std::vector<int> fds;
+        std::vector<Inode*> held;
+        for (int i = 0; i < pinned; ++i) {
+            fds.push_back(sfs_open(ctx, "/p" + std::to_string(i)));
+            held.push_back(ctx.fd_table.at(fds.back()).ino);
+        }
+        uint64_t writebacks = ctx.icache.stats().writebacks;
+        for (int i = 0; i < files; ++i) {
+            int inum = sfs_create(ctx, "/e" + std::to_string(i));
+            assert(inum > 0);
+            Inode ino;
+            bool ok = inode_read(ctx, inum, ino) && bmap_alloc(ctx, ino, 1, 1 + i % 3);
+            assert(ok);
+            ino.size = (2 + i % 3) * BLOCK_SIZE;
+            inode_write(ctx, inum, ino);
+            inums[i] = inum;
+            expected[i] = ino;
+            if (i % 500 == 0) append(ctx, fds[i / 500 % pinned], models[i / 500 % pinned], content(i, 3000));
+        }
+        assert(ctx.icache.size() <= (size_t)ICACHE_INODES + pinned);
+        assert(ctx.icache.stats().writebacks - writebacks >= (uint64_t)(files - ICACHE_INODES));
+        // The first inodes dirtied were evicted long ago, so only write-back put them there
+        for (int i = 0; i < 100; ++i) {
+            Inode on_disk = table_inode(ctx, inums[i]);
+            assert(std::memcmp(&on_disk, &expected[i], sizeof(Inode)) == 0);
+        }
+        for (int i = 0; i < pinned; ++i) {
+            assert(ctx.fd_table.at(fds[i]).ino == held[i] && held[i]->size == models[i].size());
+            sfs_close(ctx, fds[i]);
+        }
+        unmount(ctx);
+    }
+    {
+        FSContext ctx(2);
+        mount(ctx, img, cache, FSGeometry{1 << 17, 2 * ICACHE_INODES});
+        for (int i = 0; i < files; ++i) {
+            Inode ino;
+            bool ok = inode_read(ctx, inums[i], ino);
+            assert(ok && std::memcmp(&ino, &expected[i], sizeof(Inode)) == 0);
+            for (int b = 0; b < 2 + i % 3; ++b) assert(bmap_lookup(ctx, ino, b) > 0);
+        }
+        for (int i = 0; i < pinned; ++i) check_file(ctx, "/p" + std::to_string(i), models[i]);
+        unmount(ctx);
+    }
+    remove_image(img);
+    std::cout << "[ICache] eviction of " << files << " dirty inodes OK (cache " << cache << ")\n";
+}
+
+int main() {
+    test_sync_points(false);
+    test_sync_points(true);
+    test_eviction(false);
+    test_eviction(true);
+    return 0;
+}
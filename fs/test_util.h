@@ -0,0 +1,22 @@
+#pragma once
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include "sfs.h"
+
+// Fixture shared by the test_*.cpp programs: scratch images live under images/ like any other,
+// on a small geometry so a test formats one instantly.
+
+inline void remove_image(const std::string& img) { std::remove(("images/" + img).c_str()); }
+
+inline void mount(FSContext& ctx, const std::string& img, bool cache, FSGeometry geometry = FSGeometry{1 << 16, 1024}) {
+    ctx.use_cache = cache;
+    ctx.geometry = geometry;
+    bool ok = sfs_init(ctx, img);
+    assert(ok);
+}
+
+// Everything written reaches the image, as a later mount of it expects
+inline void unmount(FSContext& ctx) {
+    if (ctx.use_cache) ctx.cache_controller->flushAll();
+}